@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <spdlog/spdlog.h>
+#include "BenchmarkRegistry.h"
+#include "Engine/Components/Renderers/AnimatedModelRenderer.h"
+#include "Engine/EngineObjects/CameraRenderData.h"
+#include "Engine/Rendering/Frustum.h"
+#include "Models/Animation.h"
+#include "Models/AnimationCompressor.h"
+#include "Models/Animator.h"
+#include "Models/ModelManager.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr int UpdateCount = 10000;
+    constexpr float DeltaTime = 1.0f / 60.0f;
+    /*times every bone is sampled at, spread evenly over the clip*/
+    constexpr int SampleCount = 1000;
+    constexpr float ResampleRate = 30.0f;
+
+    /**
+     * @brief Updates an animator repeatedly.
+     * @return Microseconds per update.
+     */
+    double MeasureUpdates(Models::Animator& animator)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < UpdateCount; ++i)
+        {
+            animator.UpdateAnimation(DeltaTime);
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+               UpdateCount;
+    }
+
+    /**
+     * @brief Samples every bone at evenly spread times.
+     * @param sample Invoked with index of the bone and time in ticks, returns the pose.
+     * @param poses Sampled poses, bone after bone.
+     * @return Nanoseconds per sampled bone.
+     */
+    template<class TSample>
+    double MeasureSampling(const Models::Animation& animation, TSample&& sample, std::vector<Models::BonePose>& poses)
+    {
+        const int boneCount = animation.GetBoneCount();
+        poses.resize(static_cast<size_t>(boneCount) * SampleCount);
+        const auto start = std::chrono::steady_clock::now();
+        for (int bone = 0; bone < boneCount; ++bone)
+        {
+            for (int i = 0; i < SampleCount; ++i)
+            {
+                const float time = animation.GetDuration() * static_cast<float>(i) / SampleCount;
+                poses[static_cast<size_t>(bone) * SampleCount + i] = sample(bone, time);
+            }
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+               std::max<size_t>(poses.size(), 1);
+    }
+
+    size_t GetMemoryUsage(const std::vector<Models::CompressedBone>& bones)
+    {
+        size_t result = 0;
+        for (const Models::CompressedBone& bone : bones)
+        {
+            result += bone.GetMemoryUsage();
+        }
+        return result;
+    }
+
+    float GetMaxPositionError(const std::vector<Models::BonePose>& reference,
+                              const std::vector<Models::BonePose>& poses)
+    {
+        float result = 0.0f;
+        for (size_t i = 0; i < poses.size(); ++i)
+        {
+            result = std::max(result, glm::distance(reference[i].position, poses[i].position));
+        }
+        return result;
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures pose evaluation of a clip played alone, blended with a second clip of the same skeleton
+     * by a blend tree and with the second clip as an additive layer on top, logs time per update.
+     */
+    class BlendingBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Compresses a clip with reduced keys and with resampled keys, logs memory per clip, time per sampled
+     * bone and largest position error of every variant.
+     */
+    class CompressionBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Measures animating renderers spread over 0-60 units around a camera with and without level
+     * of detail, logs time per frame. Renderers are culled against the camera's frustum and their rate is
+     * chosen by distance to it the same way AnimatedModelRenderer::Update does.
+     */
+    class AnimationLodBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(BlendingBenchmark, "blending", "<clip> <second clip>", 2,
+              "compares evaluating a clip alone and blended with another")
+    BENCHMARK(CompressionBenchmark, "compression", "<clip>", 1,
+              "compares memory and decode cost of a clip and its compressions")
+    BENCHMARK(AnimationLodBenchmark, "animation-lod", "<animated model>", 1,
+              "compares animation cost with and without level of detail of copies of the model around a camera")
+
+    void BlendingBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::string& path = Context.Arguments[0];
+        const std::string& secondPath = Context.Arguments[1];
+        Models::Animation* clip = Models::ModelManager::GetAnimation(path.c_str());
+        Models::Animation* secondClip = Models::ModelManager::GetAnimation(secondPath.c_str());
+        if (clip == nullptr || secondClip == nullptr || clip->GetNodes().empty())
+        {
+            spdlog::error("Animations {0} and {1} can't be loaded, blending isn't measured.", path, secondPath);
+            return;
+        }
+        if (clip == secondClip)
+        {
+            spdlog::error("Blending is measured with two different clips, {0} was given twice.", path);
+            return;
+        }
+
+        Models::Animator single(clip);
+        const double singleTime = MeasureUpdates(single);
+
+        /*the parameter keeps both motions at equal weights, so every update samples both clips*/
+        Models::BlendTree tree;
+        tree.AddMotion(clip, 0.0f);
+        tree.AddMotion(secondClip, 1.0f);
+        Models::Animator blended;
+        blended.PlayBlendTree(tree);
+        blended.GetBlendTree()->SetParameter(0.5f);
+        const double blendedTime = MeasureUpdates(blended);
+
+        Models::Animator layered(clip);
+        layered.AddLayer(secondClip, Models::AnimationLayerMode::Additive, 0.5f);
+        const double layeredTime = MeasureUpdates(layered);
+
+        spdlog::info("Animations {0} and {1}, {2} nodes: single clip {3:.2f} us, blend tree {4:.2f} us, additive "
+                     "layer {5:.2f} us per update", path, secondPath, clip->GetNodes().size(), singleTime,
+                     blendedTime, layeredTime);
+    }
+
+    void CompressionBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::string& path = Context.Arguments[0];
+        const Models::Animation* clip = Models::ModelManager::GetAnimation(path.c_str());
+        if (clip == nullptr || clip->IsCompressed() || clip->GetBoneCount() == 0)
+        {
+            spdlog::error("Animation {0} isn't an uncompressed clip, compression isn't measured.", path);
+            return;
+        }
+
+        std::vector<Models::BonePose> reference;
+        const double fullTime = MeasureSampling(*clip, [clip](const int bone, const float time)
+        {
+            return clip->SampleBone(bone, time);
+        }, reference);
+        spdlog::info("Animation {0}, {1} bones: uncompressed {2} bytes, {3:.1f} ns per bone sample", path,
+                     clip->GetBoneCount(), clip->GetMemoryUsage(), fullTime);
+
+        Models::AnimationCompressionSettings settings;
+        for (const float sampleRate : {0.0f, ResampleRate})
+        {
+            settings.sampleRate = sampleRate;
+            const std::vector<Models::CompressedBone> bones =
+                Models::AnimationCompressor::CompressBones(*clip, settings);
+            std::vector<Models::BonePose> poses;
+            const double sampleTime = MeasureSampling(*clip, [&bones](const int bone, const float time)
+            {
+                return bones[bone].Sample(time);
+            }, poses);
+            spdlog::info("Animation {0}, compressed at {1} Hz (0 keeps source key times): {2} bytes, {3:.1f} ns per "
+                         "bone sample, max position error {4}", path, sampleRate, GetMemoryUsage(bones), sampleTime,
+                         GetMaxPositionError(reference, poses));
+        }
+    }
+
+    void AnimationLodBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        constexpr int rendererCount = 100;
+        constexpr int frameCount = 240;
+        constexpr float maxDistance = 60.0f;
+        constexpr float deltaTime = 1.0f / 60.0f;
+
+        const std::string& path = Context.Arguments[0];
+        Models::ModelAnimated* model = Models::ModelManager::GetAnimatedModel(path.c_str());
+        Models::Animation* animation = Models::ModelManager::GetAnimation(path.c_str());
+        if (model == nullptr || model->GetMeshCount() == 0 || animation == nullptr || animation->GetNodes().empty())
+        {
+            spdlog::error("Animated model {0} can't be loaded, level of detail isn't measured.", path);
+            return;
+        }
+
+        /*same projection as the game camera, looking down -z*/
+        Engine::Camera camera(glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 100.0f), 0.0f);
+        camera.SetPositionAndRotation(glm::vec3(0.0f), 0.0f, -glm::half_pi<float>());
+        const Engine::CameraRenderData renderData(camera.GetPosition(), camera.GetTransform(),
+                                                  camera.GetProjectionMatrix());
+        Engine::Frustum frustum;
+        frustum.UpdateFrustum(renderData);
+
+        /*renderers get further away one by one and are spread around the camera by the golden angle, so some of
+         *them are behind it*/
+        std::vector<std::unique_ptr<Engine::AnimatedModelRenderer>> renderers;
+        std::vector<glm::mat4> objectToWorldMatrices;
+        int visibleCount = 0;
+        for (int i = 0; i < rendererCount; ++i)
+        {
+            renderers.push_back(std::make_unique<Engine::AnimatedModelRenderer>());
+            renderers.back()->SetModel(model);
+            renderers.back()->SetAnimation(animation);
+            renderers.back()->SetAnimator();
+
+            const float distance = maxDistance * (static_cast<float>(i) + 0.5f) / rendererCount;
+            const float angle = static_cast<float>(i) * 2.39996323f;
+            const glm::vec3 position = distance * glm::vec3(std::sin(angle), 0.0f, -std::cos(angle));
+            objectToWorldMatrices.push_back(glm::translate(glm::mat4(1.0f), position));
+            visibleCount += renderers.back()->IsVisible(objectToWorldMatrices.back(), frustum) ? 1 : 0;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            for (const std::unique_ptr<Engine::AnimatedModelRenderer>& renderer : renderers)
+            {
+                Models::Animator* animator = renderer->GetAnimator();
+                animator->SetUpdateInterval(1);
+                animator->SetLeafBonePruning(0);
+                animator->UpdateAnimation(deltaTime);
+            }
+        }
+        const double withoutLod = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                            start).count() / frameCount;
+
+        start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            for (int i = 0; i < rendererCount; ++i)
+            {
+                renderers[i]->UpdateLevelOfDetail(deltaTime, objectToWorldMatrices[i], frustum, camera.GetPosition());
+            }
+        }
+        const double withLod = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                         start).count() / frameCount;
+
+        spdlog::info("Animation LOD, {0} renderers of {1}, {2} of them visible: without LOD {3:.3f} ms, with LOD "
+                     "{4:.3f} ms per frame", rendererCount, path, visibleCount, withoutLod, withLod);
+    }
+} // Benchmarks
@@ -0,0 +1,102 @@
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/Engine.h"
+#include "spdlog/spdlog.h"
+
+namespace
+{
+    void LogBenchmarks()
+    {
+        for (const Benchmarks::BenchmarkRegistry::Entry* entry : Benchmarks::BenchmarkRegistry::GetEntries())
+        {
+            spdlog::info("  {0} {1}", entry->Name, entry->Arguments);
+            spdlog::info("      {0}", entry->Description);
+        }
+    }
+}
+
+/*
+ * Usage:
+ *   benchmarks --list                     lists benchmarks and their arguments
+ *   benchmarks <scene.lvl> <benchmark> [arguments] [--frames <n>] [--timestep <seconds>] [--replay-input <file>]
+ *              [--seed <n>]
+ *                                         simulates a scene the same way as game --headless, then runs
+ *                                         the benchmark on it
+ */
+int main(int argc, char** argv)
+{
+    if (argc == 2 && std::strcmp(argv[1], "--list") == 0)
+    {
+        LogBenchmarks();
+        return 0;
+    }
+    if (argc < 3)
+    {
+        spdlog::error("Run with <scene.lvl> <benchmark> [arguments], available benchmarks:");
+        LogBenchmarks();
+        return EXIT_FAILURE;
+    }
+
+    const Benchmarks::BenchmarkRegistry::Entry* entry = Benchmarks::BenchmarkRegistry::Find(argv[2]);
+    if (entry == nullptr)
+    {
+        spdlog::error("Unknown benchmark {0}, available benchmarks:", argv[2]);
+        LogBenchmarks();
+        return EXIT_FAILURE;
+    }
+
+    Engine::HeadlessSettings settings;
+    settings.ScenePath = argv[1];
+    Benchmarks::BenchmarkContext context;
+    context.ScenePath = settings.ScenePath;
+    for (int i = 3; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--frames") == 0 && hasValue)
+        {
+            settings.Frames = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--timestep") == 0 && hasValue)
+        {
+            settings.TimeStep = std::stof(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--replay-input") == 0 && hasValue)
+        {
+            settings.InputReplayPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+        {
+            settings.Seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else
+        {
+            context.Arguments.emplace_back(argv[i]);
+        }
+    }
+    if (context.Arguments.size() < entry->RequiredArguments)
+    {
+        spdlog::error("Benchmark {0} takes arguments {1}.", entry->Name, entry->Arguments);
+        return EXIT_FAILURE;
+    }
+
+    const std::unique_ptr<Benchmarks::IBenchmark> benchmark = entry->Create();
+    settings.OnSceneLoaded = [&context, &benchmark](Engine::Scene* const Scene)
+    {
+        context.Scene = Scene;
+        benchmark->OnSceneLoaded(context);
+    };
+    settings.OnSimulated = [&context, &benchmark](Engine::Scene* const Scene)
+    {
+        context.Scene = Scene;
+        benchmark->Run(context);
+    };
+
+    Engine::Engine* engine = new Engine::Engine();
+    int exitCode = engine->RunHeadless(settings);
+    delete engine;
+    return exitCode;
+}
@@ -0,0 +1,30 @@
+#include "BenchmarkRegistry.h"
+
+#include <algorithm>
+
+namespace Benchmarks
+{
+    const BenchmarkRegistry::Entry* BenchmarkRegistry::Find(const std::string_view Name)
+    {
+        for (const Entry& entry : GetStorage())
+        {
+            if (entry.Name == Name)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<const BenchmarkRegistry::Entry*> BenchmarkRegistry::GetEntries()
+    {
+        /*registration order depends on the order files are initialized in*/
+        std::vector<const Entry*> entries;
+        for (const Entry& entry : GetStorage())
+        {
+            entries.push_back(&entry);
+        }
+        std::ranges::sort(entries, [](const Entry* Left, const Entry* Right) { return Left->Name < Right->Name; });
+        return entries;
+    }
+} // Benchmarks
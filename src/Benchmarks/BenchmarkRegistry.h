@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine
+{
+    class Scene;
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Scene and arguments a benchmark is run with.
+     */
+    struct BenchmarkContext
+    {
+        /*path of the simulated scene*/
+        std::string ScenePath;
+        Engine::Scene* Scene = nullptr;
+        /*arguments following the benchmark name, at least as many as the benchmark requires*/
+        std::vector<std::string> Arguments;
+    };
+
+    /**
+     * @brief Measurement run on a scene after its headless simulation, logs its results.
+     */
+    class IBenchmark
+    {
+    public:
+        virtual ~IBenchmark() = default;
+
+    public:
+        /**
+         * @brief Called once the scene is loaded, before it's simulated.
+         */
+        virtual void OnSceneLoaded(const BenchmarkContext& Context)
+        {
+        }
+
+        /**
+         * @brief Measures and logs results, called after the simulation.
+         */
+        virtual void Run(const BenchmarkContext& Context) = 0;
+    };
+
+    /**
+     * @brief Benchmarks of the benchmark executable by name, every benchmark registers itself with BENCHMARK.
+     */
+    class BenchmarkRegistry final
+    {
+    public:
+        struct Entry
+        {
+            std::string Name;
+            /*arguments following the name, shown in usage*/
+            std::string Arguments;
+            std::string Description;
+            size_t RequiredArguments;
+            std::unique_ptr<IBenchmark> (*Create)();
+        };
+
+    private:
+        BenchmarkRegistry() = default;
+
+        [[nodiscard]] static std::vector<Entry>& GetStorage()
+        {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+
+    public:
+        /**
+         * @brief Registers a benchmark, called during static initialization by BENCHMARK.
+         * @tparam T Benchmark class, default constructible.
+         * @return Always true, so registration can initialize a static.
+         */
+        template<class T>
+        static bool Register(const char* Name, const char* Arguments, const size_t RequiredArguments,
+                             const char* Description)
+        {
+            const auto create = []() -> std::unique_ptr<IBenchmark>
+            {
+                return std::make_unique<T>();
+            };
+            GetStorage().push_back(Entry{Name, Arguments, Description, RequiredArguments, create});
+            return true;
+        }
+
+        /**
+         * @brief Returns a benchmark registered under a name or nullptr if there is none.
+         */
+        [[nodiscard]] static const Entry* Find(std::string_view Name);
+
+        /**
+         * @brief Returns all benchmarks sorted by name.
+         */
+        [[nodiscard]] static std::vector<const Entry*> GetEntries();
+    };
+} // Benchmarks
+
+/**
+ * @brief Registers a benchmark class with BenchmarkRegistry, used once in the file defining the class.
+ */
+#define BENCHMARK(__CLASS__, __NAME__, __ARGUMENTS__, __REQUIRED_ARGUMENTS__, __DESCRIPTION__)\
+    static const bool __CLASS__##Registered = Benchmarks::BenchmarkRegistry::Register<__CLASS__>(__NAME__,\
+        __ARGUMENTS__, __REQUIRED_ARGUMENTS__, __DESCRIPTION__);
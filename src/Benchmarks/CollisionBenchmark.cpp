@@ -0,0 +1,250 @@
+#include <array>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/Components/Colliders/Collider.h"
+#include "Engine/Components/Physics/Rigidbody.h"
+#include "Engine/EngineObjects/ComponentRegistry.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /*collision response looks up rigidbodies of both colliders and the mass of its own one*/
+    constexpr uint32_t LookupsPerContact = 4;
+    constexpr uint32_t MinimumContacts = 1000000;
+
+    Engine::Rigidbody* FindRigidbodyByCast(const Engine::Entity* Entity)
+    {
+        for (Engine::Component* component : *Entity)
+        {
+            if (Engine::Rigidbody* rigidbody = dynamic_cast<Engine::Rigidbody*>(component))
+            {
+                return rigidbody;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Pairs every collider with the next one and looks up their rigidbodies.
+     * @return Nanoseconds per contact and number of rigidbodies found, so lookups can't be optimized away.
+     */
+    template<class TLookup>
+    std::pair<double, uint32_t> MeasureContacts(const std::vector<Engine::Component*>& Colliders, TLookup&& Lookup)
+    {
+        const size_t count = Colliders.size();
+        const uint32_t repetitions = static_cast<uint32_t>(MinimumContacts / count + 1);
+        uint32_t found = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t repetition = 0; repetition < repetitions; ++repetition)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Engine::Entity* self = Colliders[i]->GetOwner();
+                const Engine::Entity* other = Colliders[(i + 1) % count]->GetOwner();
+                found += Lookup(self) != nullptr;
+                found += Lookup(self) != nullptr;
+                found += Lookup(self) != nullptr;
+                found += Lookup(other) != nullptr;
+            }
+        }
+        const double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                                            start).count();
+        return {nanoseconds / (static_cast<double>(repetitions) * count), found};
+    }
+
+    /**
+     * @brief Pairs every collider with the next one and filters the contact the way collision callbacks do.
+     * @param Filter Invoked with index of the other collider, returns whether the callback reacts to it.
+     * @return Nanoseconds per contact and number of contacts accepted by the filter.
+     */
+    template<class TFilter>
+    std::pair<double, uint32_t> MeasureCallbacks(const size_t Count, TFilter&& Filter)
+    {
+        const uint32_t repetitions = static_cast<uint32_t>(MinimumContacts / Count + 1);
+        uint32_t accepted = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t repetition = 0; repetition < repetitions; ++repetition)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                accepted += Filter((i + 1) % Count);
+            }
+        }
+        const double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                                            start).count();
+        return {nanoseconds / (static_cast<double>(repetitions) * Count), accepted};
+    }
+
+    /**
+     * @brief Listener of benchmarked collision events, counts contacts so calls can't be optimized away.
+     */
+    struct ContactCounter
+    {
+        uint32_t Contacts = 0;
+
+        void OnCollision(Engine::Collider* const Other)
+        {
+            Contacts += Other != nullptr;
+        }
+    };
+
+    std::vector<Engine::Component*> GetOwnedColliders()
+    {
+        std::vector<Engine::Component*> colliders;
+        for (Engine::Component* collider : Engine::ComponentRegistry::GetComponents<Engine::Collider>())
+        {
+            if (collider->GetOwner() != nullptr)
+            {
+                colliders.push_back(collider);
+            }
+        }
+        return colliders;
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures looking up rigidbodies of colliding entities the way collision response does, once by
+     * TypeId and once by a dynamic_cast scan of components, for every collider of the scene.
+     */
+    class CollisionLookupsBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Measures the name filter of collision callbacks, which picks a tool among three names, for every
+     * collider of the scene, once comparing interned names and once comparing copies of name strings.
+     */
+    class CollisionCallbacksBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Measures invoking a collision event with 1, 2 and 4 listeners once per contact of every collider
+     * of the scene, once with TEvent and once with a list of std::function as events used to be.
+     */
+    class CollisionEventsBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(CollisionLookupsBenchmark, "collision-lookups", "", 0,
+              "compares component lookups of collision response by TypeId and by dynamic_cast")
+    BENCHMARK(CollisionCallbacksBenchmark, "collision-callbacks", "", 0,
+              "compares name filters of collision callbacks on interned names and on string copies")
+    BENCHMARK(CollisionEventsBenchmark, "events", "", 0,
+              "compares invoking collision events with TEvent and with std::function lists")
+
+    void CollisionLookupsBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::vector<Engine::Component*> colliders = GetOwnedColliders();
+        if (colliders.empty())
+        {
+            spdlog::warn("The scene has no colliders, collision lookups aren't measured.");
+            return;
+        }
+
+        const auto [typeIdTime, typeIdFound] = MeasureContacts(colliders, [](const Engine::Entity* Owner)
+        {
+            return Owner->GetComponent<Engine::Rigidbody>();
+        });
+        const auto [castTime, castFound] = MeasureContacts(colliders, FindRigidbodyByCast);
+        spdlog::info("Collision lookups of {0} colliders, {1} per contact: TypeId {2:.1f} ns, dynamic_cast scan "
+                     "{3:.1f} ns per contact, {4} and {5} rigidbodies found", colliders.size(), LookupsPerContact,
+                     typeIdTime, castTime, typeIdFound, castFound);
+    }
+
+    void CollisionCallbacksBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::vector<Engine::Component*> colliders = GetOwnedColliders();
+        if (colliders.empty())
+        {
+            spdlog::warn("The scene has no colliders, collision callbacks aren't measured.");
+            return;
+        }
+
+        /*same names as the tool swapping callback of the player*/
+        static const Engine::NameId stripperColliderName = Engine::NameTable::Intern("StripperCollider");
+        static const Engine::NameId vacuumColliderName = Engine::NameTable::Intern("VacuumCollider");
+        static const Engine::NameId broomColliderName = Engine::NameTable::Intern("BroomCollider");
+        const size_t count = colliders.size();
+        const auto [internedTime, internedAccepted] = MeasureCallbacks(count, [&colliders](const size_t Other)
+        {
+            const Engine::NameId name = colliders[Other]->GetOwner()->GetNameId();
+            return name == stripperColliderName || name == vacuumColliderName || name == broomColliderName;
+        });
+
+        /*names used to be stored in entities as strings and returned by copy*/
+        std::vector<std::string> names;
+        names.reserve(count);
+        for (const Engine::Component* collider : colliders)
+        {
+            names.push_back(collider->GetOwner()->GetName());
+        }
+        const auto [stringTime, stringAccepted] = MeasureCallbacks(count, [&names](const size_t Other)
+        {
+            const std::string name = names[Other];
+            return name == "StripperCollider" || name == "VacuumCollider" || name == "BroomCollider";
+        });
+
+        spdlog::info("Collision callbacks of {0} colliders: interned names {1:.1f} ns, string copies {2:.1f} ns "
+                     "per contact, {3} and {4} contacts accepted", count, internedTime, stringTime,
+                     internedAccepted, stringAccepted);
+    }
+
+    void CollisionEventsBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::vector<Engine::Component*> colliders = GetOwnedColliders();
+        if (colliders.empty())
+        {
+            spdlog::warn("The scene has no colliders, collision events aren't measured.");
+            return;
+        }
+
+        constexpr std::array<uint32_t, 3> listenerCounts = {1, 2, 4};
+        for (const uint32_t listenerCount : listenerCounts)
+        {
+            std::array<ContactCounter, 4> counters;
+            Events::TEvent<Engine::Collider*> event;
+            std::vector<std::function<void(Engine::Collider*)>> functions;
+            for (uint32_t i = 0; i < listenerCount; ++i)
+            {
+                ContactCounter* counter = &counters[i];
+                event.AddListener(Events::TAction<Engine::Collider*>(counter, &ContactCounter::OnCollision));
+                functions.emplace_back([counter](Engine::Collider* const Other) { counter->OnCollision(Other); });
+            }
+
+            const double eventTime = MeasureCallbacks(colliders.size(), [&](const size_t Other)
+            {
+                event.Invoke(static_cast<Engine::Collider*>(colliders[Other]));
+                return true;
+            }).first;
+            const double functionTime = MeasureCallbacks(colliders.size(), [&](const size_t Other)
+            {
+                for (const std::function<void(Engine::Collider*)>& function : functions)
+                {
+                    function(static_cast<Engine::Collider*>(colliders[Other]));
+                }
+                return true;
+            }).first;
+
+            spdlog::info("Collision event with {0} listeners: TEvent {1:.1f} ns, std::function list {2:.1f} ns per "
+                         "contact, {3} contacts counted", listenerCount, eventTime, functionTime, counters[0].Contacts);
+        }
+    }
+} // Benchmarks
@@ -0,0 +1,12 @@
+#include "Engine/EngineObjects/JobSystem.h"
+
+/*
+ * Usage:
+ *   TideEngineJobSystemBenchmark          measures cost of a job and ParallelFor speedup on 1-8 threads
+ */
+int main()
+{
+    Engine::JobSystem::Benchmark();
+    Engine::JobSystem::Shutdown();
+    return 0;
+}
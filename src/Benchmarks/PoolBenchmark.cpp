@@ -0,0 +1,172 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/Components/Colliders/BoxCollider.h"
+#include "Engine/Components/Physics/Rigidbody.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+#include "Utility/ObjectPool.h"
+
+namespace
+{
+    constexpr size_t ObjectCount = 10000;
+    constexpr uint32_t IterationCount = 100;
+    /*every round destroys and creates half of the rigidbodies, like trash being absorbed and spawned*/
+    constexpr uint32_t ChurnRounds = 20;
+
+    struct PoolMeasurement
+    {
+        size_t Allocations = 0;
+        double ChurnNanoseconds = 0.0;
+        double RigidbodyNanoseconds = 0.0;
+        double ColliderNanoseconds = 0.0;
+    };
+
+    /*keeps the collider loop from being optimized away*/
+    volatile float BoundsSink = 0.0f;
+
+    double GetNanosecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count();
+    }
+
+    /**
+     * @brief Creates an object from the pool of its class or, bypassing the pool, with global new.
+     */
+    template<class T>
+    T* Create(const bool IsPooled)
+    {
+        return IsPooled ? new T() : ::new T();
+    }
+
+    template<class T>
+    void Destroy(T* const Object, const bool IsPooled)
+    {
+        if (IsPooled)
+        {
+            delete Object;
+        }
+        else
+        {
+            ::delete Object;
+        }
+    }
+
+    size_t GetPoolAllocations()
+    {
+        return Utility::TObjectPool<Engine::BoxCollider>::GetInstance("BoxCollider").GetStatistics().Allocations +
+               Utility::TObjectPool<Engine::Rigidbody>::GetInstance("Rigidbody").GetStatistics().Allocations;
+    }
+
+    PoolMeasurement Measure(const bool IsPooled)
+    {
+        PoolMeasurement measurement;
+        const size_t poolAllocations = GetPoolAllocations();
+
+        /*other components and entities are allocated in between, they scatter objects from global new*/
+        std::vector<std::unique_ptr<std::byte[]>> unrelated;
+        std::vector<Engine::Collider*> colliders;
+        std::vector<Engine::Rigidbody*> rigidbodies;
+        unrelated.reserve(ObjectCount * 2);
+        colliders.reserve(ObjectCount);
+        rigidbodies.reserve(ObjectCount);
+        for (size_t i = 0; i < ObjectCount; ++i)
+        {
+            colliders.push_back(Create<Engine::BoxCollider>(IsPooled));
+            unrelated.push_back(std::make_unique<std::byte[]>(32 + i * 37 % 224));
+            rigidbodies.push_back(Create<Engine::Rigidbody>(IsPooled));
+            unrelated.push_back(std::make_unique<std::byte[]>(32 + i * 53 % 224));
+        }
+        measurement.Allocations = ObjectCount * 2;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t round = 0; round < ChurnRounds; ++round)
+        {
+            for (size_t i = round % 2; i < ObjectCount; i += 2)
+            {
+                Destroy(rigidbodies[i], IsPooled);
+            }
+            for (size_t i = round % 2; i < ObjectCount; i += 2)
+            {
+                rigidbodies[i] = Create<Engine::Rigidbody>(IsPooled);
+            }
+        }
+        const size_t churned = ChurnRounds * (ObjectCount / 2);
+        measurement.ChurnNanoseconds = GetNanosecondsSince(start) / static_cast<double>(churned);
+        measurement.Allocations += churned;
+
+        const glm::vec3 gravity(0.0f, -4.81f, 0.0f);
+        start = std::chrono::steady_clock::now();
+        for (uint32_t iteration = 0; iteration < IterationCount; ++iteration)
+        {
+            for (Engine::Rigidbody* rigidbody : rigidbodies)
+            {
+                rigidbody->ApplyGravity(gravity);
+            }
+        }
+        measurement.RigidbodyNanoseconds = GetNanosecondsSince(start) / (IterationCount * ObjectCount);
+
+        float bounds = 0.0f;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t iteration = 0; iteration < IterationCount; ++iteration)
+        {
+            for (const Engine::Collider* collider : colliders)
+            {
+                bounds += collider->GetBoundingBox().x;
+            }
+        }
+        measurement.ColliderNanoseconds = GetNanosecondsSince(start) / (IterationCount * ObjectCount);
+        BoundsSink = bounds;
+
+        for (size_t i = 0; i < ObjectCount; ++i)
+        {
+            Destroy(colliders[i], IsPooled);
+            Destroy(rigidbodies[i], IsPooled);
+        }
+        if (IsPooled)
+        {
+            /*served by the pools, only new chunks reach the general allocator*/
+            measurement.Allocations = GetPoolAllocations() - poolAllocations;
+        }
+        return measurement;
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures 10k colliders and rigidbodies allocated from their object pools and with global new, both
+     * between unrelated allocations the way entities are spawned. Logs allocation counts, time to destroy and
+     * create objects and time per component of the collider and rigidbody update loops.
+     */
+    class PoolBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override
+        {
+            ZoneScoped;
+            const PoolMeasurement pooled = Measure(true);
+            const PoolMeasurement global = Measure(false);
+            const Utility::ObjectPoolStatistics colliderPool =
+                Utility::TObjectPool<Engine::BoxCollider>::GetInstance("BoxCollider").GetStatistics();
+            const Utility::ObjectPoolStatistics rigidbodyPool =
+                Utility::TObjectPool<Engine::Rigidbody>::GetInstance("Rigidbody").GetStatistics();
+
+            spdlog::info("Component pools, {0} colliders and rigidbodies: {1} allocations served by pools of "
+                         "capacity {2} and {3}, {4} allocations with global new", ObjectCount, pooled.Allocations,
+                         colliderPool.Capacity, rigidbodyPool.Capacity, global.Allocations);
+            spdlog::info("Destroying and creating a rigidbody: pooled {0:.1f} ns, global new {1:.1f} ns",
+                         pooled.ChurnNanoseconds, global.ChurnNanoseconds);
+            spdlog::info("Rigidbody loop: pooled {0:.2f} ns, global new {1:.2f} ns per component; collider loop: "
+                         "pooled {2:.2f} ns, global new {3:.2f} ns per component", pooled.RigidbodyNanoseconds,
+                         global.RigidbodyNanoseconds, pooled.ColliderNanoseconds, global.ColliderNanoseconds);
+        }
+    };
+
+    BENCHMARK(PoolBenchmark, "pools", "", 0,
+              "compares allocation and update loops of pooled colliders and rigidbodies with ones from global new")
+} // Benchmarks
@@ -0,0 +1,144 @@
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/EngineObjects/SceneCommandBuffer.h"
+#include "Engine/Prefabs/PrefabLoader.h"
+#include "Serialization/ReferenceTable.h"
+#include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr uint32_t DefaultCount = 1000;
+
+    /**
+     * @brief Instantiates a prefab by deserializing every object from json, the way prefabs were loaded before
+     * templates. Used as the baseline of PrefabBenchmark.
+     */
+    Engine::Entity* InstantiateJson(const std::string& Path, Engine::Scene* const Scene)
+    {
+        rapidjson::Document document;
+        Serialization::ReadJsonFile(Path.c_str(), document);
+        if (!document.IsObject())
+        {
+            return nullptr;
+        }
+        const auto prefab = document.FindMember("Prefab");
+        if (prefab == document.MemberEnd() || !prefab->value.IsArray())
+        {
+            return nullptr;
+        }
+
+        const Serialization::TypeMask entityType
+                = Serialization::TypeMask(1) << Engine::Entity::GetStaticTypeId();
+        Serialization::ReferenceTable referenceTable;
+        std::vector<Serialization::SerializedObject*> objects;
+        Engine::Entity* root = nullptr;
+        for (const rapidjson::Value& json : prefab->value.GetArray())
+        {
+            Serialization::SerializedObject* object
+                    = Serialization::SerializedObjectFactory::CreateObject(json["type"].GetString());
+            object->DeserializeValuePass(json, referenceTable);
+            objects.push_back(object);
+            if (Serialization::TypeIdRegistry::GetMask(object) & entityType)
+            {
+                Engine::Entity* entity = static_cast<Engine::Entity*>(object);
+                entity->SetScene(Scene);
+                if (root == nullptr)
+                {
+                    root = entity;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            objects[i]->DeserializeReferencesPass(prefab->value[static_cast<rapidjson::SizeType>(i)],
+                                                  referenceTable);
+        }
+
+        for (Serialization::SerializedObject* object : objects)
+        {
+            object->ResetId();
+            if (Serialization::TypeIdRegistry::GetMask(object) & entityType)
+            {
+                static_cast<Engine::Entity*>(object)->GetTransform()->ResetId();
+            }
+        }
+
+        if (root != nullptr && root->GetTransform()->GetParent() == nullptr)
+        {
+            root->GetTransform()->SetParent(Scene->GetRoot()->GetTransform());
+        }
+
+        for (Serialization::SerializedObject* object : objects)
+        {
+            if (Engine::Component* component = dynamic_cast<Engine::Component*>(object))
+            {
+                component->Start();
+            }
+        }
+        return root;
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures instantiations per second of a prefab deserialized from json, as prefabs were loaded
+     * before templates, read to a new template every time and instantiated from the cached template, and logs them.
+     * Every instance is destroyed right after it's created.
+     */
+    class PrefabBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(PrefabBenchmark, "prefab", "<file.prefab> [count]", 1,
+              "measures instantiations per second of a prefab, 1000 instances by default")
+
+    void PrefabBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const std::string& path = Context.Arguments[0];
+        Engine::Scene* scene = Context.Scene;
+        const uint32_t count = Context.Arguments.size() > 1 ? static_cast<uint32_t>(std::stoul(Context.Arguments[1]))
+                                                            : DefaultCount;
+        const auto measure = [count](auto&& Instantiate)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (Engine::Entity* instance = Instantiate())
+                {
+                    instance->Destroy();
+                }
+                Engine::SceneCommandBuffer::GetInstance()->Apply();
+            }
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+            return duration.count() > 0.0 ? count / duration.count() : 0.0;
+        };
+
+        const double json = measure([&path, scene]()
+        {
+            return InstantiateJson(path, scene);
+        });
+        const double uncached = measure([&path, scene]()
+        {
+            return Engine::PrefabLoader::ReadTemplate(path)->Instantiate(scene, nullptr);
+        });
+        const Engine::PrefabTemplate& prefab = Engine::PrefabLoader::Preload(path);
+        const double cached = measure([&prefab, scene]()
+        {
+            return prefab.Instantiate(scene, nullptr);
+        });
+
+        spdlog::info("Prefab {0}: {1:.1f} instantiations/s deserializing json, {2:.1f} instantiations/s reading "
+                     "a template every time, {3:.1f} instantiations/s from the cached template.",
+                     path, json, uncached, cached);
+    }
+} // Benchmarks
@@ -0,0 +1,140 @@
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/Components/AI/NavArea.h"
+#include "Engine/Components/Renderers/ModelRenderer.h"
+#include "Engine/EngineObjects/ComponentRegistry.h"
+#include "Engine/EngineObjects/SceneCommandBuffer.h"
+#include "Engine/EngineObjects/Scene/Scene.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr uint32_t EntityCount = 10000;
+    constexpr uint32_t QueryCount = 100;
+    /*children per entity, gives a tree about as deep as scenes with nested prefabs*/
+    constexpr uint32_t Branching = 4;
+
+    /**
+     * @brief Runs a query repeatedly.
+     * @return Microseconds per query and number of entities found by the last one.
+     */
+    template<class TQuery>
+    std::pair<double, uint32_t> MeasureQuery(TQuery&& Query)
+    {
+        uint32_t found = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < QueryCount; ++i)
+        {
+            found = Query();
+        }
+        const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                                              start).count();
+        return {microseconds / QueryCount, found};
+    }
+
+    /**
+     * @brief Visits every entity below Root, the way systems found their components before the registry.
+     */
+    template<class TVisit>
+    void WalkTree(Engine::Entity* Root, TVisit&& Visit)
+    {
+        std::vector<Engine::Entity*> stack = {Root};
+        while (!stack.empty())
+        {
+            Engine::Entity* entity = stack.back();
+            stack.pop_back();
+            Visit(entity);
+            for (Engine::Transform* child : *entity->GetTransform())
+            {
+                stack.push_back(child->GetOwner());
+            }
+        }
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Adds 10k entities to the scene, every tenth with a NavArea and every twentieth also with
+     * a ModelRenderer, and measures finding them with ComponentRegistry::ForEach and by walking the scene tree
+     * with GetComponent. The entities are destroyed afterwards.
+     */
+    class QueryBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(QueryBenchmark, "queries", "", 0,
+              "compares component queries on 10k added entities with walking the scene tree")
+
+    void QueryBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        Engine::Scene* scene = Context.Scene;
+        Engine::Entity* group = scene->SpawnEntity(nullptr);
+        std::vector<Engine::Entity*> entities;
+        entities.reserve(EntityCount);
+        for (uint32_t i = 0; i < EntityCount; ++i)
+        {
+            Engine::Entity* entity = scene->SpawnEntity(i == 0 ? group : entities[(i - 1) / Branching]);
+            if (i % 10 == 0)
+            {
+                entity->AddComponent<Engine::NavArea>();
+            }
+            if (i % 20 == 0)
+            {
+                entity->AddComponent<Engine::ModelRenderer>();
+            }
+            entities.push_back(entity);
+        }
+
+        const auto [registryTime, registryFound] = MeasureQuery([]
+        {
+            uint32_t found = 0;
+            Engine::ComponentRegistry::ForEach<Engine::NavArea>([&found](Engine::Entity*, Engine::NavArea*)
+            {
+                ++found;
+            });
+            return found;
+        });
+        const auto [walkTime, walkFound] = MeasureQuery([scene]
+        {
+            uint32_t found = 0;
+            WalkTree(scene->GetRoot(), [&found](const Engine::Entity* Entity)
+            {
+                found += Entity->GetComponent<Engine::NavArea>() != nullptr;
+            });
+            return found;
+        });
+        const auto [pairRegistryTime, pairRegistryFound] = MeasureQuery([]
+        {
+            uint32_t found = 0;
+            Engine::ComponentRegistry::ForEach<Engine::NavArea, Engine::ModelRenderer>(
+                [&found](Engine::Entity*, Engine::NavArea*, Engine::ModelRenderer*) { ++found; });
+            return found;
+        });
+        const auto [pairWalkTime, pairWalkFound] = MeasureQuery([scene]
+        {
+            uint32_t found = 0;
+            WalkTree(scene->GetRoot(), [&found](const Engine::Entity* Entity)
+            {
+                found += Entity->GetComponent<Engine::NavArea>() != nullptr &&
+                         Entity->GetComponent<Engine::ModelRenderer>() != nullptr;
+            });
+            return found;
+        });
+
+        spdlog::info("Component queries with {0} added entities: NavArea {1:.1f} us with ForEach, {2:.1f} us walking "
+                     "the tree, {3} and {4} found", EntityCount, registryTime, walkTime, registryFound, walkFound);
+        spdlog::info("NavArea and ModelRenderer {0:.1f} us with ForEach, {1:.1f} us walking the tree, {2} and {3} "
+                     "found", pairRegistryTime, pairWalkTime, pairRegistryFound, pairWalkFound);
+
+        group->Destroy();
+        Engine::SceneCommandBuffer::GetInstance()->Apply();
+    }
+} // Benchmarks
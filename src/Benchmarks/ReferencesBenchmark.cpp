@@ -0,0 +1,112 @@
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Serialization/SerializationUtility.h"
+#include "Serialization/SerializedObject.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /**
+     * @brief Object without any data, only its id is serialized.
+     */
+    class BenchmarkObject final : public Serialization::SerializedObject
+    {
+    public:
+        rapidjson::Value Serialize(rapidjson::Document::AllocatorType& Allocator) const override
+        {
+            rapidjson::Value object(rapidjson::kObjectType);
+            object.AddMember("id", Serialization::Serialize(GetID(), Allocator), Allocator);
+            return object;
+        }
+
+        void DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap) override
+        {
+            Utility::Guid id;
+            Serialization::Deserialize(Object, "id", id);
+            SetId(id);
+            ReferenceMap.Add(id, this);
+        }
+
+        void DeserializeReferencesPass(const rapidjson::Value& Object,
+                                       Serialization::ReferenceTable& ReferenceMap) override
+        {
+        }
+
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "BenchmarkObject";
+        }
+    };
+
+    double GetMilliseconds(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures generating ids, writing them to json and resolving them through ReferenceTable, logs results.
+     */
+    class ReferencesBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(ReferencesBenchmark, "references", "<count>", 1,
+              "measures generating, writing and resolving ids of count objects")
+
+    void ReferencesBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const uint32_t count = static_cast<uint32_t>(std::stoul(Context.Arguments[0]));
+        std::vector<BenchmarkObject> sources(count);
+        std::vector<BenchmarkObject> targets(count);
+
+        auto start = std::chrono::steady_clock::now();
+        for (const BenchmarkObject& source : sources)
+        {
+            (void)source.GetID();
+        }
+        const double generation = GetMilliseconds(start);
+
+        rapidjson::Document document;
+        document.SetArray();
+        document.Reserve(count, document.GetAllocator());
+        start = std::chrono::steady_clock::now();
+        for (const BenchmarkObject& source : sources)
+        {
+            document.PushBack(source.Serialize(document.GetAllocator()), document.GetAllocator());
+        }
+        const double serialization = GetMilliseconds(start);
+
+        Serialization::ReferenceTable referenceTable;
+        start = std::chrono::steady_clock::now();
+        referenceTable.Reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            targets[i].DeserializeValuePass(document[i], referenceTable);
+        }
+        const double valuePass = GetMilliseconds(start);
+
+        uint32_t resolved = 0;
+        start = std::chrono::steady_clock::now();
+        for (const rapidjson::Value& object : document.GetArray())
+        {
+            Serialization::SerializedObject* reference;
+            Serialization::Deserialize(object, "id", reference, referenceTable);
+            resolved += reference != nullptr;
+        }
+        const double referencesPass = GetMilliseconds(start);
+
+        spdlog::info("References of {0} objects: ids generated in {1:.3f} ms, serialized in {2:.3f} ms, "
+                     "registered in {3:.3f} ms, {4} resolved in {5:.3f} ms.",
+                     count, generation, serialization, valuePass, resolved, referencesPass);
+    }
+} // Benchmarks
@@ -0,0 +1,250 @@
+#include <chrono>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Serialization/Reflection.h"
+#include "Serialization/SerializationUtility.h"
+#include "Serialization/SerializedObject.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    enum BenchmarkMode
+    {
+        Idle,
+        Moving,
+        Rotating
+    };
+
+    /**
+     * @brief Object with fields of every reflected type, roughly the size of a component.
+     */
+    class BenchmarkObject final : public Serialization::SerializedObject
+    {
+    public:
+        glm::vec3 Position = glm::vec3(0.0f);
+        glm::vec3 EulerAngles = glm::vec3(0.0f);
+        glm::vec3 Scale = glm::vec3(1.0f);
+        glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        glm::vec4 Color = glm::vec4(1.0f);
+        glm::vec2 Size = glm::vec2(1.0f);
+        float Speed = 0.0f;
+        float Range = 10.0f;
+        int Count = 0;
+        bool Enabled = true;
+        BenchmarkMode Mode = Idle;
+        std::string Name;
+
+    public:
+        rapidjson::Value Serialize(rapidjson::Document::AllocatorType& Allocator) const override
+        {
+            rapidjson::Value object(rapidjson::kObjectType);
+            Serialization::WriteFields(this, GetStaticReflection(), object, Allocator);
+            return object;
+        }
+
+        void DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap) override
+        {
+            Serialization::ReadFields(Object, this, GetStaticReflection());
+        }
+
+        void DeserializeReferencesPass(const rapidjson::Value& Object,
+                                       Serialization::ReferenceTable& ReferenceMap) override
+        {
+        }
+
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "BenchmarkObject";
+        }
+
+        rapidjson::Value SerializeWithMacros(rapidjson::Document::AllocatorType& Allocator) const
+        {
+            rapidjson::Value object(rapidjson::kObjectType);
+            SERIALIZE_FIELD(Position)
+            SERIALIZE_FIELD(EulerAngles)
+            SERIALIZE_FIELD(Scale)
+            SERIALIZE_FIELD(Rotation)
+            SERIALIZE_FIELD(Color)
+            SERIALIZE_FIELD(Size)
+            SERIALIZE_FIELD(Speed)
+            SERIALIZE_FIELD(Range)
+            SERIALIZE_FIELD(Count)
+            SERIALIZE_FIELD(Enabled)
+            SERIALIZE_FIELD(Mode)
+            SERIALIZE_FIELD(Name)
+            return object;
+        }
+
+        void DeserializeWithMacros(const rapidjson::Value& Object)
+        {
+            DESERIALIZE_VALUE(Position)
+            DESERIALIZE_VALUE(EulerAngles)
+            DESERIALIZE_VALUE(Scale)
+            DESERIALIZE_VALUE(Rotation)
+            DESERIALIZE_VALUE(Color)
+            DESERIALIZE_VALUE(Size)
+            DESERIALIZE_VALUE(Speed)
+            DESERIALIZE_VALUE(Range)
+            DESERIALIZE_VALUE(Count)
+            DESERIALIZE_VALUE(Enabled)
+            DESERIALIZE_VALUE(Mode)
+            DESERIALIZE_VALUE(Name)
+        }
+
+        SERIALIZATION_EXPORT_FIELDS(BenchmarkObject)
+    };
+
+    SERIALIZATION_REFLECTION(BenchmarkObject,
+                             SERIALIZATION_FIELD(Position),
+                             SERIALIZATION_FIELD(EulerAngles),
+                             SERIALIZATION_FIELD(Scale),
+                             SERIALIZATION_FIELD(Rotation),
+                             SERIALIZATION_FIELD(Color),
+                             SERIALIZATION_FIELD(Size),
+                             SERIALIZATION_FIELD(Speed),
+                             SERIALIZATION_FIELD(Range),
+                             SERIALIZATION_FIELD(Count),
+                             SERIALIZATION_FIELD(Enabled),
+                             SERIALIZATION_FIELD(Mode),
+                             SERIALIZATION_FIELD(Name))
+
+    double GetNanosecondsPerObject(const std::chrono::steady_clock::time_point Start, const uint32_t Count)
+    {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / Count;
+    }
+
+    /**
+     * @brief Counts targets with fields different from their sources.
+     */
+    uint32_t CountMismatches(const std::vector<BenchmarkObject>& Sources, const std::vector<BenchmarkObject>& Targets)
+    {
+        uint32_t mismatches = 0;
+        for (size_t i = 0; i < Sources.size(); ++i)
+        {
+            mismatches += Serialization::DiffFields(&Sources[i], &Targets[i],
+                                                    BenchmarkObject::GetStaticReflection()) != 0;
+        }
+        return mismatches;
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures writing and reading objects with per-field macros, reflected json and reflected binary,
+     * logs time per object.
+     */
+    class ReflectionBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(ReflectionBenchmark, "reflection", "<count>", 1,
+              "compares per-object cost of macro, reflected and binary serialization of count objects")
+
+    void ReflectionBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        const uint32_t count = static_cast<uint32_t>(std::stoul(Context.Arguments[0]));
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::vector<BenchmarkObject> sources(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto value = static_cast<float>(i);
+            BenchmarkObject& source = sources[i];
+            source.Position = glm::vec3(value, value * 0.5f, -value);
+            source.EulerAngles = glm::vec3(0.0f, value, 0.0f);
+            source.Scale = glm::vec3(1.0f + value * 0.01f);
+            source.Rotation = glm::quat(0.5f, 0.5f, 0.5f, 0.5f);
+            source.Color = glm::vec4(value / count, 0.25f, 0.5f, 1.0f);
+            source.Size = glm::vec2(value, 2.0f);
+            source.Speed = value * 0.1f;
+            source.Count = static_cast<int>(i);
+            source.Enabled = i % 2 == 0;
+            source.Mode = static_cast<BenchmarkMode>(i % 3);
+            source.Name = "Object" + std::to_string(i);
+        }
+        const Serialization::ClassReflection& reflection = BenchmarkObject::GetStaticReflection();
+
+        rapidjson::Document macroDocument(rapidjson::kArrayType);
+        macroDocument.Reserve(count, macroDocument.GetAllocator());
+        auto start = std::chrono::steady_clock::now();
+        for (const BenchmarkObject& source : sources)
+        {
+            macroDocument.PushBack(source.SerializeWithMacros(macroDocument.GetAllocator()),
+                                   macroDocument.GetAllocator());
+        }
+        const double macroWrite = GetNanosecondsPerObject(start, count);
+
+        rapidjson::Document document(rapidjson::kArrayType);
+        document.Reserve(count, document.GetAllocator());
+        start = std::chrono::steady_clock::now();
+        for (const BenchmarkObject& source : sources)
+        {
+            document.PushBack(source.Serialize(document.GetAllocator()), document.GetAllocator());
+        }
+        const double reflectedWrite = GetNanosecondsPerObject(start, count);
+
+        std::vector<uint8_t> buffer;
+        start = std::chrono::steady_clock::now();
+        for (const BenchmarkObject& source : sources)
+        {
+            Serialization::WriteBinary(&source, reflection, buffer);
+        }
+        const double binaryWrite = GetNanosecondsPerObject(start, count);
+
+        std::vector<BenchmarkObject> targets(count);
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            targets[i].DeserializeWithMacros(macroDocument[i]);
+        }
+        const double macroRead = GetNanosecondsPerObject(start, count);
+        const uint32_t macroMismatches = CountMismatches(sources, targets);
+
+        targets = std::vector<BenchmarkObject>(count);
+        Serialization::ReferenceTable referenceTable;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            targets[i].DeserializeValuePass(document[i], referenceTable);
+        }
+        const double reflectedRead = GetNanosecondsPerObject(start, count);
+        const uint32_t reflectedMismatches = CountMismatches(sources, targets);
+
+        targets = std::vector<BenchmarkObject>(count);
+        std::span<const uint8_t> remaining(buffer);
+        start = std::chrono::steady_clock::now();
+        for (BenchmarkObject& target : targets)
+        {
+            Serialization::ReadBinary(remaining, &target, reflection);
+        }
+        const double binaryRead = GetNanosecondsPerObject(start, count);
+        const uint32_t binaryMismatches = CountMismatches(sources, targets);
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Serialization::CopyFields(&sources[i], &targets[i], reflection);
+        }
+        const double copy = GetNanosecondsPerObject(start, count);
+
+        spdlog::info("Reflection of {0} objects with {1} fields, per object:", count, reflection.GetFields().size());
+        spdlog::info("macros       write {0:8.1f} ns, read {1:8.1f} ns, {2} mismatches", macroWrite, macroRead,
+                     macroMismatches);
+        spdlog::info("reflected    write {0:8.1f} ns, read {1:8.1f} ns, {2} mismatches", reflectedWrite,
+                     reflectedRead, reflectedMismatches);
+        spdlog::info("binary       write {0:8.1f} ns, read {1:8.1f} ns, {2} mismatches, {3} bytes", binaryWrite,
+                     binaryRead, binaryMismatches, buffer.size() / count);
+        spdlog::info("copy         {0:8.1f} ns", copy);
+    }
+} // Benchmarks
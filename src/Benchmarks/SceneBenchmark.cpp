@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/EngineObjects/Entity.h"
+#include "Engine/EngineObjects/JobSystem.h"
+#include "Engine/EngineObjects/Scene/Scene.h"
+#include "Engine/EngineObjects/Scene/SceneAutosave.h"
+#include "Engine/EngineObjects/Scene/SceneManager.h"
+#include "Engine/EngineObjects/Scene/SceneSnapshot.h"
+#include "Serialization/CookedFilesUtility.h"
+#include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    uintmax_t GetFileSize(const std::string& Path)
+    {
+        std::error_code error;
+        const uintmax_t size = std::filesystem::file_size(Path, error);
+        return error ? 0 : size;
+    }
+
+    template<class TFunction>
+    float MeasureMilliseconds(TFunction&& Function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        Function();
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Saves the scene with the old document based writer, compact and pretty streaming writers
+     * and the autosave with and without modified entities, then logs times and file sizes.
+     * Files are written next to the scene file and removed afterwards.
+     */
+    class SceneSaveBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Deserializes the scene file repeatedly with 1, 2, 4 and 8 threads and logs the times.
+     * Afterwards compares whole loads of the json file with loads of its cooked version.
+     * The scene contains the scene file afterwards.
+     */
+    class SceneLoadBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Measures capturing and restoring snapshots of the scene simulated since the baseline was captured
+     * on load, logs results. Leaves the scene in its simulated state.
+     */
+    class SnapshotBenchmark final : public IBenchmark
+    {
+    private:
+        std::shared_ptr<const Engine::SceneSnapshot> Baseline;
+        /*state checksum of the scene when Baseline was captured*/
+        uint64_t BaselineChecksum = 0;
+
+    public:
+        void OnSceneLoaded(const BenchmarkContext& Context) override
+        {
+            Baseline = std::make_shared<const Engine::SceneSnapshot>(Engine::SceneSnapshot::Capture(Context.Scene));
+            BaselineChecksum = Context.Scene->CalculateStateChecksum();
+        }
+
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(SceneSaveBenchmark, "save", "", 0, "measures save time and file size of the scene")
+    BENCHMARK(SceneLoadBenchmark, "load", "", 0,
+              "measures deserialization of the scene from json and cooked files")
+    BENCHMARK(SnapshotBenchmark, "snapshot", "", 0, "measures capturing, rewinding and restoring scene snapshots")
+
+    void SceneSaveBenchmark::Run(const BenchmarkContext& Context)
+    {
+        const std::string& path = Context.ScenePath;
+        Engine::Scene* scene = Context.Scene;
+        const auto measure = [](const char* Name, const std::string& File, auto&& Save)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            Save();
+            const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - start;
+            spdlog::info("{0:<28} {1:8.2f} ms, {2:10} bytes", Name, time.count(), GetFileSize(File));
+            std::filesystem::remove(File);
+        };
+
+        const std::string documentPath = path + ".document";
+        measure("Document, pretty", documentPath, [&documentPath, scene]
+        {
+            rapidjson::MemoryPoolAllocator<> allocator;
+            const rapidjson::Value json = scene->Serialize(allocator);
+            Serialization::WriteJsonFile(documentPath.c_str(), json);
+        });
+        const std::string streamedPath = path + ".streamed";
+        measure("Streamed, pretty", streamedPath, [&streamedPath, scene]
+        {
+            Engine::SceneManager::SaveScene(streamedPath, scene, true);
+        });
+        measure("Streamed, compact", streamedPath, [&streamedPath, scene]
+        {
+            Engine::SceneManager::SaveScene(streamedPath, scene);
+        });
+
+        /*every entity is modified after loading, so the first autosave serializes all of them*/
+        const std::string autosavePath = path + ".benchmark.autosave";
+        Engine::SceneAutosave autosave(autosavePath);
+        for (const char* name : {"Autosave, all modified", "Autosave, one modified"})
+        {
+            const auto start = std::chrono::steady_clock::now();
+            autosave.Save(scene);
+            const auto serialized = std::chrono::steady_clock::now();
+            autosave.Wait();
+            const std::chrono::duration<float, std::milli> serializeTime = serialized - start;
+            const std::chrono::duration<float, std::milli> writeTime = std::chrono::steady_clock::now() - serialized;
+            spdlog::info("{0:<28} {1:8.2f} ms on the main thread, {2:.2f} ms writing, {3} entities serialized", name,
+                         serializeTime.count(), writeTime.count(), autosave.GetLastSerializedCount());
+            scene->GetRoot()->MarkModified();
+        }
+        spdlog::info("Autosave file: {0} bytes.", GetFileSize(autosavePath));
+        std::filesystem::remove(autosavePath);
+    }
+
+    void SceneLoadBenchmark::Run(const BenchmarkContext& Context)
+    {
+        const std::string& path = Context.ScenePath;
+        Engine::Scene* scene = Context.Scene;
+        rapidjson::Document data;
+        Serialization::ReadJsonFile(path.c_str(), data);
+        const Engine::JobSystem* jobSystem = Engine::JobSystem::GetInstance();
+        const uint32_t availableThreads = jobSystem != nullptr ? jobSystem->GetThreadCount() : 1;
+
+        float singleThreadTime = 0.0f;
+        for (const uint32_t threads : {1u, 2u, 4u, 8u})
+        {
+            Engine::Scene::SetDeserializationThreads(threads);
+            const auto start = std::chrono::steady_clock::now();
+            scene->Deserialize(data);
+            const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - start;
+            if (threads == 1)
+            {
+                singleThreadTime = time.count();
+            }
+            spdlog::info("Deserialized scene {0} on {1} threads in {2:.2f} ms ({3:.2f}x).", path,
+                         std::min(threads, availableThreads), time.count(),
+                         time.count() > 0.0f ? singleThreadTime / time.count() : 0.0f);
+        }
+        Engine::Scene::SetDeserializationThreads(0);
+
+        /*whole loads from disk, including reading and parsing, the cooked file is written next to the scene*/
+        constexpr int repeats = 5;
+        const std::string cookedPath = path + ".benchmark.cooked";
+        if (!Serialization::CookJsonFile(path.c_str(), cookedPath.c_str()))
+        {
+            spdlog::warn("Scene {0} can't be cooked, only json loads were measured.", path);
+            scene->Deserialize(data);
+            scene->SetPath(path);
+            return;
+        }
+        const auto measure = [](auto&& Load)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < repeats; ++i)
+            {
+                Load();
+            }
+            const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - start;
+            return time.count() / repeats;
+        };
+        const float jsonTime = measure([&path, scene]
+        {
+            rapidjson::Document document;
+            Serialization::ReadJsonFile(path.c_str(), document);
+            scene->Deserialize(document);
+        });
+        const float cookedTime = measure([&cookedPath, scene]
+        {
+            Serialization::CookedFile cooked;
+            if (cooked.Read(cookedPath.c_str()))
+            {
+                scene->DeserializeCooked(cooked);
+            }
+        });
+        spdlog::info("Loaded scene {0} in {1:.2f} ms from json, {2:.2f} ms from a cooked file ({3:.2f}x), "
+                     "average of {4} loads.", path, jsonTime, cookedTime,
+                     cookedTime > 0.0f ? jsonTime / cookedTime : 0.0f, repeats);
+        std::filesystem::remove(cookedPath);
+        scene->SetPath(path);
+    }
+
+    void SnapshotBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        Engine::Scene* scene = Context.Scene;
+        const uint64_t simulatedChecksum = scene->CalculateStateChecksum();
+        const auto log = [](const char* Name, const float Milliseconds, const Engine::SceneSnapshot& Snapshot)
+        {
+            spdlog::info("{0:<28} {1:8.3f} ms, {2:10} bytes, {3} objects", Name, Milliseconds, Snapshot.GetSize(),
+                         Snapshot.GetObjectCount());
+        };
+
+        Engine::SceneSnapshot full;
+        log("Capture full", MeasureMilliseconds([&full, scene]
+        {
+            full = Engine::SceneSnapshot::Capture(scene);
+        }), full);
+        Engine::SceneSnapshot delta;
+        log("Capture delta", MeasureMilliseconds([&delta, scene, this]
+        {
+            delta = Engine::SceneSnapshot::CaptureDelta(scene, Baseline);
+        }), delta);
+
+        size_t restored = 0;
+        float time = MeasureMilliseconds([&restored, &full, scene] { restored = full.Restore(scene); });
+        spdlog::info("{0:<28} {1:8.3f} ms, {2} objects restored", "Restore unchanged", time, restored);
+
+        time = MeasureMilliseconds([&restored, this, scene] { restored = Baseline->Restore(scene); });
+        spdlog::info("{0:<28} {1:8.3f} ms, {2} objects restored, checksum {3}", "Rewind to baseline", time, restored,
+                     scene->CalculateStateChecksum() == BaselineChecksum ? "matches" : "differs");
+
+        time = MeasureMilliseconds([&restored, &delta, scene] { restored = delta.Restore(scene); });
+        spdlog::info("{0:<28} {1:8.3f} ms, {2} objects restored, checksum {3}", "Restore delta", time, restored,
+                     scene->CalculateStateChecksum() == simulatedChecksum ? "matches" : "differs");
+    }
+} // Benchmarks
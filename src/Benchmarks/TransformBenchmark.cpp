@@ -0,0 +1,262 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BenchmarkRegistry.h"
+#include "Engine/Components/Transform.h"
+#include "Engine/EngineObjects/TransformHierarchy.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr std::array<uint32_t, 2> NodeCounts = {10000, 100000};
+    constexpr std::array<uint32_t, 3> ModifiedPercentages = {1, 10, 100};
+    constexpr uint32_t FrameCount = 20;
+    /*children per node, gives hierarchies about as deep as scenes with nested prefabs*/
+    constexpr uint32_t Branching = 4;
+    constexpr uint32_t AccessEntityCount = 10000;
+    constexpr uint32_t AccessFrameCount = 100;
+    /*points converted per entity, about as many as a collider or a path has*/
+    constexpr uint32_t ConvertedPointCount = 16;
+    constexpr float TimeStep = 1.0f / 60.0f;
+
+    struct FrameTimes
+    {
+        double Total = 0.0;
+        /*time spent by the hierarchy's linear pass*/
+        double Update = 0.0;
+    };
+
+    double GetMillisecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+
+    /**
+     * @brief Creates transforms with every node parented to an earlier one, so parents are destroyed last.
+     */
+    std::vector<std::unique_ptr<Engine::Transform>> CreateTransforms(const uint32_t Count,
+                                                                     Engine::TransformHierarchy* Hierarchy)
+    {
+        std::vector<std::unique_ptr<Engine::Transform>> transforms;
+        transforms.reserve(Count);
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            transforms.push_back(std::make_unique<Engine::Transform>());
+            Engine::Transform* transform = transforms.back().get();
+            transform->SetPositionLocalSpace(glm::vec3(1.0f, static_cast<float>(i % 7), 0.5f));
+            if (i == 0)
+            {
+                transform->SetHierarchy(Hierarchy);
+            }
+            else
+            {
+                transform->SetParent(transforms[(i - 1) / Branching].get());
+            }
+        }
+        return transforms;
+    }
+
+    void DestroyTransforms(std::vector<std::unique_ptr<Engine::Transform>>& Transforms)
+    {
+        while (!Transforms.empty())
+        {
+            Transforms.pop_back();
+        }
+    }
+
+    /**
+     * @brief Modifies every n-th transform and reads world matrices of all of them, like rendering would.
+     * @return Sum of world positions, to compare both ways of updating and keep reads from being optimized away.
+     */
+    glm::vec3 SimulateFrame(const std::vector<std::unique_ptr<Engine::Transform>>& Transforms, const uint32_t Frame,
+                            const uint32_t Stride, Engine::TransformHierarchy* Hierarchy, FrameTimes& Times)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const glm::quat rotation = glm::angleAxis(0.01f * static_cast<float>(Frame), glm::vec3(0.0f, 1.0f, 0.0f));
+        for (size_t i = 0; i < Transforms.size(); i += Stride)
+        {
+            Transforms[i]->SetRotation(rotation);
+        }
+
+        if (Hierarchy != nullptr)
+        {
+            const auto updateStart = std::chrono::steady_clock::now();
+            Hierarchy->UpdateWorldMatrices();
+            Times.Update += GetMillisecondsSince(updateStart);
+        }
+
+        glm::vec3 sum(0.0f);
+        for (const std::unique_ptr<Engine::Transform>& transform : Transforms)
+        {
+            sum += glm::vec3(transform->GetLocalToWorldMatrix()[3]);
+        }
+        Times.Total += GetMillisecondsSince(start);
+        return sum;
+    }
+
+    /**
+     * @brief Runs a step on every transform for a number of frames, the parent is moved every frame.
+     * @return Nanoseconds per transform and step.
+     */
+    template<class TStep>
+    double MeasureAccess(Engine::Transform& Parent, const std::vector<std::unique_ptr<Engine::Transform>>& Children,
+                         Engine::TransformHierarchy& Hierarchy, TStep&& Step)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; frame < AccessFrameCount; ++frame)
+        {
+            Parent.SetPositionLocalSpace(glm::vec3(static_cast<float>(frame) * 0.01f, 0.0f, 0.0f));
+            for (const std::unique_ptr<Engine::Transform>& child : Children)
+            {
+                Step(*child);
+            }
+            Hierarchy.UpdateWorldMatrices();
+        }
+        return GetMillisecondsSince(start) * 1000000.0 / (static_cast<double>(AccessFrameCount) * Children.size());
+    }
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief Measures updating world matrices of 10k and 100k transforms with 1%, 10% and 100% of them modified
+     * per frame, once stored in a TransformHierarchy and once updated recursively, logs time per frame.
+     */
+    class TransformHierarchyBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    /**
+     * @brief Measures transform access of physics integration and AI movement on 10k children of a moved parent,
+     * compares the cached world to local matrix with a general inverse and batched with single conversions,
+     * logs time per entity.
+     */
+    class TransformAccessBenchmark final : public IBenchmark
+    {
+    public:
+        void Run(const BenchmarkContext& Context) override;
+    };
+
+    BENCHMARK(TransformHierarchyBenchmark, "hierarchy", "", 0,
+              "compares updating 10k and 100k transforms stored contiguously and recursively with 1%, 10% and 100% "
+              "of them modified per frame")
+    BENCHMARK(TransformAccessBenchmark, "transform-access", "", 0,
+              "measures transform access of physics integration and AI movement")
+
+    void TransformHierarchyBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        for (const uint32_t count : NodeCounts)
+        {
+            for (const uint32_t percentage : ModifiedPercentages)
+            {
+                const uint32_t stride = 100 / percentage;
+
+                std::vector<std::unique_ptr<Engine::Transform>> recursive = CreateTransforms(count, nullptr);
+                FrameTimes recursiveTimes;
+                glm::vec3 recursiveSum(0.0f);
+                for (uint32_t frame = 0; frame < FrameCount; ++frame)
+                {
+                    recursiveSum = SimulateFrame(recursive, frame, stride, nullptr, recursiveTimes);
+                }
+                DestroyTransforms(recursive);
+
+                Engine::TransformHierarchy hierarchy;
+                std::vector<std::unique_ptr<Engine::Transform>> stored = CreateTransforms(count, &hierarchy);
+                /*the first update orders the new nodes by depth, it isn't a part of a regular frame*/
+                hierarchy.UpdateWorldMatrices();
+                FrameTimes storedTimes;
+                glm::vec3 storedSum(0.0f);
+                for (uint32_t frame = 0; frame < FrameCount; ++frame)
+                {
+                    storedSum = SimulateFrame(stored, frame, stride, &hierarchy, storedTimes);
+                }
+                DestroyTransforms(stored);
+
+                const float difference = glm::length(recursiveSum - storedSum) / static_cast<float>(count);
+                spdlog::info("Transforms {0:>6} nodes, {1:>3}% modified: recursive {2:8.3f} ms, hierarchy {3:8.3f} ms "
+                             "(linear pass {4:8.3f} ms) per frame, average difference {5}", count, percentage,
+                             recursiveTimes.Total / FrameCount, storedTimes.Total / FrameCount,
+                             storedTimes.Update / FrameCount, difference);
+            }
+        }
+    }
+
+    void TransformAccessBenchmark::Run(const BenchmarkContext& Context)
+    {
+        ZoneScoped;
+        Engine::TransformHierarchy hierarchy;
+        Engine::Transform root;
+        root.SetHierarchy(&hierarchy);
+        Engine::Transform parent;
+        parent.SetParent(&root);
+        parent.SetRotation(glm::angleAxis(0.5f, glm::vec3(0.0f, 1.0f, 0.0f)));
+        parent.SetScale(glm::vec3(2.0f));
+
+        std::vector<std::unique_ptr<Engine::Transform>> children;
+        children.reserve(AccessEntityCount);
+        for (uint32_t i = 0; i < AccessEntityCount; ++i)
+        {
+            children.push_back(std::make_unique<Engine::Transform>());
+            children.back()->SetParent(&parent);
+            children.back()->SetPositionLocalSpace(glm::vec3(static_cast<float>(i % 100), 0.0f, 0.0f));
+        }
+        hierarchy.UpdateWorldMatrices();
+
+        const glm::vec3 velocity(0.1f, 0.0f, 0.05f);
+        const glm::quat spin = glm::angleAxis(0.01f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+        /*reads and writes of Rigidbody::Update*/
+        const double integrate = MeasureAccess(parent, children, hierarchy, [&velocity, &spin](Engine::Transform& Child)
+        {
+            const glm::vec3 position = Child.GetPosition();
+            Child.SetPosition(position + velocity * TimeStep);
+            Child.SetRotation(spin * Child.GetRotation());
+        });
+
+        /*same, with the world position converted by a general inverse of the parent's matrix*/
+        const double integrateInverse = MeasureAccess(parent, children, hierarchy,
+                                                      [&velocity, &spin, &parent](Engine::Transform& Child)
+        {
+            const glm::vec3 position = Child.GetPosition() + velocity * TimeStep;
+            const glm::mat4 worldToParent = glm::inverse(parent.GetLocalToWorldMatrix());
+            Child.SetPositionLocalSpace(glm::vec3(worldToParent * glm::vec4(position, 1.0f)));
+            Child.SetRotation(spin * Child.GetRotation());
+        });
+
+        /*reads and writes of AStar::UpdateMovement, which turns through euler angles*/
+        const double movement = MeasureAccess(parent, children, hierarchy, [](Engine::Transform& Child)
+        {
+            glm::vec3 rotation = Child.GetEulerAngles();
+            rotation.y += 1.0f;
+            Child.SetEulerAngles(rotation);
+            Child.SetPosition(Child.GetPosition() + Child.GetForward() * TimeStep);
+        });
+
+        std::array<glm::vec3, ConvertedPointCount> points;
+        points.fill(glm::vec3(1.0f, 2.0f, 3.0f));
+        const double single = MeasureAccess(parent, children, hierarchy, [&points](Engine::Transform& Child)
+        {
+            for (glm::vec3& point : points)
+            {
+                point = Child.TransformPositionWorldToLocal(point);
+            }
+        });
+        const double batched = MeasureAccess(parent, children, hierarchy, [&points](Engine::Transform& Child)
+        {
+            Child.TransformPositionsWorldToLocal(points, points);
+        });
+
+        children.clear();
+        spdlog::info("Transform access of {0} entities: integration {1:.1f} ns, with general inverse {2:.1f} ns, "
+                     "AI movement {3:.1f} ns per entity", AccessEntityCount, integrate, integrateInverse, movement);
+        spdlog::info("Converting {0} points to local space: single {1:.1f} ns, batched {2:.1f} ns per entity",
+                     ConvertedPointCount, single, batched);
+    }
+} // Benchmarks
@@ -8,6 +8,7 @@
 #include "Models/Model.h"
 #include "Serialization/SerializationUtility.h"
 #include "spdlog/spdlog.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 namespace Engine
 {
@@ -22,6 +23,7 @@ namespace Engine
     void AStar::FindPath(int StartId, int GoalId)
     {
         ZoneScoped;
+        TELEMETRY_COUNT(PathsSolved, 1);
         if (!NavGraph)
         {
             Path.clear();
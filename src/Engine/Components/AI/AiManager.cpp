@@ -5,8 +5,10 @@
 #include "LeafNodes.h"
 #include "NavMesh.h"
 #include "Engine/Components/Game/Thrash.h"
+#include "Engine/EngineObjects/ComponentRegistry.h"
 #include "Engine/EngineObjects/UpdateManager.h"
 #include "Engine/EngineObjects/Player/DefaultPlayer.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "spdlog/spdlog.h"
 
@@ -14,7 +16,7 @@ namespace Engine
 {
     AiManager::AiManager()
     {
-        UpdateManager::GetInstance()->RegisterComponent(this);
+        UpdateManager::GetInstance()->RegisterComponent(this, UpdatePhase::Ai);
         InitializeBehaviorTree();
     }
 
@@ -26,6 +28,7 @@ namespace Engine
 
     void AiManager::Start()
     {
+        ZoneScoped;
         AStarComponent = new AStar();
         AStarComponent->SetGraph(NavMesh::Get().GetGraph());
         NavMesh::Get().BakeNavMesh(GetOwner()->GetScene()->GetRoot());
@@ -33,23 +36,25 @@ namespace Engine
         if (dynamic_cast<Engine::DefaultPlayer*>(GetOwner()->GetScene()->GetPlayer()))
             Player = GetOwner()->GetScene()->GetPlayer();
 
-        for (auto& transform : GetOwner()->GetScene()->GetRoot()->GetTransform()->GetChildren())
+        const Transform* root = GetOwner()->GetScene()->GetRoot()->GetTransform();
+        ComponentRegistry::ForEach<Thrash>([this, root](Entity* const Owner, Thrash*)
         {
-            if (transform->GetOwner()->GetComponent<Thrash>())
+            if (Owner->GetTransform()->GetParent() == root)
             {
-                TrashEntities.emplace_back(transform->GetOwner());
+                TrashEntities.emplace_back(Owner);
             }
-        }
+        });
     }
 
     void AiManager::InitPlayer()
     {
-        auto root = GetOwner()->GetScene()->GetRoot();
-        for (auto& child : root->GetTransform()->GetChildren())
+        const Scene* scene = GetOwner()->GetScene();
+        const Transform* root = scene->GetRoot()->GetTransform();
+        for (Entity* entity : scene->FindEntitiesByName(NameTable::Intern(SelectedPlayerName)))
         {
-            if (child->GetOwner()->GetName() == SelectedPlayerName)
+            if (entity->GetTransform()->GetParent() == root)
             {
-                Player = child->GetOwner();
+                Player = entity;
                 return;
             }
         }
@@ -359,37 +364,18 @@ namespace Engine
     }
 #endif
 
-    rapidjson::Value AiManager::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(ChaseCooldown)
-        SERIALIZE_FIELD(RestCooldown)
-        SERIALIZE_FIELD(PlayerRange)
-        SERIALIZE_FIELD(FastMovementSpeed)
-        SERIALIZE_FIELD(SlowMovementSpeed)
-        SERIALIZE_FIELD(TrashRange)
-        SERIALIZE_FIELD(MaxTrashCapacity)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void AiManager::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(ChaseCooldown)
-        DESERIALIZE_VALUE(RestCooldown)
-        DESERIALIZE_VALUE(PlayerRange)
-        DESERIALIZE_VALUE(FastMovementSpeed)
-        DESERIALIZE_VALUE(SlowMovementSpeed)
-        DESERIALIZE_VALUE(TrashRange)
-        DESERIALIZE_VALUE(MaxTrashCapacity)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void AiManager::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
-
+    SERIALIZATION_FIELDS(AiManager,
+                         SERIALIZATION_FIELD(ChaseCooldown),
+                         SERIALIZATION_FIELD(RestCooldown),
+                         SERIALIZATION_FIELD(PlayerRange),
+                         SERIALIZATION_FIELD(FastMovementSpeed),
+                         SERIALIZATION_FIELD(SlowMovementSpeed),
+                         SERIALIZATION_FIELD(TrashRange),
+                         SERIALIZATION_FIELD(MaxTrashCapacity),
+                         SERIALIZATION_RUNTIME_FIELD(ChaseTimer),
+                         SERIALIZATION_RUNTIME_FIELD(IsChasing),
+                         SERIALIZATION_RUNTIME_FIELD(RestTimer),
+                         SERIALIZATION_RUNTIME_FIELD(IsResting),
+                         SERIALIZATION_RUNTIME_FIELD(RestFinished),
+                         SERIALIZATION_RUNTIME_FIELD(CurrentTrashValue))
 }
@@ -56,7 +56,7 @@ namespace Engine
         void DrawImGui() override;
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(AiManager)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(AiManager)
 
         AStar* AStarComponent = nullptr;
         std::shared_ptr<BehaviorTreeNode> RootBehavior;
@@ -9,6 +9,7 @@
 #include "Engine/Components/Game/Thrash.h"
 #include "Engine/Components/Renderers/ModelRenderer.h"
 #include "Engine/EngineObjects/Entity.h"
+#include "Engine/EngineObjects/Simulation.h"
 #include "spdlog/spdlog.h"
 
 namespace Engine
@@ -364,9 +365,7 @@ namespace Engine
 
         if (!candidates.empty())
         {
-            std::random_device rd;
-            std::mt19937 g(rd());
-            std::shuffle(candidates.begin(), candidates.end(), g);
+            std::shuffle(candidates.begin(), candidates.end(), Simulation::GetRandomEngine());
 
             for (int chosenId : candidates)
             {
@@ -539,7 +538,7 @@ namespace Engine
 
         auto RandomInRange = [](float a, float b)
         {
-            return a + static_cast<float>(rand()) / static_cast<float>(RAND_MAX / (b - a));
+            return Simulation::GetRandomFloat(a, b);
         };
 
         Models::Model* trashModel = target->GetComponent<ModelRenderer>()->GetModel();
@@ -1,5 +1,6 @@
 #include "NavArea.h"
 #include "NavMesh.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/Entity.h"
 
@@ -37,26 +38,22 @@ namespace Engine
     }
 #endif
 
+    SERIALIZATION_REFLECTION(NavArea,
+                             SERIALIZATION_FIELD(IsWalkable))
+
     rapidjson::Value NavArea::Serialize(rapidjson::Document::AllocatorType& Allocator) const
     {
         float spacing = NavMesh::Get().GetSpacing();
         float padding = NavMesh::Get().GetPadding();
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(IsWalkable)
+        rapidjson::Value object = Serialization::WriteObject(*this, GetOwner(), Allocator);
         SERIALIZE_FIELD(spacing)
         SERIALIZE_FIELD(padding)
-        END_COMPONENT_SERIALIZATION
+        return object;
     }
 
     void NavArea::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
     {
-        float spacing = NavMesh::Get().GetSpacing();
-        float padding = NavMesh::Get().GetPadding();
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(IsWalkable)
-        DESERIALIZE_VALUE(spacing)
-        DESERIALIZE_VALUE(padding)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
+        Serialization::ReadObjectValues(Object, *this, ReferenceMap);
     }
 
     void NavArea::DeserializeReferencesPass(const rapidjson::Value& Object,
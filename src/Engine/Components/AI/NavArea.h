@@ -33,7 +33,7 @@ namespace Engine
 #endif
 
     private:
-        SERIALIZATION_EXPORT_CLASS(NavArea)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(NavArea)
 
         bool IsWalkable = false; ///< Indicates whether the navigation area is walkable.
     };
@@ -1,6 +1,7 @@
 #include "NavMesh.h"
 #include <tracy/Tracy.hpp>
 #include "Engine/Components/Renderers/ModelRenderer.h"
+#include "Engine/EngineObjects/ComponentRegistry.h"
 #include "spdlog/spdlog.h"
 #include "Engine/EngineObjects/RayCast.h"
 
@@ -89,32 +90,28 @@ namespace Engine
                                    glm::vec2& SceneMax,
                                    float& LargestModelSize)
     {
-        const auto& entities = Root->GetTransform()->GetChildren();
+        ZoneScoped;
+        const Transform* root = Root->GetTransform();
 
-        for (const auto& entity : entities)
-        {
-            auto* owner = entity->GetOwner();
-            auto* navArea = owner->GetComponent<NavArea>();
-            auto* modelRenderer = owner->GetComponent<ModelRenderer>();
-            if (!modelRenderer)
-                continue;
+        ComponentRegistry::ForEach<NavArea, ModelRenderer>(
+                [&](Entity* const Owner, const NavArea* const Area, const ModelRenderer* const Renderer)
+                {
+                    if (Owner->GetTransform()->GetParent() != root)
+                        return;
 
-            Models::Model* model = modelRenderer->GetModel();
-            glm::mat4 transform = entity->GetLocalToWorldMatrix();
+                    Models::Model* model = Renderer->GetModel();
+                    glm::mat4 transform = Owner->GetTransform()->GetLocalToWorldMatrix();
 
-            if (navArea)
-            {
-                if (!navArea->GetWalkable())
-                {
-                    AddBlockedAreaFromModel(model, transform, BlockedAreas);
-                }
-                else
-                {
-                    ModelTransforms.emplace_back(model, transform);
-                    UpdateSceneBoundsFromModel(model, transform, SceneMin, SceneMax, LargestModelSize);
-                }
-            }
-        }
+                    if (!Area->GetWalkable())
+                    {
+                        AddBlockedAreaFromModel(model, transform, BlockedAreas);
+                    }
+                    else
+                    {
+                        ModelTransforms.emplace_back(model, transform);
+                        UpdateSceneBoundsFromModel(model, transform, SceneMin, SceneMax, LargestModelSize);
+                    }
+                });
     }
 
     void NavMesh::AddBlockedAreaFromModel(Models::Model* Model, const glm::mat4& Transform,
@@ -1,5 +1,6 @@
 #include "AudioSource.h"
 #include "spdlog/spdlog.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/EngineObjects/UpdateManager.h"
@@ -7,7 +8,7 @@
 Engine::AudioSource::AudioSource() :
     AudioManager(AudioManager::GetInstance())
 {
-    UpdateManager::GetInstance()->RegisterComponent(this);
+    UpdateManager::GetInstance()->RegisterComponent(this, UpdatePhase::LateUpdate);
 }
 
 Engine::AudioSource::~AudioSource()
@@ -153,34 +154,10 @@ void Engine::AudioSource::DrawImGui()
 }
 #endif
 
-rapidjson::Value Engine::AudioSource::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-{
-    START_COMPONENT_SERIALIZATION
-    SERIALIZE_FIELD(SelectedSoundId)
-    SERIALIZE_FIELD(SoundVolume)
-    SERIALIZE_FIELD(Looping)
-    SERIALIZE_FIELD(MinDist)
-    SERIALIZE_FIELD(MaxDist)
-    SERIALIZE_FIELD(RollOff)
-    END_COMPONENT_SERIALIZATION
-}
-
-void Engine::AudioSource::DeserializeValuePass(const rapidjson::Value& Object,
-                                               Serialization::ReferenceTable& ReferenceMap)
-{
-    START_COMPONENT_DESERIALIZATION_VALUE_PASS
-    DESERIALIZE_VALUE(SelectedSoundId)
-    DESERIALIZE_VALUE(SoundVolume)
-    DESERIALIZE_VALUE(Looping)
-    DESERIALIZE_VALUE(MinDist)
-    DESERIALIZE_VALUE(MaxDist)
-    DESERIALIZE_VALUE(RollOff)
-    END_COMPONENT_DESERIALIZATION_VALUE_PASS
-}
-
-void Engine::AudioSource::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                    Serialization::ReferenceTable& ReferenceMap)
-{
-    START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-}
+SERIALIZATION_FIELDS(Engine::AudioSource,
+                     SERIALIZATION_FIELD(SelectedSoundId),
+                     SERIALIZATION_FIELD(SoundVolume),
+                     SERIALIZATION_FIELD(Looping),
+                     SERIALIZATION_FIELD(MinDist),
+                     SERIALIZATION_FIELD(MaxDist),
+                     SERIALIZATION_FIELD(RollOff))
@@ -28,7 +28,7 @@ namespace Engine
         float MaxDist = 10.0f; ///< Maximum distance at which sound becomes inaudible.
         float RollOff = 1.0f; ///< Roll-off factor for sound attenuation.
 
-        SERIALIZATION_EXPORT_CLASS(AudioSource);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(AudioSource);
 
     public:
         /**
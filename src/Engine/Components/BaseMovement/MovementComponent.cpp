@@ -1,6 +1,7 @@
 #include "MovementComponent.h"
 #include "spdlog/spdlog.h"
 #include "Engine/Components/Physics/RigidBody.h"
+#include "Serialization/Reflection.h"
 namespace Engine
 {
 
@@ -86,22 +87,5 @@ namespace Engine
 #endif
     }
 
-    rapidjson::Value MovementComponent::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void MovementComponent::DeserializeValuePass(const rapidjson::Value& Object,
-                                                 Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void MovementComponent::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                      Serialization::ReferenceTable& ReferenceMap)
-    {
-        // Implementacja
-    }
+    SERIALIZATION_FIELDS(MovementComponent)
 } // namespace Engine
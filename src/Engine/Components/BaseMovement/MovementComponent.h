@@ -34,7 +34,7 @@ namespace Engine
         void OnDestroy() override {}
 
 
-        SERIALIZATION_EXPORT_CLASS(MovementComponent);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(MovementComponent);
 
 
         #if EDITOR
@@ -4,6 +4,7 @@
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/Rendering/Plane.h"
 #include "Engine/Textures/TextureManager.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Shaders/Shader.h"
 #include "glad/glad.h"
@@ -96,24 +97,6 @@ namespace Engine
     }
 #endif
 
-    rapidjson::Value BloodEraser::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Texture)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void BloodEraser::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Texture)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void BloodEraser::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(BloodEraser,
+                         SERIALIZATION_FIELD(Texture))
 }
@@ -46,7 +46,7 @@ namespace Engine
     public:
         void Draw() const;
 
-        SERIALIZATION_EXPORT_CLASS(BloodEraser)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(BloodEraser)
     };
 
 }
@@ -4,6 +4,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
 
+#include "Engine/Rendering/GraphicsContext.h"
 #include "Shaders/ShaderManager.h"
 #include "Utility/AssertionsUtility.h"
 
@@ -16,6 +17,22 @@ namespace Engine
         CHECK_MESSAGE(Instance == nullptr, "BloodManager already exists.");
         Instance = this;
 
+        const glm::vec3 cameraPosition = glm::vec3(0.0f, SceneBounds.max.y, 0.0f);
+        constexpr glm::vec3 origin = glm::vec3(0.0f, 0.0f, 0.0f);
+        constexpr glm::vec3 upDirection = glm::vec3(0.0f, 0.0f, -1.0f);
+
+        const glm::mat4 viewMatrix = glm::lookAt(cameraPosition, origin, upDirection);
+        const glm::mat4 projectionMatrix = glm::ortho(SceneBounds.min.x, SceneBounds.max.x,
+                                                      SceneBounds.min.z, SceneBounds.max.z,
+                                                      0.0f, SceneBounds.max.y - SceneBounds.min.y);
+        ViewProjectionMatrix = projectionMatrix * viewMatrix;
+
+        /*the mask is drawn on the GPU, without an OpenGL context blood is only tracked and never drawn*/
+        if (!GraphicsContext::IsAvailable())
+        {
+            return;
+        }
+
         glGenFramebuffers(1, &FrameBuffer);
         glGenTextures(1, &ColorBuffer);
 
@@ -41,16 +58,6 @@ namespace Engine
         glClear(GL_COLOR_BUFFER_BIT);
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-        const glm::vec3 cameraPosition = glm::vec3(0.0f, SceneBounds.max.y, 0.0f);
-        constexpr glm::vec3 origin = glm::vec3(0.0f, 0.0f, 0.0f);
-        constexpr glm::vec3 upDirection = glm::vec3(0.0f, 0.0f, -1.0f);
-
-        const glm::mat4 viewMatrix = glm::lookAt(cameraPosition, origin, upDirection);
-        const glm::mat4 projectionMatrix = glm::ortho(SceneBounds.min.x, SceneBounds.max.x,
-                                                      SceneBounds.min.z, SceneBounds.max.z,
-                                                      0.0f, SceneBounds.max.y - SceneBounds.min.y);
-        ViewProjectionMatrix = projectionMatrix * viewMatrix;
-
         MaskShader = Shaders::ShaderManager::GetShader(
                 Shaders::ShaderSourceFiles("./res/shaders/Blood/BloodMask.vert",
                                            "",
@@ -82,6 +89,10 @@ namespace Engine
         }
 
         RemoveBloodEraser(Eraser);
+        if (!GraphicsContext::IsAvailable())
+        {
+            return;
+        }
         glDeleteFramebuffers(1, &FrameBuffer);
         glDeleteTextures(1, &ColorBuffer);
 
@@ -90,6 +101,11 @@ namespace Engine
 
     void BloodManager::Update(const float DeltaTime)
     {
+        if (!GraphicsContext::IsAvailable())
+        {
+            BloodStains.clear();
+            return;
+        }
         glBindFramebuffer(GL_FRAMEBUFFER, FrameBuffer);
         glViewport(0, 0, MaskSize, MaskSize);
         glEnable(GL_CULL_FACE);
@@ -8,6 +8,7 @@
 #include "Models/AabBox.h"
 #include "Shaders/ComputeShader.h"
 #include "Shaders/Shader.h"
+#include "Utility/AssertionsUtility.h"
 
 namespace Engine
 {
@@ -40,7 +41,7 @@ namespace Engine
         Shaders::ComputeShader AccumulationShader;
         glm::ivec3 DispatchSize;
 
-        float BloodFill;
+        float BloodFill = 0.0f;
 
         float* AccumulationPtr = nullptr;
 
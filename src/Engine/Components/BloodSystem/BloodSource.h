@@ -25,6 +25,6 @@ namespace Engine
         void DrawImGui() override;
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(BloodSource)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(BloodSource)
     };
 }
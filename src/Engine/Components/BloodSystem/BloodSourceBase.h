@@ -64,6 +64,8 @@ namespace Engine
 
         void DrawImGui() override;
 #endif
+
+        SERIALIZATION_EXPORT_TYPE_ID(BloodSourceBase)
     };
 
 }
@@ -3,6 +3,7 @@
 #include "BloodManager.h"
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/Textures/TextureManager.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -39,26 +40,7 @@ namespace Engine
     }
 #endif
 
-    rapidjson::Value BloodStain::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Texture);
-        SERIALIZE_FIELD(Color);
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void BloodStain::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Texture)
-        DESERIALIZE_VALUE(Color)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void BloodStain::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                               Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(BloodStain,
+                         SERIALIZATION_FIELD(Texture),
+                         SERIALIZATION_FIELD(Color))
 }
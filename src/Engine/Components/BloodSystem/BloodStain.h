@@ -26,7 +26,7 @@ namespace Engine
         void DrawImGui() override;
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(BloodStain)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(BloodStain)
     };
 
 }
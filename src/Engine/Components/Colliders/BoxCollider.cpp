@@ -4,6 +4,8 @@
 #include "Shaders/ShaderManager.h"
 #include "Utility/MathUtility.h"
 #include "spdlog/spdlog.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Serialization/Reflection.h"
 
 namespace Engine
 {
@@ -62,43 +64,22 @@ namespace Engine
         return *this;
     }
 
-    rapidjson::Value BoxCollider::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(isTrigger);
-        SERIALIZE_FIELD(isStatic);
-        SERIALIZE_FIELD(colliderType);
-        SERIALIZE_FIELD(_width)
-        SERIALIZE_FIELD(_height);
-        SERIALIZE_FIELD(_depth);
-        END_COMPONENT_SERIALIZATION
-
-    }
+    SERIALIZATION_FIELDS(BoxCollider,
+                         SERIALIZATION_FIELD(isTrigger),
+                         SERIALIZATION_FIELD(isStatic),
+                         SERIALIZATION_FIELD(colliderType),
+                         SERIALIZATION_FIELD(_width),
+                         SERIALIZATION_FIELD(_height),
+                         SERIALIZATION_FIELD(_depth),
+                         SERIALIZATION_REFERENCE(transform))
 
-    void BoxCollider::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(isTrigger);
-        DESERIALIZE_VALUE(isStatic);
-        DESERIALIZE_VALUE(colliderType);
-        DESERIALIZE_VALUE(_width);
-        DESERIALIZE_VALUE(_height);
-        DESERIALIZE_VALUE(_depth);
 #if EDITOR
-        UpdateBuffers();
-#endif
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void BoxCollider::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                Serialization::ReferenceTable& ReferenceMap)
+    void BoxCollider::OnReferencesResolved()
     {
-
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        DESERIALIZE_POINTER(transform)
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
+        /*touches OpenGL buffers, value pass may run on a worker thread*/
+        UpdateBuffers();
     }
+#endif
 
     glm::mat3 BoxCollider::CalculateInertiaTensorBody(float mass) const
     {
@@ -121,6 +102,7 @@ namespace Engine
         glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
         glBindVertexArray(Vao);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawElements(GL_LINES, 24 * sizeof(uint32_t), GL_UNSIGNED_INT, 0);
 
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -190,9 +172,11 @@ namespace Engine
         glBindVertexArray(Vao);
 
         glBindBuffer(GL_ARRAY_BUFFER, Vbo);
+        TELEMETRY_COUNT(BytesUploaded, sizeof(vertices));
         glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Ebo);
+        TELEMETRY_COUNT(BytesUploaded, sizeof(indices));
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*) 0);
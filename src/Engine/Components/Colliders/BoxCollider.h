@@ -101,6 +101,8 @@ namespace Engine
 
 #if EDITOR
         void DrawImGui() override;
+
+        void OnReferencesResolved() override;
 #endif
 
     private:
@@ -108,7 +110,7 @@ namespace Engine
         void UpdateBuffers();
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(BoxCollider)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(BoxCollider)
 
     };
 
@@ -5,6 +5,8 @@
 #include "Utility/MathUtility.h"
 
 #include "spdlog/spdlog.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Serialization/Reflection.h"
 
 
 namespace Engine
@@ -57,39 +59,20 @@ namespace Engine
         return *this;
     }
 
-    rapidjson::Value CapsuleCollider::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(isTrigger);
-        SERIALIZE_FIELD(isStatic);
-        SERIALIZE_FIELD(colliderType);
-        SERIALIZE_FIELD(Radius)
-        SERIALIZE_FIELD(Height);
-        END_COMPONENT_SERIALIZATION
-    }
+    SERIALIZATION_FIELDS(CapsuleCollider,
+                         SERIALIZATION_FIELD(isTrigger),
+                         SERIALIZATION_FIELD(isStatic),
+                         SERIALIZATION_FIELD(colliderType),
+                         SERIALIZATION_FIELD(Radius),
+                         SERIALIZATION_FIELD(Height))
 
-    void CapsuleCollider::DeserializeValuePass(const rapidjson::Value& Object,
-                                               Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(isTrigger);
-        DESERIALIZE_VALUE(isStatic);
-        DESERIALIZE_VALUE(colliderType);
-        DESERIALIZE_VALUE(Height);
-        DESERIALIZE_VALUE(Radius);
 #if EDITOR
-        UpdateBuffers();
-#endif
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void CapsuleCollider::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                    Serialization::ReferenceTable& ReferenceMap)
+    void CapsuleCollider::OnReferencesResolved()
     {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
+        /*touches OpenGL buffers, value pass may run on a worker thread*/
+        UpdateBuffers();
     }
+#endif
 
     glm::mat3 CapsuleCollider::CalculateInertiaTensorBody(float mass) const
     {
@@ -139,6 +122,7 @@ namespace Engine
         glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
         glBindVertexArray(Vao);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawElements(GL_LINES, (Rings * 2 + 1) * Segments * 6, GL_UNSIGNED_INT, 0);
 
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -237,10 +221,12 @@ namespace Engine
         glBindVertexArray(Vao);
 
         glBindBuffer(GL_ARRAY_BUFFER, Vbo);
+        TELEMETRY_COUNT(BytesUploaded, vertices.size() * sizeof(glm::vec3));
         glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(glm::vec3)), vertices.data(),
                      GL_STATIC_DRAW);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Ebo);
+        TELEMETRY_COUNT(BytesUploaded, indices.size() * sizeof(unsigned int));
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)),
                      indices.data(), GL_STATIC_DRAW);
 
@@ -91,10 +91,12 @@ namespace Engine
         void UpdateBuffers();
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(CapsuleCollider)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(CapsuleCollider)
 
 #if EDITOR
         void DrawImGui() override;
+
+        void OnReferencesResolved() override;
 #endif
     };
 
@@ -4,7 +4,6 @@
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/CollisionUpdateManager.h"
 #include "Shaders/ShaderManager.h"
-#include <random>
 #include "spdlog/spdlog.h"
 #include "Engine/EngineObjects/Entity.h"
 #include <iostream>
@@ -86,15 +85,4 @@ namespace Engine
         CollisionUpdateManager::GetInstance()->UnregisterCollider(this);
         SpatialPartitioning::GetInstance().RemoveCollider(this);
     }
-
-    // TODO: remove when rigidbody implemented
-    float Collider::GetRandomFloat(const float Min, const float Max)
-    {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dis(Min, Max);
-        return dis(gen);
-    }
-
-
 } // namespace Engine
@@ -8,6 +8,7 @@
 #include "Engine/Components/Renderers/Renderer.h"
 #include "Events/Action.h"
 #include "PrimitiveMeshes.h"
+#include "Engine/EngineObjects/UpdateList.h"
 
 namespace Engine
 {
@@ -32,6 +33,11 @@ namespace Engine
             : public Component
 #endif
     {
+        friend class CollisionUpdateManager;
+
+    private:
+        /*slot in the list of CollisionUpdateManager*/
+        UpdateListSlot UpdateSlot;
 
     protected:
         bool isStatic;
@@ -112,9 +118,9 @@ namespace Engine
             OnTrigger.Invoke(Other);
         }
 
-        void OnTriggerAddListener(const Events::TAction<Collider*>& Listener)
+        Events::ListenerHandle OnTriggerAddListener(const Events::TAction<Collider*>& Listener)
         {
-            OnTrigger.AddListener(Listener);
+            return OnTrigger.AddListener(Listener);
         }
 
         void OnTriggerRemoveListener(const Events::TAction<Collider*>& Listener)
@@ -122,9 +128,9 @@ namespace Engine
             OnTrigger.RemoveListener(Listener);
         }
 
-        void OnCollisionAddListener(const Events::TAction<Collider*>& Listener)
+        Events::ListenerHandle OnCollisionAddListener(const Events::TAction<Collider*>& Listener)
         {
-            OnCollision.AddListener(Listener);
+            return OnCollision.AddListener(Listener);
         }
 
         void OnCollisionRemoveListener(const Events::TAction<Collider*>& Listener)
@@ -156,13 +162,13 @@ namespace Engine
 
         void Update(float DeltaTime);
 
-        float GetRandomFloat(float Min, float Max);
-
 #if EDITOR
         void DrawImGui() override
         {
         };
 #endif
+
+        SERIALIZATION_EXPORT_TYPE_ID(Collider)
     };
 
 } // namespace Engine
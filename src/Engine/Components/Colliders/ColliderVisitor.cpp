@@ -12,6 +12,7 @@
 #include "SpatialPartitioning.h"
 #include "SphereCollider.h"
 #include "spdlog/spdlog.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 namespace Engine
 {
@@ -1303,6 +1304,7 @@ namespace Engine
             if (collider == this->currentCollider || collider->GetOwner() == nullptr)
                 continue;
 
+            TELEMETRY_COUNT(ColliderPairsTested, 1);
             collider->AcceptCollision(*this);
             
         }
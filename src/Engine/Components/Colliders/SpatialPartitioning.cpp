@@ -96,6 +96,35 @@ namespace Engine
         colliderCellMap.erase(collider);
     }
 
+    void SpatialPartitioning::RemoveColliders(const std::vector<Collider*>& colliders)
+    {
+        std::unordered_set<Collider*> removed;
+        std::unordered_set<glm::ivec2, Vec2Hash> affectedCells;
+        for (Collider* collider : colliders)
+        {
+            auto it = colliderCellMap.find(collider);
+            if (it == colliderCellMap.end())
+                continue;
+
+            removed.insert(collider);
+            affectedCells.insert(it->second.begin(), it->second.end());
+            colliderCellMap.erase(it);
+        }
+
+        for (const auto& index : affectedCells)
+        {
+            auto gridIt = grid.find(index);
+            if (gridIt == grid.end())
+                continue;
+
+            auto& cell = gridIt->second;
+            std::erase_if(cell, [&removed](Collider* collider) { return removed.contains(collider); });
+
+            if (cell.empty())
+                grid.erase(gridIt);
+        }
+    }
+
     std::vector<Collider*> SpatialPartitioning::GetPotentialCollisions(Collider* collider)
     {
         if (!collider || !collider->GetTransform())
@@ -26,6 +26,7 @@ namespace Engine
 
         void AddCollider(Collider* collider);
         void RemoveCollider(Collider* collider);
+        void RemoveColliders(const std::vector<Collider*>& colliders);
         std::vector<Collider*> GetPotentialCollisions(Collider* collider);
         std::vector<Collider*> QuerySphere(glm::vec3& position, float radius) const;
 
@@ -4,6 +4,8 @@
 #include "Shaders/ShaderManager.h"
 #include "Utility/MathUtility.h"
 #include "spdlog/spdlog.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Serialization/Reflection.h"
 
 namespace Engine
 {
@@ -54,38 +56,20 @@ namespace Engine
         return *this;
     }
 
-    rapidjson::Value SphereCollider::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(isTrigger);
-        SERIALIZE_FIELD(isStatic);
-        SERIALIZE_FIELD(colliderType);
-        SERIALIZE_FIELD(radius);
-        END_COMPONENT_SERIALIZATION
-    }
+    SERIALIZATION_FIELDS(SphereCollider,
+                         SERIALIZATION_FIELD(isTrigger),
+                         SERIALIZATION_FIELD(isStatic),
+                         SERIALIZATION_FIELD(colliderType),
+                         SERIALIZATION_FIELD(radius),
+                         SERIALIZATION_REFERENCE(transform))
 
-    void SphereCollider::DeserializeValuePass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(isTrigger);
-        DESERIALIZE_VALUE(isStatic);
-        DESERIALIZE_VALUE(colliderType);
-        DESERIALIZE_VALUE(radius);
 #if EDITOR
-        UpdateBuffers();
-#endif
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void SphereCollider::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                   Serialization::ReferenceTable& ReferenceMap)
+    void SphereCollider::OnReferencesResolved()
     {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        DESERIALIZE_POINTER(transform)
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
+        /*touches OpenGL buffers, value pass may run on a worker thread*/
+        UpdateBuffers();
     }
+#endif
 
     glm::mat3 SphereCollider::CalculateInertiaTensorBody(float mass) const
     {
@@ -105,6 +89,7 @@ namespace Engine
         glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
         glBindVertexArray(Vao);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawElements(GL_LINES, LongitudeSegments * LatitudeSegments * 4, GL_UNSIGNED_INT, nullptr);
 
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -190,10 +175,12 @@ namespace Engine
         glBindVertexArray(Vao);
 
         glBindBuffer(GL_ARRAY_BUFFER, Vbo);
+        TELEMETRY_COUNT(BytesUploaded, vertices.size() * sizeof(glm::vec3));
         glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(glm::vec3)), vertices.data(),
                      GL_STATIC_DRAW);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Ebo);
+        TELEMETRY_COUNT(BytesUploaded, indices.size() * sizeof(uint32_t));
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(uint32_t)),
                      indices.data(), GL_STATIC_DRAW);
 
@@ -68,10 +68,12 @@ namespace Engine
         void RenderPointSpotShadows(const glm::vec3& LightPosition, float LightRange,
                                     const glm::mat4* SpaceTransformMatrices) override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(SphereCollider)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(SphereCollider)
 
 #if EDITOR
         void DrawImGui() override;
+
+        void OnReferencesResolved() override;
 #endif
 
     private:
@@ -1,6 +1,7 @@
 #include "Furniture.h"
 #include "ThrashManager.h"
 #include "Engine/EngineObjects/Scene/Scene.h"
+#include "Serialization/Reflection.h"
 namespace Engine
 {
 
@@ -22,7 +23,8 @@ namespace Engine
 
     void Furniture::DeleteFurniture(Collider* collider) 
     {
-        if (collider->GetOwner()->GetName() == "ThrashCan")
+        static const NameId thrashCanName = NameTable::Intern("ThrashCan");
+        if (collider->GetOwner()->GetNameId() == thrashCanName)
         {
             GetOwner()->GetScene()->DeleteEntity(GetOwner());
             ThrashManager::GetInstance()->RemoveFurniture(this);
@@ -35,22 +37,5 @@ namespace Engine
     }
     #endif
 
-    rapidjson::Value Furniture::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void Furniture::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Furniture::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(Furniture)
 } // namespace Engine
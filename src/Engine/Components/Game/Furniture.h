@@ -24,7 +24,7 @@ namespace Engine
 
         void DeleteFurniture(Collider* collider);
 
-        SERIALIZATION_EXPORT_CLASS(Furniture);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Furniture);
 
         #if EDITOR
         void DrawImGui() override;
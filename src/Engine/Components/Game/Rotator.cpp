@@ -1,5 +1,6 @@
 #include "Rotator.h"
 
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -17,23 +18,7 @@ namespace Engine
         }
     }
 #endif
-    rapidjson::Value Rotator::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Velocity)
-        END_COMPONENT_SERIALIZATION
-    }
 
-    void Rotator::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Velocity)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Rotator::DeserializeReferencesPass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(Rotator,
+                         SERIALIZATION_FIELD(Velocity))
 } // Engine
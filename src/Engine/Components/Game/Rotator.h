@@ -46,7 +46,7 @@ namespace Engine
         #if EDITOR
         void DrawImGui() override;
         #endif
-        SERIALIZATION_EXPORT_CLASS(Rotator)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Rotator)
     };
 
 } // Engine
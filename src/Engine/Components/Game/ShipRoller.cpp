@@ -1,6 +1,7 @@
 #include "ShipRoller.h"
 #include "Engine/EngineObjects/Entity.h"
-#include "GLFW/glfw3.h"
+#include "Engine/EngineObjects/Simulation.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -12,7 +13,7 @@ namespace Engine
 
     void ShipRoller::Update(float DeltaTime)
     {
-        const float time = static_cast<float>(glfwGetTime());
+        const float time = static_cast<float>(Simulation::GetTime());
         GetOwner()->GetTransform()->SetEulerAngles(glm::vec3(
                 InitialRotation.x + sin(time * Velocity.x) * Amplitude.x,
                 InitialRotation.y + cos(time * Velocity.y) * Amplitude.y,
@@ -30,26 +31,7 @@ namespace Engine
     }
 #endif
 
-    rapidjson::Value ShipRoller::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Velocity)
-        SERIALIZE_FIELD(Amplitude)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void ShipRoller::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Velocity)
-        DESERIALIZE_VALUE(Amplitude)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void ShipRoller::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                               Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(ShipRoller,
+                         SERIALIZATION_FIELD(Velocity),
+                         SERIALIZATION_FIELD(Amplitude))
 } // Engine
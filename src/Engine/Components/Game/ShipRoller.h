@@ -88,7 +88,7 @@ namespace Engine
         #if EDITOR
         void DrawImGui() override;
         #endif
-        SERIALIZATION_EXPORT_CLASS(ShipRoller)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(ShipRoller)
     };
 
 } // Engine
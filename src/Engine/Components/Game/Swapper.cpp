@@ -3,6 +3,7 @@
 #include "Engine/Prefabs/PrefabLoader.h"
 #include "Serialization/SerializationFilesUtility.h"
 #include "Engine/EngineObjects/UpdateManager.h"
+#include "Serialization/Reflection.h"
 
 namespace Engine
 {
@@ -13,6 +14,9 @@ namespace Engine
             return; 
         player = owner->GetScene()->GetPlayer();
         UpdateManager::GetInstance()->RegisterComponent(this);
+        PrefabLoader::Preload(StripperPath);
+        PrefabLoader::Preload(VacuumPath);
+        PrefabLoader::Preload(BroomPath);
     }
 
     void Engine::Swapper::Update(float DeltaTime)
@@ -93,21 +97,5 @@ namespace Engine
         }
     }
 
-    rapidjson::Value Swapper::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void Swapper::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Swapper::DeserializeReferencesPass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(Swapper)
 } // namespace Engine
@@ -30,7 +30,7 @@ namespace Engine
 
     public:
 
-        SERIALIZATION_EXPORT_CLASS(Swapper);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Swapper);
 #if EDITOR
         void DrawImGui() override {};
 #endif
@@ -1,4 +1,5 @@
 #include "Thrash.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/Scene/Scene.h"
 
@@ -11,30 +12,13 @@ namespace Engine
         ThrashManager::GetInstance()->AddThrash(this);
     }
 
-    rapidjson::Value Thrash::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(size)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void Thrash::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(size)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Thrash::DeserializeReferencesPass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
-
+    SERIALIZATION_FIELDS(Thrash,
+                         SERIALIZATION_FIELD(size))
 
     void Thrash::DeleteThrash(Engine::Collider* collider)
     {
-        if (collider->GetOwner()->GetName() == "ThrashCan")
+        static const NameId thrashCanName = NameTable::Intern("ThrashCan");
+        if (collider->GetOwner()->GetNameId() == thrashCanName)
         {
             if (this->collider)
             {
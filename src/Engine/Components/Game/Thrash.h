@@ -43,7 +43,7 @@ namespace Engine
 
         void DeleteThrash(Collider* collider);
 
-        SERIALIZATION_EXPORT_CLASS(Thrash);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Thrash);
 
 #if EDITOR
         void DrawImGui() override;
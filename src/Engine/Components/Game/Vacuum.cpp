@@ -1,6 +1,8 @@
 #include "Vacuum.h"
 #include "Engine/EngineObjects/Entity.h"
 #include "Thrash.h"
+#include "Engine/EngineObjects/SceneCommandBuffer.h"
+#include "Engine/EngineObjects/Simulation.h"
 #include "Engine/EngineObjects/UpdateManager.h"
 #include "Engine/Components/Physics/Rigidbody.h"
 #include "Engine/EngineObjects/Scene/Scene.h"
@@ -8,6 +10,7 @@
 #include "Engine/Components/Colliders/SphereCollider.h"
 #include "Engine/Components/Game/ThrashManager.h"
 #include <iostream>
+#include "Serialization/Reflection.h"
 
 namespace Engine
 {
@@ -43,7 +46,7 @@ namespace Engine
             isSuccing = false;
         }
 
-        float currentTime = static_cast<float>(glfwGetTime());
+        float currentTime = static_cast<float>(Simulation::GetTime());
 
         // --- STRZELANIE ---
         if (isShooting)
@@ -94,9 +97,13 @@ namespace Engine
                     {
                         items.push_back(entityCollider->GetOwner());
                         volume += thrashSizeInt;
-                        entityCollider->GetOwner()->GetComponent<Engine::BoxCollider>()->SetTrigger(true);
-                        entityCollider->GetOwner()->GetComponent<Engine::Rigidbody>()->hasGravity = false;
-                        entityCollider->GetOwner()->GetTransform()->SetPosition(glm::vec3(1000, 1, 1000));
+                        // Moving colliders while iterating query results is deferred to the end of the frame.
+                        SceneCommandBuffer::GetInstance()->Defer(entityCollider->GetOwner(), [](Entity* const Item)
+                        {
+                            Item->GetComponent<Engine::BoxCollider>()->SetTrigger(true);
+                            Item->GetComponent<Engine::Rigidbody>()->hasGravity = false;
+                            Item->GetTransform()->SetPosition(glm::vec3(1000, 1, 1000));
+                        });
                     }
                 }
             }
@@ -131,23 +138,7 @@ namespace Engine
         }
     }
 
-    rapidjson::Value Vacuum::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void Vacuum::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Vacuum::DeserializeReferencesPass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(Vacuum)
 #if EDITOR
     void Vacuum::DrawImGui() {}
 #endif
@@ -44,7 +44,7 @@ namespace Engine
         void Update(float deltaTime) override;
         void Shoot();
 
-        SERIALIZATION_EXPORT_CLASS(Vacuum);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Vacuum);
 #if EDITOR
         void DrawImGui() override;
 #endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/EngineObjects/UpdateList.h"
+
 namespace Engine
 {
     /**
@@ -7,7 +9,26 @@ namespace Engine
      */
     class IUpdateable
     {
+        friend class UpdateManager;
+
+    private:
+        /*list of UpdateManager the updateable is registered in and its slot there*/
+        TUpdateList<IUpdateable>* UpdateList = nullptr;
+        UpdateListSlot UpdateSlot;
+
     public:
+        IUpdateable() = default;
+
+        /*a copy isn't registered anywhere yet*/
+        IUpdateable(const IUpdateable&)
+        {
+        }
+
+        IUpdateable& operator=(const IUpdateable&)
+        {
+            return *this;
+        }
+
         virtual ~IUpdateable() = default;
 
     public:
@@ -1,6 +1,7 @@
 #include "DirectionalLight.h"
 #include "Engine/EngineObjects/LightManager.h"
 #include "Engine/Gui/LightsGui.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -9,7 +10,10 @@ namespace Engine
 
     DirectionalLight::~DirectionalLight()
     {
-        LightManager::GetInstance()->UnregisterLight(this);
+        if (LightManager* const lightManager = LightManager::GetInstance())
+        {
+            lightManager->UnregisterLight(this);
+        }
 #if EDITOR
         LightsGui::UnregisterLight(this);
 #endif
@@ -18,7 +22,10 @@ namespace Engine
     void DirectionalLight::Start()
     {
         Component::Start();
-        LightManager::GetInstance()->RegisterLight(this);
+        if (LightManager* const lightManager = LightManager::GetInstance())
+        {
+            lightManager->RegisterLight(this);
+        }
 #if EDITOR
         LightsGui::RegisterLight(this);
 #endif
@@ -36,25 +43,7 @@ namespace Engine
         }
     }
     #endif
-    rapidjson::Value DirectionalLight::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Color)
-        END_COMPONENT_SERIALIZATION
-    }
 
-    void DirectionalLight::DeserializeValuePass(const rapidjson::Value& Object,
-                                                Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Color)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void DirectionalLight::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                     Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(DirectionalLight,
+                         SERIALIZATION_FIELD(Color))
 } // Engine
@@ -84,7 +84,7 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(DirectionalLight);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(DirectionalLight);
     };
 
 } // Engine
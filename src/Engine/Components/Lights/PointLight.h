@@ -139,7 +139,7 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(PointLight)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(PointLight)
     };
 
 } // Engine
@@ -1,6 +1,7 @@
 #include "SpotLight.h"
 #include "Engine/EngineObjects/LightManager.h"
 #include "Engine/Gui/LightsGui.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -8,7 +9,10 @@ namespace Engine
     void SpotLight::Start()
     {
         Component::Start();
-        LightManager::GetInstance()->RegisterLight(this);
+        if (LightManager* const lightManager = LightManager::GetInstance())
+        {
+            lightManager->RegisterLight(this);
+        }
 #if EDITOR
         LightsGui::RegisterLight(this);
 #endif
@@ -57,41 +61,20 @@ namespace Engine
     #endif
     SpotLight::~SpotLight()
     {
-        LightManager::GetInstance()->UnregisterLight(this);
+        if (LightManager* const lightManager = LightManager::GetInstance())
+        {
+            lightManager->UnregisterLight(this);
+        }
 #if EDITOR
         LightsGui::UnregisterLight(this);
 #endif
     }
 
-    rapidjson::Value SpotLight::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Color)
-        SERIALIZE_FIELD(OuterAngle)
-        SERIALIZE_FIELD(InnerAngle)
-        SERIALIZE_FIELD(LinearFalloff)
-        SERIALIZE_FIELD(QuadraticFalloff)
-        SERIALIZE_FIELD(Range)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void SpotLight::DeserializeValuePass(const rapidjson::Value& Object,
-                                         Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Color)
-        DESERIALIZE_VALUE(OuterAngle)
-        DESERIALIZE_VALUE(InnerAngle)
-        DESERIALIZE_VALUE(LinearFalloff)
-        DESERIALIZE_VALUE(QuadraticFalloff)
-        DESERIALIZE_VALUE(Range)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void SpotLight::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(SpotLight,
+                         SERIALIZATION_FIELD(Color),
+                         SERIALIZATION_FIELD(OuterAngle),
+                         SERIALIZATION_FIELD(InnerAngle),
+                         SERIALIZATION_FIELD(LinearFalloff),
+                         SERIALIZATION_FIELD(QuadraticFalloff),
+                         SERIALIZATION_FIELD(Range))
 } // Engine
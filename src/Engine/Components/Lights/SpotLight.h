@@ -187,7 +187,7 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(SpotLight)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(SpotLight)
     };
 
 } // Engine
@@ -8,6 +8,8 @@
 #include "Engine/Components/Renderers/ModelRenderer.h"
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/EngineObjects/RigidbodyUpdateManager.h"
+#include "tracy/Tracy.hpp"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 
 namespace Engine
@@ -69,13 +71,15 @@ namespace Engine
 
     void Rigidbody::Update(float deltaTime)
     {
+        ZoneScoped;
         if (!transform)
             return;
 
         ApplyGravity(glm::vec3(0.0f, -4.81f, 0.0f));
         ComputeGravityTorqueFromVertices();
 
-        lastPosition = transform->GetPosition();
+        const glm::vec3 position = transform->GetPosition();
+        lastPosition = position;
         lastRotation = transform->GetRotation();
 
         glm::vec3 acceleration = accumulatedForce * inverseMass;
@@ -86,13 +90,13 @@ namespace Engine
         angularVelocity += angularAcceleration * deltaTime;
         angularVelocity *= (1.0f - angularDamping);
 
-        glm::vec3 newPosition = transform->GetPosition() + velocity * deltaTime;
+        glm::vec3 newPosition = position + velocity * deltaTime;
         if (constraints.freezePositionX)
-            newPosition.x = transform->GetPosition().x;
+            newPosition.x = position.x;
         if (constraints.freezePositionY)
-            newPosition.y = transform->GetPosition().y;
+            newPosition.y = position.y;
         if (constraints.freezePositionZ)
-            newPosition.z = transform->GetPosition().z;
+            newPosition.z = position.z;
 
         glm::vec3 newAngularVelocity = angularVelocity;
         if (constraints.freezeRotationX)
@@ -349,40 +353,21 @@ namespace Engine
 #endif
 
 
-    rapidjson::Value Rigidbody::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(mass)
-        SERIALIZE_FIELD(inverseMass)
-        SERIALIZE_FIELD(linearDamping)
-        SERIALIZE_FIELD(angularDamping)
-        SERIALIZE_FIELD(friction)
-        SERIALIZE_FIELD(frictionEnabled)
-        SERIALIZE_FIELD(restitution)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void Rigidbody::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(mass)
-        DESERIALIZE_VALUE(inverseMass)
-        DESERIALIZE_VALUE(linearDamping)
-        DESERIALIZE_VALUE(angularDamping)
-        DESERIALIZE_VALUE(friction)
-        DESERIALIZE_VALUE(frictionEnabled)
-        DESERIALIZE_VALUE(restitution)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void Rigidbody::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        DESERIALIZE_POINTER(transform)
-        DESERIALIZE_POINTER(mesh)
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
-
+    SERIALIZATION_FIELDS(Rigidbody,
+                         SERIALIZATION_FIELD(mass),
+                         SERIALIZATION_FIELD(inverseMass),
+                         SERIALIZATION_FIELD(linearDamping),
+                         SERIALIZATION_FIELD(angularDamping),
+                         SERIALIZATION_FIELD(friction),
+                         SERIALIZATION_FIELD(frictionEnabled),
+                         SERIALIZATION_FIELD(restitution),
+                         SERIALIZATION_RUNTIME_FIELD(velocity),
+                         SERIALIZATION_RUNTIME_FIELD(angularVelocity),
+                         SERIALIZATION_RUNTIME_FIELD(accumulatedForce),
+                         SERIALIZATION_RUNTIME_FIELD(accumulatedTorque),
+                         SERIALIZATION_RUNTIME_FIELD(lastPosition),
+                         SERIALIZATION_RUNTIME_FIELD(lastRotation),
+                         SERIALIZATION_RUNTIME_FIELD(collisionNormalTimer),
+                         SERIALIZATION_REFERENCE(transform),
+                         SERIALIZATION_REFERENCE(mesh))
 } // namespace Engine
@@ -8,6 +8,7 @@
 #include "Engine/Components/Component.h"
 #include "Engine/Components/Colliders/ColliderVisitor.h"
 #include "Engine/Components/Colliders/PrimitiveMeshes.h"
+#include "Engine/EngineObjects/UpdateList.h"
 namespace Engine
 {
 
@@ -29,6 +30,12 @@ namespace Engine
 
     class Rigidbody : public Component
     {
+        friend class RigidbodyUpdateManager;
+
+    private:
+        /*slot in the list of RigidbodyUpdateManager*/
+        UpdateListSlot UpdateSlot;
+
     public:
         Rigidbody();
 
@@ -55,7 +62,7 @@ namespace Engine
         void DrawImGui() override;
         #endif
 
-        SERIALIZATION_EXPORT_CLASS(Rigidbody)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Rigidbody)
 
     public:
         Transform* transform;
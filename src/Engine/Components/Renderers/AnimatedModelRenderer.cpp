@@ -1,13 +1,17 @@
 #include "AnimatedModelRenderer.h"
 #include "Engine/EngineObjects/CameraRenderData.h"
 #include "Engine/EngineObjects/LightManager.h"
+#include "Engine/EngineObjects/RenderingManager.h"
+#include "Engine/Rendering/Frustum.h"
 #include "ModelRenderer.h"
 #include "Models/ModelAnimated.h"
 #include "Models/Animator.h"
+#include "Serialization/Reflection.h"
 #if EDITOR
 #include "Materials/MaterialManager.h"
 #include "Materials/Material.h"
 #include "Models/ModelManager.h"
+#include "Models/AnimationCompressor.h"
 #include "imgui.h"
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -27,7 +31,7 @@ namespace Engine
     void AnimatedModelRenderer::Start()
     {
         Renderer::Start();
-        UpdateManager::GetInstance()->RegisterComponent(this);
+        UpdateManager::GetInstance()->RegisterComponent(this, UpdatePhase::Animation);
     }
 
     void AnimatedModelRenderer::RenderDepth(const CameraRenderData& RenderData)
@@ -89,11 +93,10 @@ namespace Engine
         Shader.SetUniform("ViewMatrix", RenderData.ViewMatrix);
         Shader.SetUniform("ProjectionMatrix", RenderData.ProjectionMatrix);
         Shader.SetUniform("ObjectToWorldMatrix", GetOwner()->GetTransform()->GetLocalToWorldMatrix());
-        std::vector<glm::mat4> transforms = Animator.GetFinalBoneMatrices();
+        const std::vector<glm::mat4>& transforms = Animator.GetFinalBoneMatrices();
         for (int i = 0; i < transforms.size(); ++i)
         {
-            glm::mat4 transform = transforms[i];
-            Shader.SetUniform(("finalBonesMatrices[" + std::to_string(i) + "]").c_str(), transform);
+            Shader.SetUniform(("finalBonesMatrices[" + std::to_string(i) + "]").c_str(), transforms[i]);
         }
     }
 
@@ -109,6 +112,14 @@ namespace Engine
     {
         if (ImGui::CollapsingHeader("Animated Model Renderer", ImGuiTreeNodeFlags_DefaultOpen))
         {
+            ImGui::Checkbox("Animation LOD", &AnimationLod);
+            ImGui::SameLine();
+            ImGui::Checkbox("Enabled globally", &LodEnabled);
+            ImGui::DragFloat("Reduced Rate Distance", &ReducedRateDistance, 0.5f, 0.0f, 1000.0f);
+            ImGui::DragFloat("Minimum Rate Distance", &MinimumRateDistance, 0.5f, 0.0f, 1000.0f);
+            ImGui::DragFloat("Leaf Pruning Distance", &LeafPruningDistance, 0.5f, 0.0f, 1000.0f);
+            ImGui::Separator();
+
             static bool showMaterialPopup = false;
             static bool showModelPopup = false;
             static bool showAnimationPopup = false;
@@ -323,35 +334,102 @@ namespace Engine
                 }
                 ImGui::EndPopup();
             }
+
+            if (Animation)
+            {
+                ImGui::Text("Animation keys: %zu bytes", Animation->GetMemoryUsage());
+                if (!Animation->IsCompressed() && ImGui::Button("Compress Animation"))
+                {
+                    fs::path outputPath(Animation->GetPath());
+                    outputPath.replace_extension(Models::AnimationCompressor::FileExtension);
+                    if (Models::AnimationCompressor::CompressToFile(*Animation, outputPath.string()))
+                    {
+                        Animation = Models::ModelManager::GetAnimation(outputPath.string().c_str());
+                        Animator = Models::Animator(Animation);
+                    }
+                }
+            }
         }
     }
 #endif
-    rapidjson::Value AnimatedModelRenderer::Serialize(rapidjson::Document::AllocatorType& Allocator) const
+
+    SERIALIZATION_FIELDS(AnimatedModelRenderer,
+                         SERIALIZATION_FIELD(Material),
+                         SERIALIZATION_FIELD(Model),
+                         SERIALIZATION_FIELD(Animation),
+                         SERIALIZATION_FIELD(AnimationLod),
+                         SERIALIZATION_FIELD(ReducedRateDistance),
+                         SERIALIZATION_FIELD(MinimumRateDistance),
+                         SERIALIZATION_FIELD(LeafPruningDistance))
+
+    void AnimatedModelRenderer::OnReferencesResolved()
     {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Material)
-        SERIALIZE_FIELD(Model)
-        SERIALIZE_FIELD(Animation)
-        END_COMPONENT_SERIALIZATION
+        /*animation is assigned only after the value pass when it runs on a worker thread*/
+        Animator = Models::Animator(Animation);
     }
 
-    void AnimatedModelRenderer::DeserializeValuePass(const rapidjson::Value& Object,
-                                                     Serialization::ReferenceTable& ReferenceMap)
+    void AnimatedModelRenderer::Update(float DeltaTime)
     {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Material)
-        DESERIALIZE_VALUE(Model)
-        DESERIALIZE_VALUE(Animation)
-        Animator = Models::Animator(Animation);
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
+        if (Model == nullptr || Animation == nullptr)
+        {
+            return;
+        }
+
+        /*without a RenderingManager there is no camera to cull against or measure distance to*/
+        if (!LodEnabled || !AnimationLod || RenderingManager::GetInstance() == nullptr)
+        {
+            Animator.SetUpdateInterval(1);
+            Animator.SetLeafBonePruning(0);
+            Animator.UpdateAnimation(DeltaTime);
+            return;
+        }
+
+        const RenderingManager* renderingManager = RenderingManager::GetInstance();
+        UpdateLevelOfDetail(DeltaTime, GetOwner()->GetTransform()->GetLocalToWorldMatrix(),
+                            renderingManager->GetFrustum(), renderingManager->GetCameraPosition());
     }
 
-    void AnimatedModelRenderer::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                          Serialization::ReferenceTable& ReferenceMap)
+    void AnimatedModelRenderer::UpdateLevelOfDetail(const float DeltaTime, const glm::mat4& ObjectToWorldMatrix,
+                                                    const Frustum& Frustum, const glm::vec3& CameraPosition)
     {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
+        if (!IsVisible(ObjectToWorldMatrix, Frustum))
+        {
+            // Off-screen animators keep their playback position but do not evaluate bones.
+            Animator.AdvanceTime(DeltaTime);
+            return;
+        }
+
+        SetLevelOfDetail(glm::distance(CameraPosition, glm::vec3(ObjectToWorldMatrix[3])));
+        Animator.UpdateAnimation(DeltaTime);
     }
 
-    void AnimatedModelRenderer::Update(float DeltaTime) { Animator.UpdateAnimation(DeltaTime); }
+    void AnimatedModelRenderer::SetLevelOfDetail(const float Distance)
+    {
+        if (Distance >= MinimumRateDistance)
+        {
+            Animator.SetUpdateInterval(4);
+        }
+        else if (Distance >= ReducedRateDistance)
+        {
+            Animator.SetUpdateInterval(2);
+        }
+        else
+        {
+            Animator.SetUpdateInterval(1);
+        }
+
+        Animator.SetLeafBonePruning(Distance >= LeafPruningDistance ? 1 : 0);
+    }
+
+    bool AnimatedModelRenderer::IsVisible(const glm::mat4& ObjectToWorldMatrix, const Frustum& Frustum) const
+    {
+        for (int i = 0; i < Model->GetMeshCount(); ++i)
+        {
+            if (Frustum.IsBoxVisible(Model->GetMesh(i)->GetAabBox(), ObjectToWorldMatrix))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 }
@@ -12,6 +12,8 @@
 
 namespace Engine
 {
+    class Frustum;
+
     /**
      * @brief Renderer used for rendering meshes.
      */
@@ -25,6 +27,17 @@ namespace Engine
         float deltaTime = 0.0f;
         float lastFrame = 0.0f;
 
+        bool AnimationLod = true;
+        float ReducedRateDistance = 20.0f;
+        float MinimumRateDistance = 40.0f;
+        float LeafPruningDistance = 30.0f;
+
+    public:
+        /**
+         * @brief Global switch for animation level of detail, used to compare animation cost with and without it.
+         */
+        static inline bool LodEnabled = true;
+
     public:
         /**
          * @brief
@@ -42,7 +55,7 @@ namespace Engine
          */
         [[nodiscard]] Models::ModelAnimated* GetModel() const { return Model; }
         [[nodiscard]] Models::Animation* GetAnimation() const { return Animation; }
-        [[nodiscard]] Models::Animator GetAnimator() const { return Animator; }
+        [[nodiscard]] Models::Animator* GetAnimator() { return &Animator; }
 
         /**
          * @brief Sets model used by this renderer.
@@ -55,6 +68,8 @@ namespace Engine
     public:
         void Start() override;
 
+        void OnReferencesResolved() override;
+
         void RenderDepth(const CameraRenderData& RenderData) override;
 
         void Render(const CameraRenderData& RenderData) override;
@@ -66,13 +81,27 @@ namespace Engine
 
         void Update(float DeltaTime) override;
 
+        /**
+         * @brief Advances the animation, bones are evaluated at a rate chosen by distance to the camera and not
+         * at all when the model is outside of the camera's frustum. Update calls it with the main camera.
+         */
+        void UpdateLevelOfDetail(float DeltaTime, const glm::mat4& ObjectToWorldMatrix, const Frustum& Frustum,
+                                 const glm::vec3& CameraPosition);
+
+        /**
+         * @brief Returns whether any mesh of the model placed at ObjectToWorldMatrix intersects the frustum.
+         */
+        [[nodiscard]] bool IsVisible(const glm::mat4& ObjectToWorldMatrix, const Frustum& Frustum) const;
+
     private:
+        void SetLevelOfDetail(float Distance);
+
         void SetupMatrices(const CameraRenderData& RenderData, const Shaders::Shader& Shader) const;
 
         void Draw() const;
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(AnimatedModelRenderer)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(AnimatedModelRenderer)
     };
 } // namespace Engine
@@ -2,6 +2,7 @@
 #include "Engine/EngineObjects/LightManager.h"
 #include "Engine/EngineObjects/CameraRenderData.h"
 #include "Engine/EngineObjects/RenderingManager.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Materials/MaterialManager.h"
 #include "Materials/Material.h"
@@ -294,29 +295,8 @@ namespace Engine
     }
 #endif
 
-    rapidjson::Value ModelRenderer::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Material)
-        SERIALIZE_FIELD(Model)
-        SERIALIZE_FIELD(CastShadow)
-        END_COMPONENT_SERIALIZATION
-    }
-
-    void ModelRenderer::DeserializeValuePass(const rapidjson::Value& Object,
-                                             Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Material)
-        DESERIALIZE_VALUE(Model)
-        DESERIALIZE_VALUE(CastShadow)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void ModelRenderer::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                  Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(ModelRenderer,
+                         SERIALIZATION_FIELD(Material),
+                         SERIALIZATION_FIELD(Model),
+                         SERIALIZATION_FIELD(CastShadow))
 } // Engine
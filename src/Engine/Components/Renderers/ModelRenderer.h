@@ -75,6 +75,6 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(ModelRenderer)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(ModelRenderer)
     };
 } // Engine
@@ -2,13 +2,16 @@
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/EngineObjects/UpdateManager.h"
 #include "Engine/EngineObjects/LightManager.h"
+#include "Engine/EngineObjects/Simulation.h"
 #include <algorithm>
 #include <imgui.h>
 #include <glm/gtc/type_ptr.hpp>
-#include <GLFW/glfw3.h>
 
 #include "Engine/EngineObjects/RenderingManager.h"
+#include "Engine/Rendering/GraphicsContext.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 Engine::ParticleEmitter::ParticleEmitter(Materials::Material* const Material, const Shaders::ComputeShader& SpawnShader,
                                          const Shaders::ComputeShader& UpdateShader,
@@ -30,6 +33,7 @@ void Engine::ParticleEmitter::Render(const Engine::CameraRenderData& RenderData)
     {
         Models::Mesh* mesh = Settings.Model->GetMesh(i);
         glBindVertexArray(mesh->GetVertexArray());
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawArraysInstanced(GL_TRIANGLES, 0, mesh->GetFaceCount(), MaxParticleCount);
         glBindVertexArray(0);
     }
@@ -41,17 +45,26 @@ void Engine::ParticleEmitter::SetMaterial(Materials::Material* Material)
     {
         return;
     }
-    RenderingManager::GetInstance()->UnregisterParticleEmitter(this);
+    RenderingManager* const renderingManager = RenderingManager::GetInstance();
+    if (renderingManager != nullptr)
+    {
+        renderingManager->UnregisterParticleEmitter(this);
+    }
     this->Material = Material;
-    if (Material == nullptr)
+    if (Material == nullptr || renderingManager == nullptr)
     {
         return;
     }
-    RenderingManager::GetInstance()->RegisterParticleEmitter(this);
+    renderingManager->RegisterParticleEmitter(this);
 }
 
 void Engine::ParticleEmitter::Start()
 {
+    /*particles are simulated by compute shaders, so without an OpenGL context there's nothing to do*/
+    if (!GraphicsContext::IsAvailable())
+    {
+        return;
+    }
     if (Material != nullptr)
     {
         RenderingManager::GetInstance()->RegisterParticleEmitter(this);
@@ -62,6 +75,7 @@ void Engine::ParticleEmitter::Start()
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, ParticlesBuffer);
 
     const Particle* particles = new Particle[MaxParticleCount]{};
+    TELEMETRY_COUNT(BytesUploaded, MaxParticleCount * sizeof(Particle));
     glBufferData(GL_SHADER_STORAGE_BUFFER, MaxParticleCount * sizeof(Particle), particles, GL_DYNAMIC_DRAW);
     delete[] particles;
 
@@ -72,6 +86,7 @@ void Engine::ParticleEmitter::Start()
     {
         freeList[i] = i - 1;
     }
+    TELEMETRY_COUNT(BytesUploaded, (MaxParticleCount + 1) * sizeof(int));
     glBufferData(GL_SHADER_STORAGE_BUFFER, (MaxParticleCount + 1) * sizeof(int), freeList, GL_DYNAMIC_DRAW);
     delete[] freeList;
 
@@ -97,7 +112,7 @@ void Engine::ParticleEmitter::DispatchSpawnShaders(const float DeltaTime)
         const int workGroupsCount = (particlesToSpawn + workGroupSize - 1) / workGroupSize;
 
         Shaders::ComputeShader::SetUniform(ParticlesToSpawnProperty, particlesToSpawn);
-        float time = static_cast<float>(glfwGetTime());
+        float time = static_cast<float>(Simulation::GetTime());
         Shaders::ComputeShader::SetUniform(RandomProperty, *reinterpret_cast<unsigned int*>(&time));
 
         Shaders::ComputeShader::Dispatch(glm::ivec3(workGroupsCount, 1, 1));
@@ -181,63 +196,33 @@ void Engine::ParticleEmitter::DrawImGui()
     }
 }
 #endif
-rapidjson::Value Engine::ParticleEmitter::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-{
-    START_COMPONENT_SERIALIZATION
-    SERIALIZE_FIELD(MaxParticleCount)
-    SERIALIZE_FIELD(Settings.SpawnRate)
-    SERIALIZE_FIELD(Settings.Model)
-    SERIALIZE_FIELD(Settings.MinColor)
-    SERIALIZE_FIELD(Settings.MaxColor)
-    SERIALIZE_FIELD(Settings.MinOffset)
-    SERIALIZE_FIELD(Settings.MaxOffset)
-    SERIALIZE_FIELD(Settings.MinVelocity)
-    SERIALIZE_FIELD(Settings.MaxVelocity)
-    SERIALIZE_FIELD(Settings.MinScale)
-    SERIALIZE_FIELD(Settings.MaxScale)
-    SERIALIZE_FIELD(Settings.MinAccel)
-    SERIALIZE_FIELD(Settings.MaxAccel)
-    SERIALIZE_FIELD(Settings.MinLife)
-    SERIALIZE_FIELD(Settings.MaxLife)
-    SERIALIZE_FIELD(Material)
-    SERIALIZE_FIELD(SpawnShader)
-    SERIALIZE_FIELD(UpdateShader)
-    END_COMPONENT_SERIALIZATION
-}
 
-void Engine::ParticleEmitter::DeserializeValuePass(const rapidjson::Value& Object,
-                                                   Serialization::ReferenceTable& ReferenceMap)
+SERIALIZATION_FIELDS(Engine::ParticleEmitter,
+                     SERIALIZATION_FIELD(MaxParticleCount),
+                     SERIALIZATION_FIELD(Settings.SpawnRate),
+                     SERIALIZATION_FIELD(Settings.Model),
+                     SERIALIZATION_FIELD(Settings.MinColor),
+                     SERIALIZATION_FIELD(Settings.MaxColor),
+                     SERIALIZATION_FIELD(Settings.MinOffset),
+                     SERIALIZATION_FIELD(Settings.MaxOffset),
+                     SERIALIZATION_FIELD(Settings.MinVelocity),
+                     SERIALIZATION_FIELD(Settings.MaxVelocity),
+                     SERIALIZATION_FIELD(Settings.MinScale),
+                     SERIALIZATION_FIELD(Settings.MaxScale),
+                     SERIALIZATION_FIELD(Settings.MinAccel),
+                     SERIALIZATION_FIELD(Settings.MaxAccel),
+                     SERIALIZATION_FIELD(Settings.MinLife),
+                     SERIALIZATION_FIELD(Settings.MaxLife),
+                     SERIALIZATION_FIELD(Material),
+                     SERIALIZATION_FIELD(SpawnShader),
+                     SERIALIZATION_FIELD(UpdateShader))
+
+void Engine::ParticleEmitter::OnReferencesResolved()
 {
-    START_COMPONENT_DESERIALIZATION_VALUE_PASS
-    DESERIALIZE_VALUE(MaxParticleCount)
-    DESERIALIZE_VALUE(Settings.SpawnRate)
-    DESERIALIZE_VALUE(Settings.Model)
-    DESERIALIZE_VALUE(Settings.MinColor)
-    DESERIALIZE_VALUE(Settings.MaxColor)
-    DESERIALIZE_VALUE(Settings.MinOffset)
-    DESERIALIZE_VALUE(Settings.MaxOffset)
-    DESERIALIZE_VALUE(Settings.MinVelocity)
-    DESERIALIZE_VALUE(Settings.MaxVelocity)
-    DESERIALIZE_VALUE(Settings.MinScale)
-    DESERIALIZE_VALUE(Settings.MaxScale)
-    DESERIALIZE_VALUE(Settings.MinAccel)
-    DESERIALIZE_VALUE(Settings.MaxAccel)
-    DESERIALIZE_VALUE(Settings.MinLife)
-    DESERIALIZE_VALUE(Settings.MaxLife)
-    DESERIALIZE_VALUE(Material)
-    DESERIALIZE_VALUE(SpawnShader)
-    DESERIALIZE_VALUE(UpdateShader)
+    /*shaders are assigned only after the value pass when it runs on a worker thread*/
     ParticlesToSpawnProperty = SpawnShader.GetUniformLocation("ParticlesToSpawn");
     RandomProperty = SpawnShader.GetUniformLocation("Random");
     DeltaTimeProperty = UpdateShader.GetUniformLocation("DeltaTime");
-    END_COMPONENT_DESERIALIZATION_VALUE_PASS
-}
-
-void Engine::ParticleEmitter::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                        Serialization::ReferenceTable& ReferenceMap)
-{
-    START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
 }
 
 Engine::ParticleEmitter::EmitterSettings::EmitterSettings(const float SpawnRate, Models::Model* Model,
@@ -124,6 +124,8 @@ namespace Engine
 
         void Start() override;
 
+        void OnReferencesResolved() override;
+
         void DispatchSpawnShaders(float DeltaTime);
 
         void DispatchUpdateShaders(float DeltaTime);
@@ -137,6 +139,6 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(ParticleEmitter)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(ParticleEmitter)
     };
 }
@@ -6,11 +6,13 @@ namespace Engine
     void Renderer::Start()
     {
         Component::Start();
-        if (Material == nullptr)
+        /*nothing is rendered without an OpenGL context, so there is no RenderingManager to register with*/
+        RenderingManager* const renderingManager = RenderingManager::GetInstance();
+        if (Material == nullptr || renderingManager == nullptr)
         {
             return;
         }
-        RenderingManager::GetInstance()->RegisterRenderer(this);
+        renderingManager->RegisterRenderer(this);
     }
 
     void Renderer::SetMaterial(Materials::Material* const Material)
@@ -19,24 +21,26 @@ namespace Engine
         {
             return;
         }
-        if (this->Material != nullptr)
+        RenderingManager* const renderingManager = RenderingManager::GetInstance();
+        if (this->Material != nullptr && renderingManager != nullptr)
         {
-            RenderingManager::GetInstance()->UnregisterRenderer(this);
+            renderingManager->UnregisterRenderer(this);
         }
         this->Material = Material;
-        if (Material == nullptr)
+        if (Material == nullptr || renderingManager == nullptr)
         {
             return;
         }
-        RenderingManager::GetInstance()->RegisterRenderer(this);
+        renderingManager->RegisterRenderer(this);
     }
 
     Renderer::~Renderer()
     {
-        if (Material == nullptr)
+        RenderingManager* const renderingManager = RenderingManager::GetInstance();
+        if (Material == nullptr || renderingManager == nullptr)
         {
             return;
         }
-        RenderingManager::GetInstance()->UnregisterRenderer(this);
+        renderingManager->UnregisterRenderer(this);
     }
 } // Engine
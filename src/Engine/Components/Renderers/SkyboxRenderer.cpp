@@ -1,5 +1,6 @@
 #include "SkyboxRenderer.h"
 
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/Entity.h"
 
@@ -145,25 +146,7 @@ namespace Engine
         }
     }
 # endif
-    rapidjson::Value SkyboxRenderer::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Material)
-        END_COMPONENT_SERIALIZATION
-    }
 
-    void SkyboxRenderer::DeserializeValuePass(const rapidjson::Value& Object,
-                                              Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Material)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void SkyboxRenderer::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                   Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(SkyboxRenderer,
+                         SERIALIZATION_FIELD(Material))
 } // Engine
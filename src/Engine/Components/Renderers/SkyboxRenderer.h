@@ -29,7 +29,7 @@ namespace Engine
         void DrawImGui() override;
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(SkyboxRenderer);
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(SkyboxRenderer);
     };
 
 } // Engine
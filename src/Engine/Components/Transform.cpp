@@ -1,8 +1,10 @@
 #include "Transform.h"
 
+#include <cassert>
 #include <glm/gtx/quaternion.hpp>
 
 #include "Engine/EngineObjects/Entity.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "glm/gtc/quaternion.hpp"
 
@@ -10,6 +12,7 @@ namespace Engine
 {
     Transform::~Transform()
     {
+        Detach();
         if (Parent)
         {
             Parent->RemoveChild(this);
@@ -33,7 +36,7 @@ namespace Engine
             }
 
             // Editable Euler Angles
-            glm::vec3 tmpEuler = EulerAngles;
+            glm::vec3 tmpEuler = GetEulerAngles();
             if (ImGui::DragFloat3("Rotation (Euler)", glm::value_ptr(tmpEuler), 0.5f))
             {
                 SetEulerAngles(tmpEuler);
@@ -79,69 +82,196 @@ namespace Engine
 
     void Transform::MarkDirty()
     {
+        MarkOwnerModified();
+        if (TransformHierarchy* hierarchy = GetHierarchy())
         {
-            IsDirty = true;
-            for (Transform* child : Children)
-            {
-                child->MarkDirty();
-            }
+            /*the hierarchy finds descendants by their modified ancestor, cached matrices are invalidated per node*/
+            hierarchy->SetLocal(Node, Position, Rotation, Scale);
         }
+        MarkMatricesDirty();
     }
 
-    void Transform::UpdateMatrices()
+    void Transform::MarkMatricesDirty()
     {
-        if (!IsDirty)
+        /*a transform is only cleaned after its parent, so descendants of a dirty transform are already dirty*/
+        if (IsDirty)
         {
             return;
         }
-        LocalMatrix = glm::mat4(1.0f);
-
-        LocalMatrix = glm::translate(LocalMatrix, Position);
+        IsDirty = true;
+        for (Transform* child : Children)
+        {
+            child->MarkMatricesDirty();
+        }
+    }
 
-        LocalMatrix *= glm::toMat4(Rotation);
+    void Transform::MarkOwnerModified()
+    {
+        /*local state is serialized with the owner, world matrices aren't*/
+        if (Owner != nullptr)
+        {
+            Owner->MarkModified();
+        }
+    }
 
-        LocalMatrix = glm::scale(LocalMatrix, Scale);
+    void Transform::UpdateMatrices()
+    {
+        /*only modified transforms and their descendants are recalculated before the next hierarchy update*/
+        if (!IsDirty)
+        {
+            return;
+        }
+        LocalMatrix = TransformHierarchy::CalculateLocalMatrix(Position, Rotation, Scale);
+        const glm::mat4 localInverse = TransformHierarchy::CalculateInverseLocalMatrix(Position, Rotation, Scale);
 
         if (Parent)
         {
             LocalToWorldMatrix = Parent->GetLocalToWorldMatrix() * LocalMatrix;
+            WorldToLocalMatrix = localInverse * Parent->GetWorldToLocalMatrix();
         }
         else
         {
             LocalToWorldMatrix = LocalMatrix;
+            WorldToLocalMatrix = localInverse;
         }
 
         IsDirty = false;
     }
 
+    TransformHierarchy* Transform::GetHierarchy()
+    {
+        if (Hierarchy == nullptr && Parent != nullptr)
+        {
+            if (TransformHierarchy* hierarchy = Parent->GetHierarchy())
+            {
+                Hierarchy = hierarchy;
+                Node = Hierarchy->Create(Parent->Node);
+                Hierarchy->SetLocal(Node, Position, Rotation, Scale);
+            }
+        }
+        return Hierarchy;
+    }
+
+    void Transform::SetHierarchy(TransformHierarchy* const InHierarchy)
+    {
+        Detach();
+        if (InHierarchy != nullptr)
+        {
+            Hierarchy = InHierarchy;
+            Node = Hierarchy->Create();
+            Hierarchy->SetLocal(Node, Position, Rotation, Scale);
+        }
+    }
+
+    void Transform::OnParentChanged()
+    {
+        if (Hierarchy != nullptr && Parent != nullptr && Parent->GetHierarchy() == Hierarchy)
+        {
+            Hierarchy->SetParent(Node, Parent->Node);
+        }
+        else
+        {
+            /*it's stored again once used under a stored parent*/
+            Detach();
+        }
+        MarkDirty();
+    }
+
+    void Transform::Detach()
+    {
+        if (Hierarchy != nullptr)
+        {
+            /*descendants are removed from the storage with their ancestor*/
+            Hierarchy->Destroy(Node);
+            ClearHierarchy();
+        }
+    }
+
+    void Transform::ClearHierarchy()
+    {
+        /*parents are always stored before their children, so descendants of an unstored transform aren't stored*/
+        if (Hierarchy == nullptr)
+        {
+            return;
+        }
+        Hierarchy = nullptr;
+        Node = TransformHierarchy::InvalidHandle;
+        IsDirty = true;
+        for (Transform* child : Children)
+        {
+            child->ClearHierarchy();
+        }
+    }
+
+    void Transform::TransformPositionsWorldToLocal(const std::span<const glm::vec3> Positions,
+                                                   const std::span<glm::vec3> Destination)
+    {
+        assert(Destination.size() >= Positions.size());
+        const glm::mat4& matrix = GetWorldToLocalMatrix();
+        for (size_t i = 0; i < Positions.size(); ++i)
+        {
+            Destination[i] = glm::vec3(matrix * glm::vec4(Positions[i], 1.0f));
+        }
+    }
+
+    void Transform::TransformPositionsLocalToWorld(const std::span<const glm::vec3> Positions,
+                                                   const std::span<glm::vec3> Destination)
+    {
+        assert(Destination.size() >= Positions.size());
+        const glm::mat4& matrix = GetLocalToWorldMatrix();
+        for (size_t i = 0; i < Positions.size(); ++i)
+        {
+            Destination[i] = glm::vec3(matrix * glm::vec4(Positions[i], 1.0f));
+        }
+    }
+
+    void Transform::TransformDirectionsWorldToLocal(const std::span<const glm::vec3> Directions,
+                                                    const std::span<glm::vec3> Destination)
+    {
+        assert(Destination.size() >= Directions.size());
+        const glm::mat3 matrix = glm::mat3(GetWorldToLocalMatrix());
+        for (size_t i = 0; i < Directions.size(); ++i)
+        {
+            Destination[i] = glm::normalize(matrix * Directions[i]);
+        }
+    }
+
+    void Transform::TransformDirectionsLocalToWorld(const std::span<const glm::vec3> Directions,
+                                                    const std::span<glm::vec3> Destination)
+    {
+        assert(Destination.size() >= Directions.size());
+        const glm::mat3 matrix = glm::mat3(GetLocalToWorldMatrix());
+        for (size_t i = 0; i < Directions.size(); ++i)
+        {
+            Destination[i] = glm::normalize(matrix * Directions[i]);
+        }
+    }
+
+    SERIALIZATION_REFLECTION(Transform,
+                             SERIALIZATION_FIELD(Position),
+                             SERIALIZATION_FIELD(EulerAngles),
+                             SERIALIZATION_FIELD(Scale),
+                             SERIALIZATION_FIELD(Rotation),
+                             SERIALIZATION_REFERENCE(Children),
+                             SERIALIZATION_REFERENCE(Parent))
+
     rapidjson::Value Transform::Serialize(rapidjson::Document::AllocatorType& Allocator) const
     {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Position)
-        SERIALIZE_FIELD(EulerAngles)
-        SERIALIZE_FIELD(Scale)
-        SERIALIZE_FIELD(Rotation)
-        SERIALIZE_FIELD(Children)
-        SERIALIZE_FIELD(Parent)
-        END_COMPONENT_SERIALIZATION
+        /*euler angles are only updated when they're read*/
+        UpdateEulerAngles();
+        return Serialization::WriteObject(*this, GetOwner(), Allocator);
     }
 
     void Transform::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
     {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Position)
-        DESERIALIZE_VALUE(EulerAngles)
-        DESERIALIZE_VALUE(Scale)
-        DESERIALIZE_VALUE(Rotation)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
+        Serialization::ReadObjectValues(Object, *this, ReferenceMap);
     }
 
     void Transform::DeserializeReferencesPass(const rapidjson::Value& Object,
                                               Serialization::ReferenceTable& ReferenceMap)
     {
         START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        DESERIALIZE_POINTER(Children)
-        DESERIALIZE_POINTER(Parent)
+        Serialization::ReadReferences(Object, GetReflectedFields(), GetStaticReflection(), ReferenceMap);
         END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
+#include <span>
 #include <vector>
 
+#include "Engine/EngineObjects/TransformHierarchy.h"
 #include "Serialization/SerializedObject.h"
 #include "glm/glm.hpp"
 #include "glm/gtc/type_ptr.hpp"
@@ -16,6 +18,9 @@ namespace Engine
 
     /**
      * @brief Position, rotation and scale of an entity.
+     * Transforms of a scene are mirrored in its TransformHierarchy, which updates world matrices of all of them
+     * once per frame. Matrices read from a transform are cached by it and only recalculated after it or one of its
+     * ancestors was modified, so reading them between modifications of other transforms stays cheap.
      */
     class Transform final : public Serialization::SerializedObject
     {
@@ -23,19 +28,26 @@ namespace Engine
 
     private:
         glm::vec3 Position = glm::vec3(0.0f, 0.0f, 0.0f);
-        glm::vec3 EulerAngles = glm::vec3(0.0f, 0.0f, 0.0f);
+        mutable glm::vec3 EulerAngles = glm::vec3(0.0f, 0.0f, 0.0f);
         glm::vec3 Scale = glm::vec3(1.0f, 1.0f, 1.0f);
         glm::quat Rotation = glm::quat();
 
         glm::mat4 LocalMatrix = glm::mat4(1.0f);
         glm::mat4 LocalToWorldMatrix = glm::mat4(1.0f);
+        glm::mat4 WorldToLocalMatrix = glm::mat4(1.0f);
         bool IsDirty = true;
+        /*euler angles are only derived from rotation when read*/
+        mutable bool AreEulerAnglesDirty = false;
 
     private:
         Transform* Parent = nullptr;
         Entity* Owner = nullptr;
         std::vector<Transform*> Children = std::vector<Transform*>();
 
+        /*storage of the scene, nullptr until this transform is used under a transform stored in it*/
+        TransformHierarchy* Hierarchy = nullptr;
+        TransformHierarchy::Handle Node = TransformHierarchy::InvalidHandle;
+
     public:
         /**
          * @brief Initializes Transform with default values.
@@ -60,7 +72,7 @@ namespace Engine
          */
         [[nodiscard]] glm::vec3 GetPositionWorldSpace()
         {
-            return GetLocalToWorldMatrix() * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            return glm::vec3(GetLocalToWorldMatrix()[3]);
         }
 
         /**
@@ -87,7 +99,7 @@ namespace Engine
         {
             if (Parent != nullptr)
             {
-                Position = glm::vec3(glm::inverse(Parent->GetLocalToWorldMatrix()) * glm::vec4(InPosition, 1.0f));
+                Position = glm::vec3(Parent->GetWorldToLocalMatrix() * glm::vec4(InPosition, 1.0f));
             }
             else
             {
@@ -104,7 +116,7 @@ namespace Engine
         {
             if (Parent != nullptr)
             {
-                Position = glm::vec3(glm::inverse(Parent->GetLocalToWorldMatrix()) * glm::vec4(InPosition, 1.0f));
+                Position = glm::vec3(Parent->GetWorldToLocalMatrix() * glm::vec4(InPosition, 1.0f));
             }
             else
             {
@@ -128,6 +140,7 @@ namespace Engine
          */
         [[nodiscard]] const glm::vec3& GetEulerAngles() const
         {
+            UpdateEulerAngles();
             return EulerAngles;
         }
 
@@ -138,6 +151,7 @@ namespace Engine
         void SetEulerAngles(const glm::vec3& EulerAngles)
         {
             this->EulerAngles = EulerAngles;
+            AreEulerAnglesDirty = false;
             Rotation = glm::quat(glm::radians(EulerAngles));
             MarkDirty();
         }
@@ -157,7 +171,7 @@ namespace Engine
         void SetRotation(const glm::quat& Rotation)
         {
             this->Rotation = Rotation;
-            EulerAngles = glm::degrees(glm::eulerAngles(Rotation));
+            AreEulerAnglesDirty = true;
             MarkDirty();
         }
 
@@ -186,7 +200,7 @@ namespace Engine
          */
         [[nodiscard]] glm::vec3 TransformPositionWorldToLocal(const glm::vec3& Position)
         {
-            return glm::vec3(glm::inverse(GetLocalToWorldMatrix()) * glm::vec4(Position, 1.0f));
+            return glm::vec3(GetWorldToLocalMatrix() * glm::vec4(Position, 1.0f));
         }
 
         /**
@@ -206,7 +220,7 @@ namespace Engine
          */
         [[nodiscard]] glm::vec3 TransformDirectionWorldToLocal(const glm::vec3& Direction)
         {
-            return glm::normalize(glm::vec3(glm::inverse(GetLocalToWorldMatrix()) * glm::vec4(Direction, 0.0f)));
+            return glm::normalize(glm::vec3(GetWorldToLocalMatrix() * glm::vec4(Direction, 0.0f)));
         }
 
         /**
@@ -219,6 +233,34 @@ namespace Engine
             return glm::normalize(glm::vec3(GetLocalToWorldMatrix() * glm::vec4(Direction, 0.0f)));
         }
 
+        /**
+         * @brief Transforms positions from world space to local space.
+         * @param Positions Positions in world space.
+         * @param Destination Positions in local space, has to be at least as long as Positions. May alias Positions.
+         */
+        void TransformPositionsWorldToLocal(std::span<const glm::vec3> Positions, std::span<glm::vec3> Destination);
+
+        /**
+         * @brief Transforms positions from local space to world space.
+         * @param Positions Positions in local space.
+         * @param Destination Positions in world space, has to be at least as long as Positions. May alias Positions.
+         */
+        void TransformPositionsLocalToWorld(std::span<const glm::vec3> Positions, std::span<glm::vec3> Destination);
+
+        /**
+         * @brief Transforms directions from world space to local space.
+         * @param Directions Directions in world space.
+         * @param Destination Normalized directions in local space. May alias Directions.
+         */
+        void TransformDirectionsWorldToLocal(std::span<const glm::vec3> Directions, std::span<glm::vec3> Destination);
+
+        /**
+         * @brief Transforms directions from local space to world space.
+         * @param Directions Directions in local space.
+         * @param Destination Normalized directions in world space. May alias Directions.
+         */
+        void TransformDirectionsLocalToWorld(std::span<const glm::vec3> Directions, std::span<glm::vec3> Destination);
+
         /**
          * @brief Returns Entity owning this transform
          */
@@ -232,7 +274,7 @@ namespace Engine
          */
         const glm::mat4& GetLocalMatrix()
         {
-            UpdateMatrices();
+            LocalMatrix = TransformHierarchy::CalculateLocalMatrix(Position, Rotation, Scale);
             return LocalMatrix;
         }
 
@@ -245,6 +287,15 @@ namespace Engine
             return LocalToWorldMatrix;
         }
 
+        /**
+         * @brief Returns world to local space transformation matrix.
+         */
+        const glm::mat4& GetWorldToLocalMatrix()
+        {
+            UpdateMatrices();
+            return WorldToLocalMatrix;
+        }
+
         /**
          * @brief Returns right orientation vector of this transform.
          */
@@ -300,13 +351,7 @@ namespace Engine
          */
         void SetParent(Transform* InParent)
         {
-            if (Parent != nullptr)
-            {
-                Parent->RemoveChild(this);
-            }
-            Parent = InParent;
-            Parent->AddChild(this);
-            MarkDirty();
+            InParent->AddChild(this);
         }
 
         /**
@@ -325,11 +370,12 @@ namespace Engine
         {
             if (Child->Parent != nullptr)
             {
-                Child->Parent->RemoveChild(Child);
+                Child->Parent->EraseChild(Child);
             }
             Child->Parent = this;
-            Child->MarkDirty();
             Children.push_back(Child);
+            Child->OnParentChanged();
+            MarkOwnerModified();
         }
 
         /**
@@ -338,10 +384,10 @@ namespace Engine
          */
         void RemoveChild(Transform* Child)
         {
-            if (std::erase(Children, Child))
+            if (EraseChild(Child))
             {
                 Child->Parent = nullptr;
-                Child->MarkDirty();
+                Child->OnParentChanged();
             }
         }
 
@@ -353,6 +399,12 @@ namespace Engine
             return Children;
         }
 
+        /**
+         * @brief Stores this transform in a hierarchy as one of its roots, descendants are stored once used.
+         * @param InHierarchy Hierarchy of the scene this transform is the root of, nullptr to remove it from one.
+         */
+        void SetHierarchy(TransformHierarchy* InHierarchy);
+
     private:
         void SetOwner(Entity* const InOwner)
         {
@@ -360,10 +412,54 @@ namespace Engine
         }
 
     private:
+        /**
+         * @brief Marks local state as changed, matrices of this transform and its descendants are updated on use.
+         */
         void MarkDirty();
 
+        void MarkMatricesDirty();
+
+        void MarkOwnerModified();
+
         void UpdateMatrices();
 
+        /**
+         * @brief Returns hierarchy this transform is stored in, stores it in the hierarchy of its parent if needed.
+         */
+        TransformHierarchy* GetHierarchy();
+
+        /**
+         * @brief Moves the node of this transform to the node of the new parent if both are in the same hierarchy,
+         * otherwise the transform is removed from its hierarchy.
+         */
+        void OnParentChanged();
+
+        /**
+         * @brief Removes this transform and its descendants from the hierarchy.
+         */
+        void Detach();
+
+        void ClearHierarchy();
+
+        bool EraseChild(Transform* Child)
+        {
+            if (std::erase(Children, Child))
+            {
+                MarkOwnerModified();
+                return true;
+            }
+            return false;
+        }
+
+        void UpdateEulerAngles() const
+        {
+            if (AreEulerAnglesDirty)
+            {
+                EulerAngles = glm::degrees(glm::eulerAngles(Rotation));
+                AreEulerAnglesDirty = false;
+            }
+        }
+
     public:
         [[nodiscard]] std::vector<Transform*>::iterator begin()
         {
@@ -385,10 +481,17 @@ namespace Engine
             return Children.end();
         }
 
+        void OnFieldsRestored() override
+        {
+            /*state may hold euler angles that weren't derived from the restored rotation yet*/
+            AreEulerAnglesDirty = true;
+            MarkDirty();
+        }
+
 #if EDITOR
         void DrawImGui();
 #endif
 
-        SERIALIZATION_EXPORT_CLASS(Transform)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(Transform)
     };
 }
@@ -1,5 +1,6 @@
 #include "MoveForward.h"
 
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
 #include "Engine/EngineObjects/Entity.h"
 
@@ -19,24 +20,7 @@ namespace Engine
         }
     }
 #endif
-    rapidjson::Value MoveForward::Serialize(rapidjson::Document::AllocatorType& Allocator) const
-    {
-        START_COMPONENT_SERIALIZATION
-        SERIALIZE_FIELD(Speed)
-        END_COMPONENT_SERIALIZATION
-    }
 
-    void MoveForward::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_VALUE_PASS
-        DESERIALIZE_VALUE(Speed)
-        END_COMPONENT_DESERIALIZATION_VALUE_PASS
-    }
-
-    void MoveForward::DeserializeReferencesPass(const rapidjson::Value& Object,
-                                                Serialization::ReferenceTable& ReferenceMap)
-    {
-        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
-    }
+    SERIALIZATION_FIELDS(MoveForward,
+                         SERIALIZATION_FIELD(Speed))
 } // Engine
@@ -26,7 +26,7 @@ namespace Engine
 #if EDITOR
         void DrawImGui() override;
 #endif
-        SERIALIZATION_EXPORT_CLASS(MoveForward)
+        SERIALIZATION_EXPORT_REFLECTED_CLASS(MoveForward)
 
     };
 
@@ -9,12 +9,20 @@
 #include "Engine/EngineObjects/LightManager.h"
 #include "Engine/Gui/LightsGui.h"
 #include "Engine/EngineObjects/UpdateManager.h"
+#include "Engine/EngineObjects/JobSystem.h"
+#include "Engine/EngineObjects/SceneCommandBuffer.h"
+#include "Engine/EngineObjects/Simulation.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Engine/EngineObjects/AssetHotReload.h"
+#include "Engine/EngineObjects/Scene/SceneManager.h"
 #include "Engine/EngineObjects/CollisionUpdateManager.h"
 #include "Engine/EngineObjects/RigidbodyUpdateManager.h"
 #include "Engine/Components/Colliders/PrimitiveMeshes.h"
+#include "Engine/Rendering/GraphicsContext.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialManager.h"
 #include "Models/ModelManager.h"
+#include "Utility/ObjectPool.h"
 #include "Utility/SystemUtilities.h"
 #include "Scene/SceneBuilder.h"
 #include "Shaders/ShaderManager.h"
@@ -38,7 +46,10 @@
 #endif
 #include "Input/InputManager.h"
 
+#include <array>
+#include <chrono>
 #include <iostream>
+#include <random>
 
 namespace SceneBuilding = Scene;
 
@@ -53,6 +64,7 @@ namespace Engine
         delete Camera;
     }
 
+#if !HEADLESS
     int Engine::Run()
     {
         if (!Initialize())
@@ -60,6 +72,7 @@ namespace Engine
             spdlog::error("Failed to initialize project!");
             return EXIT_FAILURE;
         }
+        Simulation::Reset(std::random_device{}());
 
         spdlog::info("Initialized project.");
 #if EDITOR
@@ -92,12 +105,26 @@ namespace Engine
         while (!glfwWindowShouldClose(Window))
         {
             ZoneScopedN("GameLoop");
+#if TELEMETRY
+            // Frame timer of the previous iteration has been stopped by now.
+            if (Frame > 0)
+            {
+                Telemetry::EndFrame(Frame);
+            }
+#endif
+            TELEMETRY_SCOPED_TIMER(Frame);
             ++Frame;
             glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
             float currentFrame = glfwGetTime();
             float deltaTime = currentFrame - lastFrame;
             lastFrame = currentFrame;
 
+            JobSystem::GetInstance()->ProcessMainThreadJobs();
+            SceneManager::UpdateStreams();
+#if EDITOR
+            AssetHotReload::Update(CurrentScene, deltaTime);
+#endif
+
             // Process I/O operations here
 #if EDITOR
             HandleInput(deltaTime);
@@ -108,11 +135,10 @@ namespace Engine
 #endif
 #if !EDITOR
             UpdateManager::GetInstance()->Update(deltaTime);
-            RigidbodyUpdateManager::GetInstance()->Update(deltaTime);
-            CollisionUpdateManager::GetInstance()->Update(deltaTime);
             if (!BackgroundAudioPlayer->IsPlaying())
                 BackgroundAudioPlayer->PlayLooping("music", 0.5f);
 #endif
+            CurrentScene->UpdateTransforms();
             int displayW, displayH;
             glfwMakeContextCurrent(Window);
             glfwGetFramebufferSize(Window, &displayW, &displayH);
@@ -120,7 +146,10 @@ namespace Engine
             const CameraRenderData renderData(Camera->GetPosition(), Camera->GetTransform(),
                                               Camera->GetProjectionMatrix());
 
-            RenderingManager::GetInstance()->RenderAll(renderData, WindowWidth, WindowHeight, deltaTime);
+            {
+                TELEMETRY_SCOPED_TIMER(Render);
+                RenderingManager::GetInstance()->RenderAll(renderData, WindowWidth, WindowHeight, deltaTime);
+            }
             AudioListener->UpdateListener();
 
 
@@ -141,17 +170,32 @@ namespace Engine
 #endif
 
             // End frame and swap buffers (double buffering)
-            Entity::DestroyQueued();
+            {
+                TELEMETRY_SCOPED_TIMER(StructuralChanges);
+                SceneCommandBuffer::GetInstance()->Apply();
+            }
+#if EDITOR
+            SceneManager::UpdateAutosave(CurrentScene, deltaTime);
+#endif
             EndFrame();
             FrameMark;
         }
 
         spdlog::info("Closing project.");
+        InputManager::GetInstance().StopRecording();
+#if TELEMETRY
+        Telemetry::EndFrame(Frame);
+        Telemetry::WriteOutput();
+#endif
 
         // Cleanup
+        SceneManager::FinishAutosave();
+        AssetHotReload::Finish();
+        JobSystem::Shutdown();
         FreeResources();
 
         spdlog::info("Freed scene resources.");
+        Utility::ObjectPoolBase::LogStatistics();
 #if EDITOR
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
@@ -166,8 +210,162 @@ namespace Engine
 
         return 0;
     }
+#endif
+
+    int Engine::RunHeadless(const HeadlessSettings& Settings)
+    {
+        Headless = true;
+        if (!Initialize())
+        {
+            spdlog::error("Failed to initialize project!");
+            return EXIT_FAILURE;
+        }
+
+        if (!Settings.InputReplayPath.empty() && !InputManager::GetInstance().LoadReplay(Settings.InputReplayPath))
+        {
+            return EXIT_FAILURE;
+        }
+
+        Simulation::Reset(Settings.Seed);
+        try
+        {
+            CurrentScene = new Scene();
+            SceneManager::LoadScene(Settings.ScenePath, CurrentScene);
+        } catch (std::runtime_error& e)
+        {
+            spdlog::error(e.what());
+            return EXIT_FAILURE;
+        }
+        if (Settings.OnSceneLoaded)
+        {
+            Settings.OnSceneLoaded(CurrentScene);
+        }
+        spdlog::info("Simulating {0} frames of {1}.", Settings.Frames, Settings.ScenePath);
+
+        std::array<float, UpdatePhaseCount> totalMilliseconds{};
+        std::array<float, UpdatePhaseCount> maxMilliseconds{};
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; frame < Settings.Frames; ++frame)
+        {
+            ZoneScopedN("HeadlessFrame");
+            ++Frame;
+            {
+                TELEMETRY_SCOPED_TIMER(Frame);
+                InputManager::GetInstance().Update();
+                JobSystem::GetInstance()->ProcessMainThreadJobs();
+                UpdateManager::GetInstance()->Update(Settings.TimeStep);
+                CurrentScene->UpdateTransforms();
+                TELEMETRY_SCOPED_TIMER(StructuralChanges);
+                SceneCommandBuffer::GetInstance()->Apply();
+            }
+#if TELEMETRY
+            Telemetry::EndFrame(Frame);
+#endif
+
+            for (size_t i = 0; i < UpdatePhaseCount; ++i)
+            {
+                const float milliseconds = UpdateManager::GetInstance()->GetStatistics(static_cast<UpdatePhase>(i)).LastMilliseconds;
+                totalMilliseconds[i] += milliseconds;
+                maxMilliseconds[i] = std::max(maxMilliseconds[i], milliseconds);
+            }
+            FrameMark;
+        }
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        spdlog::info("Simulated {0} frames in {1:.3f} s ({2:.3f} ms per frame).", Settings.Frames, elapsed,
+                     Settings.Frames > 0 ? elapsed * 1000.0 / Settings.Frames : 0.0);
+        for (size_t i = 0; i < UpdatePhaseCount; ++i)
+        {
+            const UpdatePhase phase = static_cast<UpdatePhase>(i);
+            spdlog::info("{0:<12} avg {1:8.4f} ms, max {2:8.4f} ms, {3} updateables", UpdateManager::GetPhaseName(phase),
+                         Settings.Frames > 0 ? totalMilliseconds[i] / Settings.Frames : 0.0f, maxMilliseconds[i],
+                         UpdateManager::GetInstance()->GetStatistics(phase).Updateables);
+        }
+        spdlog::info("State checksum: {0:016x}", CurrentScene->CalculateStateChecksum());
+        if (Settings.OnSimulated)
+        {
+            Settings.OnSimulated(CurrentScene);
+        }
+#if TELEMETRY
+        /*EndFrame runs after the Frame timer stops, so the overhead is relative to the frame it follows*/
+        spdlog::info("Telemetry overhead: {0:.3f}% of frame time over the last {1} frames.",
+                     Telemetry::GetOverheadPercentage(), Telemetry::GetFrameCount());
+        Telemetry::WriteOutput();
+#endif
+
+        JobSystem::Shutdown();
+        FreeResources();
+        return 0;
+    }
 
     bool Engine::Initialize()
+    {
+        if (Headless)
+        {
+            WindowWidth = HeadlessWidth;
+            WindowHeight = HeadlessHeight;
+        }
+#if !HEADLESS
+        else if (!InitializeWindow())
+        {
+            return false;
+        }
+#endif
+
+        if (GraphicsContext::IsAvailable())
+        {
+            RenderingManager::Initialize(glm::ivec2(WindowWidth, WindowHeight));
+            LightManager::Initialize();
+        }
+        JobSystem::Initialize();
+        SceneCommandBuffer::Initialize();
+        UpdateManager::Initialize();
+        Materials::MaterialManager::Initialize();
+        Ui::TextManager::Initialize();
+        RigidbodyUpdateManager::Initialize();
+        CollisionUpdateManager::Initialize();
+        PrimitiveMeshes::Initialize();
+#if EDITOR
+        //for editor game screen
+        if (GraphicsContext::IsAvailable())
+        {
+            InitEditorFramebuffer();
+            EditorGUI.SetSceneViewFramebuffer(EditorColorTexture);
+        }
+        GizmoManager::Initialize();
+#endif
+#if DEBUG
+        if (GraphicsContext::IsAvailable())
+        {
+            Utility::OpenGlDebugger::Enable();
+        }
+#endif
+
+        Camera = new class Camera(glm::perspective(glm::radians(70.0f),
+                                                   float(WindowWidth) / float(WindowHeight),
+                                                   0.1f,
+                                                   100.0f),
+                                  0.0018f);
+        Camera->SetPosition(glm::vec3(0.0f, 5.0f, 20.0f));
+
+        AudioListener = new class AudioListener(*Camera);
+        spdlog::info("Sounds loaded.");
+
+        BackgroundAudioPlayer = new class BackgroundAudioPlayer();
+
+        //input manager init, headless runs only replay recorded input
+#if !EDITOR && !HEADLESS
+        if (!Headless)
+        {
+            InputManager::GetInstance().Init(Window);
+        }
+#endif
+
+        return true;
+    }
+
+#if !HEADLESS
+    bool Engine::InitializeWindow()
     {
         glfwSetErrorCallback(GlfwErrorCallback);
         if (!glfwInit())
@@ -241,42 +439,7 @@ namespace Engine
 
         glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
         glEnable(GL_MULTISAMPLE);
-
-        RenderingManager::Initialize(glm::ivec2(WindowWidth, WindowHeight));
-        LightManager::Initialize();
-        UpdateManager::Initialize();
-        Materials::MaterialManager::Initialize();
-        Ui::TextManager::Initialize();
-        RigidbodyUpdateManager::Initialize();
-        CollisionUpdateManager::Initialize();
-        PrimitiveMeshes::Initialize();
-#if EDITOR
-        //for editor game screen
-        InitEditorFramebuffer();
-        EditorGUI.SetSceneViewFramebuffer(EditorColorTexture);
-        GizmoManager::Initialize();
-#endif
-#if DEBUG
-        Utility::OpenGlDebugger::Enable();
-#endif
-
-        Camera = new class Camera(glm::perspective(glm::radians(70.0f),
-                                                   float(WindowWidth) / float(WindowHeight),
-                                                   0.1f,
-                                                   100.0f),
-                                  0.0018f);
-        Camera->SetPosition(glm::vec3(0.0f, 5.0f, 20.0f));
-
-        AudioListener = new class AudioListener(*Camera);
-        spdlog::info("Sounds loaded.");
-
-        BackgroundAudioPlayer = new class BackgroundAudioPlayer();
-
-        //input manager init
-#if !EDITOR
-        InputManager::GetInstance().Init(Window);
-#endif
-
+        GraphicsContext::SetAvailable(true);
         return true;
     }
 
@@ -322,6 +485,7 @@ namespace Engine
         }
 #endif
     }
+#endif
 
 #if EDITOR
     void Engine::ImGuiInit()
@@ -364,13 +528,6 @@ namespace Engine
     }
 #endif
 
-    void Engine::EndFrame()
-    {
-        glfwPollEvents();
-        glfwMakeContextCurrent(Window);
-        glfwSwapBuffers(Window);
-    }
-
     void Engine::FreeResources()
     {
         delete CurrentScene;
@@ -383,6 +540,14 @@ namespace Engine
         AudioManager::DestroyInstance();
     }
 
+#if !HEADLESS
+    void Engine::EndFrame()
+    {
+        glfwPollEvents();
+        glfwMakeContextCurrent(Window);
+        glfwSwapBuffers(Window);
+    }
+
     void Engine::GlfwErrorCallback(int Error, const char* Description)
     {
         fprintf(stderr, "Glfw Error %d: %s\n", Error, Description);
@@ -437,6 +602,7 @@ namespace Engine
             }
         }
     }
+#endif
 
     void Engine::InitEditorFramebuffer()
     {
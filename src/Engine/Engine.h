@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "Components/Audio/AudioListener.h"
 #include "Components/Audio/BackgroundAudioPlayer.h"
 #include "Components/Colliders/BoxCollider.h"
@@ -18,12 +20,34 @@
 
 namespace Engine
 {
+    /**
+     * @brief Parameters of a simulation run without rendering.
+     */
+    struct HeadlessSettings
+    {
+        std::string ScenePath;
+        uint32_t Frames = 600;
+        /*fixed time step in seconds*/
+        float TimeStep = 1.0f / 60.0f;
+        /*input recording to replay, live input is ignored if empty*/
+        std::string InputReplayPath;
+        /*seed of random numbers of the simulation, runs with equal settings reach equal states*/
+        uint32_t Seed = 0;
+        /*called after the scene is loaded and before it's simulated, e.g. by benchmarks, may be empty*/
+        std::function<void(Scene*)> OnSceneLoaded;
+        /*called after the simulation and before resources are freed, may be empty*/
+        std::function<void(Scene*)> OnSimulated;
+    };
+
     class Engine final
     {
     public:
         constexpr static const char* const GlslVersion = "#version 460";
         static constexpr int32_t GlVersionMajor = 4;
         static constexpr int32_t GlVersionMinor = 6;
+        /*aspect ratio of the camera in headless runs, nothing is rendered*/
+        static constexpr int32_t HeadlessWidth = 64;
+        static constexpr int32_t HeadlessHeight = 64;
         Collider* Collider = nullptr;
 
         GLuint EditorFramebuffer;
@@ -45,6 +69,7 @@ namespace Engine
         glm::vec2 LastMousePosition = glm::vec2(0, 0);
 
         Scene* CurrentScene;
+        bool Headless = false;
 #if EDITOR
         EditorGUI EditorGUI;
 #endif
@@ -56,12 +81,30 @@ namespace Engine
         virtual ~Engine();
 
     public:
+#if !HEADLESS
         int Run();
+#endif
+
+        /**
+         * @brief Loads a scene and ticks all update phases with a fixed time step without rendering anything.
+         * Prints timing of every phase and checksum of the final scene state.
+         * GLFW isn't used at all, so no window or OpenGL context is created and assets are loaded without uploading
+         * them to the GPU. Builds with HEADLESS set contain only this mode and don't link GLFW.
+         * @param Settings Parameters of the run.
+         * @return Exit code.
+         */
+        int RunHeadless(const HeadlessSettings& Settings);
 
     private:
         bool Initialize();
+#if !HEADLESS
+        /**
+         * @brief Initializes GLFW, creates the window and its OpenGL context and loads OpenGL functions.
+         */
+        bool InitializeWindow();
 
         void HandleInput(float deltaTime);
+#endif
 #if EDITOR
         void ImGuiInit();
 
@@ -71,9 +114,9 @@ namespace Engine
 
         void ImGuiEnd();
 #endif
-        void EndFrame();
-
         void FreeResources();
+#if !HEADLESS
+        void EndFrame();
 
         static void GlfwErrorCallback(int Error, const char* Description);
 
@@ -82,6 +125,7 @@ namespace Engine
         static void MouseCallback(GLFWwindow* Window, double MouseX, double MouseY);
 
         static void MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods);
+#endif
 
         void InitEditorFramebuffer();
 
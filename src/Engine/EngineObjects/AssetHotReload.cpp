@@ -0,0 +1,250 @@
+#include "AssetHotReload.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "Engine/EngineObjects/Entity.h"
+#include "Engine/EngineObjects/Scene/SceneManager.h"
+#include "Engine/Prefabs/PrefabLoader.h"
+#include "Materials/MaterialManager.h"
+#include "rapidjson/filereadstream.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr size_t ReadBufferSize = 64 * 1024;
+
+    float GetMillisecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+
+    /**
+     * @brief Parses a json file, unlike ReadJsonFile a file that is still being written isn't an error.
+     * @return False if the file can't be opened or parsed.
+     */
+    bool TryReadJsonFile(const std::string& Path, rapidjson::Document& Document)
+    {
+        FILE* file;
+        if (fopen_s(&file, Path.c_str(), "rb") != 0)
+        {
+            return false;
+        }
+        const std::unique_ptr<char[]> buffer = std::make_unique<char[]>(ReadBufferSize);
+        rapidjson::FileReadStream stream(file, buffer.get(), ReadBufferSize);
+        Document.ParseStream(stream);
+        fclose(file);
+        return !Document.HasParseError() && Document.IsObject();
+    }
+}
+
+namespace Engine
+{
+    Utility::FileWatcher AssetHotReload::Watcher;
+    std::unordered_map<std::string, AssetHotReload::AssetType> AssetHotReload::WatchedTypes;
+    std::vector<std::unique_ptr<AssetHotReload::PendingRead>> AssetHotReload::Reads;
+    std::vector<AssetHotReload::PrefabReload> AssetHotReload::PrefabReloads;
+
+    void AssetHotReload::Update(Scene* const Scene, const float DeltaTime)
+    {
+        ZoneScoped;
+        const auto start = std::chrono::steady_clock::now();
+        TimeSinceScan += DeltaTime;
+        if (TimeSinceScan >= ScanIntervalSeconds)
+        {
+            TimeSinceScan = 0.0f;
+            WatchLoadedAssets(Scene);
+        }
+
+        std::vector<std::string> changed;
+        Watcher.Poll(std::max(BudgetMilliseconds - GetMillisecondsSince(start), 0.0f), changed);
+        for (const std::string& path : changed)
+        {
+            StartRead(path);
+        }
+
+        bool isAnyApplied = false;
+        while (!Reads.empty() && Reads.front()->Job.IsDone() &&
+               (!isAnyApplied || GetMillisecondsSince(start) < BudgetMilliseconds))
+        {
+            const std::unique_ptr<PendingRead> read = std::move(Reads.front());
+            Reads.erase(Reads.begin());
+            Apply(*read, Scene);
+            isAnyApplied = true;
+        }
+
+        std::erase_if(PrefabReloads, [Scene, start, &isAnyApplied](PrefabReload& Reload)
+        {
+            return ReplaceInstances(Reload, Scene, start, isAnyApplied);
+        });
+    }
+
+    void AssetHotReload::OnAssetSaved(const std::string& Path)
+    {
+        Watcher.Refresh(Path);
+    }
+
+    void AssetHotReload::Finish()
+    {
+        for (const std::unique_ptr<PendingRead>& read : Reads)
+        {
+            JobSystem::GetInstance()->Wait(read->Job);
+        }
+        Reads.clear();
+        PrefabReloads.clear();
+    }
+
+    void AssetHotReload::WatchLoadedAssets(const Scene* const Scene)
+    {
+        for (const std::string& path : Materials::MaterialManager::GetMaterialPaths())
+        {
+            Watch(path, AssetType::Material);
+        }
+        for (const std::string& path : PrefabLoader::GetCachedPaths())
+        {
+            Watch(path, AssetType::Prefab);
+        }
+        if (const std::string path = Scene->GetPath(); !path.empty())
+        {
+            Watch(path, AssetType::Scene);
+        }
+    }
+
+    void AssetHotReload::Watch(const std::string& Path, const AssetType Type)
+    {
+        if (Watcher.Watch(Path))
+        {
+            WatchedTypes.emplace(Path, Type);
+        }
+    }
+
+    void AssetHotReload::StartRead(const std::string& Path)
+    {
+        auto read = std::make_unique<PendingRead>();
+        read->Path = Path;
+        read->Type = WatchedTypes.at(Path);
+        PendingRead* pending = read.get();
+        Reads.push_back(std::move(read));
+        JobSystem::GetInstance()->Schedule([pending]
+        {
+            ZoneScopedN("ReadReloadedAsset");
+            pending->IsValid = TryReadJsonFile(pending->Path, pending->Document);
+        }, &pending->Job, nullptr, "ReadReloadedAsset");
+    }
+
+    void AssetHotReload::Apply(PendingRead& Read, Scene* const Scene)
+    {
+        ZoneScoped;
+        if (!Read.IsValid)
+        {
+            spdlog::warn("Failed to parse changed file {0}, it will be reloaded once it changes again.", Read.Path);
+            return;
+        }
+
+        switch (Read.Type)
+        {
+        case AssetType::Material:
+            if (Materials::MaterialManager::ReloadMaterial(Read.Path, Read.Document))
+            {
+                spdlog::info("Reloaded material {0}.", Read.Path);
+            }
+            else
+            {
+                spdlog::warn("Material {0} can't be reloaded, its type changed or it's no longer loaded.", Read.Path);
+            }
+            break;
+        case AssetType::Prefab:
+        {
+            if (!PrefabLoader::Reload(Read.Path, Read.Document))
+            {
+                spdlog::warn("Prefab {0} can't be reloaded, the file doesn't contain a valid prefab.", Read.Path);
+                break;
+            }
+            /*instances created from the previous version by an unfinished reload are replaced again*/
+            const NameId prefab = NameTable::Intern(Read.Path);
+            const auto reload = std::ranges::find(PrefabReloads, prefab, &PrefabReload::Prefab);
+            if (reload != PrefabReloads.end())
+            {
+                reload->Handled.clear();
+            }
+            else
+            {
+                PrefabReloads.push_back(PrefabReload{prefab, {}});
+            }
+            break;
+        }
+        case AssetType::Scene:
+            if (Scene->GetPath() == Read.Path)
+            {
+                /*the whole scene is replaced, so instances of reloaded prefabs are recreated anyway*/
+                PrefabReloads.clear();
+                spdlog::info("Scene {0} changed, reloading it.", Read.Path);
+                SceneManager::StreamScene(Read.Path, Scene);
+            }
+            break;
+        }
+    }
+
+    bool AssetHotReload::ReplaceInstances(PrefabReload& Reload, Scene* const Scene,
+                                          const std::chrono::steady_clock::time_point Start, bool& IsAnyApplied)
+    {
+        ZoneScoped;
+        const std::string& path = NameTable::GetString(Reload.Prefab);
+        const PrefabTemplate& prefab = PrefabLoader::Preload(path);
+        if (!prefab.IsValid())
+        {
+            spdlog::warn("Prefab {0} is empty, its instances are kept.", path);
+            return true;
+        }
+
+        /*instances are looked up every frame, entities may be destroyed between frames*/
+        std::vector<Entity*> instances;
+        std::vector<Entity*> stack = {Scene->GetRoot()};
+        while (!stack.empty())
+        {
+            Entity* entity = stack.back();
+            stack.pop_back();
+            if (entity->GetPrefab() == Reload.Prefab)
+            {
+                if (!Reload.Handled.contains(entity))
+                {
+                    instances.push_back(entity);
+                }
+                continue;
+            }
+            for (Transform* child : *entity->GetTransform())
+            {
+                stack.push_back(child->GetOwner());
+            }
+        }
+
+        for (Entity* instance : instances)
+        {
+            if (IsAnyApplied && GetMillisecondsSince(Start) >= BudgetMilliseconds)
+            {
+                return false;
+            }
+            IsAnyApplied = true;
+
+            /*placement of the instance is kept, everything else comes from the prefab*/
+            Transform* transform = instance->GetTransform();
+            Entity* replacement = prefab.Instantiate(Scene, transform->GetParent());
+            if (replacement == nullptr)
+            {
+                Reload.Handled.insert(instance);
+                continue;
+            }
+            Transform* replacementTransform = replacement->GetTransform();
+            replacementTransform->SetPositionLocalSpace(transform->GetPositionLocalSpace());
+            replacementTransform->SetRotation(transform->GetRotation());
+            replacementTransform->SetScale(transform->GetScale());
+            replacement->SetPrefab(Reload.Prefab);
+            Reload.Handled.insert(replacement);
+            instance->Destroy();
+        }
+
+        spdlog::info("Reloaded prefab {0}, replaced {1} instances.", path, Reload.Handled.size());
+        return true;
+    }
+} // Engine
@@ -0,0 +1,112 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Engine/EngineObjects/JobSystem.h"
+#include "Engine/EngineObjects/NameTable.h"
+#include "rapidjson/document.h"
+#include "Utility/FileWatcher.h"
+
+namespace Engine
+{
+    class Entity;
+    class Scene;
+
+    /**
+     * @brief Reloads loaded materials, prefabs and the current scene when their files change.
+     * Changed files are read on the JobSystem. Materials are patched in place, only instances of a changed prefab
+     * are replaced and a changed scene is streamed again. Work on the main thread is split across frames
+     * to fit a time budget.
+     */
+    class AssetHotReload
+    {
+    private:
+        enum class AssetType : uint8_t
+        {
+            Material,
+            Prefab,
+            Scene
+        };
+
+        struct PendingRead
+        {
+            std::string Path;
+            AssetType Type;
+            rapidjson::Document Document;
+            /*false if the file couldn't be parsed, it's likely still being written and will change again*/
+            bool IsValid = false;
+            JobCounter Job;
+        };
+
+        struct PrefabReload
+        {
+            NameId Prefab;
+            /*instances created or kept by this reload, they're skipped when looking for instances to replace*/
+            std::unordered_set<const Entity*> Handled;
+        };
+
+    private:
+        static Utility::FileWatcher Watcher;
+        static std::unordered_map<std::string, AssetType> WatchedTypes;
+        /*in order of changes, so the last change of a file is applied last*/
+        static std::vector<std::unique_ptr<PendingRead>> Reads;
+        static std::vector<PrefabReload> PrefabReloads;
+        /*time per frame spent checking files and applying reloads*/
+        static inline float BudgetMilliseconds = 2.0f;
+        /*loaded assets are looked up for files to watch this often*/
+        static constexpr float ScanIntervalSeconds = 1.0f;
+        static inline float TimeSinceScan = ScanIntervalSeconds;
+
+    private:
+        AssetHotReload() = default;
+
+    public:
+        /**
+         * @brief Checks watched files and applies finished reloads. Called every frame by the editor.
+         * @param Scene Scene reloaded prefabs are replaced in, it's streamed again when its own file changes.
+         * @param DeltaTime Time since the last call in seconds.
+         */
+        static void Update(Scene* Scene, float DeltaTime);
+
+        /**
+         * @brief Keeps a file written by the engine itself from being reloaded. Main thread only.
+         * @param Path Path of the written file, after it's closed.
+         */
+        static void OnAssetSaved(const std::string& Path);
+
+        /**
+         * @brief Waits until changed files are read, has to be called before the JobSystem shuts down.
+         */
+        static void Finish();
+
+        /**
+         * @brief Sets time per frame spent checking files and applying reloads.
+         * @param Milliseconds Time budget, at least one file is checked and one reload step is done regardless.
+         */
+        static void SetBudget(const float Milliseconds)
+        {
+            BudgetMilliseconds = Milliseconds;
+        }
+
+    private:
+        static void WatchLoadedAssets(const Scene* Scene);
+
+        static void Watch(const std::string& Path, AssetType Type);
+
+        static void StartRead(const std::string& Path);
+
+        static void Apply(PendingRead& Read, Scene* Scene);
+
+        /**
+         * @brief Replaces instances of a reloaded prefab until the budget runs out.
+         * @return True if no instance is left to replace.
+         */
+        static bool ReplaceInstances(PrefabReload& Reload, Scene* Scene, std::chrono::steady_clock::time_point Start,
+                                     bool& IsAnyApplied);
+    };
+} // Engine
@@ -1,30 +1,27 @@
 #include "CollisionUpdateManager.h"
 
+#include "UpdateManager.h"
+#include "tracy/Tracy.hpp"
+
 namespace Engine
 {
     CollisionUpdateManager* CollisionUpdateManager::Instance = nullptr;
 
     CollisionUpdateManager::CollisionUpdateManager() = default;
 
-    void CollisionUpdateManager::Initialize() { Instance = new CollisionUpdateManager; }
+    void CollisionUpdateManager::Initialize()
+    {
+        Instance = new CollisionUpdateManager;
+        UpdateManager::GetInstance()->RegisterComponent(Instance, UpdatePhase::Physics, 1);
+    }
 
     void CollisionUpdateManager::Update(float DeltaTime)
     {
-        if (!Dead.empty())
-        {
-            for (Collider* component : Dead)
-            {
-                std::erase(Updateables, component);
-            }
-            Dead.clear();
-        }
-
-        for (Collider* component : Updateables)
+        ZoneScoped;
+        Updateables.Flush();
+        Updateables.ForEach([DeltaTime](Collider* const Component)
         {
-            if (component!=nullptr)
-            {
-                component->Update(DeltaTime);
-            }
-        }
+            Component->Update(DeltaTime);
+        });
     }
 } // namespace Engine
@@ -1,27 +1,28 @@
 #pragma once
 
-#include <vector>
 #include "Engine/Components/Colliders/Collider.h"
+#include "Engine/Components/Interfaces/IUpdateable.h"
+#include "Engine/EngineObjects/UpdateList.h"
 namespace Engine
 {
     /**
      * @brief Singleton responsible for ticking updateable Colliders.
+     * Ticked by UpdateManager in the physics phase, after rigidbodies.
      */
 
-    class CollisionUpdateManager
+    class CollisionUpdateManager final : public IUpdateable
     {
     private:
         static CollisionUpdateManager* Instance;
 
-        std::vector<Collider*> Updateables;
-        std::vector<Collider*> Dead;
+        TUpdateList<Collider> Updateables;
 
     private:
         CollisionUpdateManager();
 
     public:
         /**
-         * @brief Initializes a new CollisionUpdateManager.
+         * @brief Initializes a new CollisionUpdateManager. UpdateManager has to be initialized first.
          */
         static void Initialize();
 
@@ -34,25 +35,27 @@ namespace Engine
          * @brief Registers new updateable Collider to be ticked.
          * @param Collider Collider to be registered.
          */
-        inline void RegisterCollider(Collider* Collider) { Updateables.push_back(Collider); }
+        inline void RegisterCollider(Collider* Collider) { Updateables.Add(Collider, Collider->UpdateSlot); }
 
         /**
-         * @brief Stops collider from being ticked afer this frame.
+         * @brief Stops collider from being ticked. Safe to use inside update loop.
          * @param Collider Collider to be unregistered.
          */
-        inline void UnregisterCollider(Collider* Collider) { Dead.push_back(Collider);
-        }
+        inline void UnregisterCollider(Collider* Collider) { Updateables.Remove(Collider->UpdateSlot); }
 
         /**
-         * @brief Stops collider from being ticked. Should not be used inside update loop.
+         * @brief Stops collider from being ticked, same as UnregisterCollider.
          * @param Collider Collider to be unregistered.
          */
-        inline void UnregisterColliderImmediate(Collider* Collider) { std::erase(Updateables, Collider); }
+        inline void UnregisterColliderImmediate(Collider* Collider)
+        {
+            Updateables.Remove(Collider->UpdateSlot);
+        }
 
         /**
          * @brief Calls Update() on all updateable Colliders.
          * @param DeltaTime Time since last frame.
          */
-        void Update(float DeltaTime);
+        void Update(float DeltaTime) override;
     };
 } // namespace Engine
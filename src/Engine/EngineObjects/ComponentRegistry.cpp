@@ -0,0 +1,44 @@
+#include "ComponentRegistry.h"
+
+#include <bit>
+
+namespace Engine
+{
+    std::array<ComponentRegistry::TypeList, Serialization::MaxTypeIds> ComponentRegistry::Lists;
+
+    void ComponentRegistry::Register(Component* const Component)
+    {
+        Serialization::TypeMask mask = Serialization::TypeIdRegistry::GetMask(Component);
+        while (mask != 0)
+        {
+            TypeList& list = Lists[std::countr_zero(mask)];
+            if (list.Indices.try_emplace(Component, static_cast<uint32_t>(list.Components.size())).second)
+            {
+                list.Components.push_back(Component);
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    void ComponentRegistry::Unregister(const Component* const Component)
+    {
+        Serialization::TypeMask mask = Serialization::TypeIdRegistry::GetMask(Component);
+        while (mask != 0)
+        {
+            TypeList& list = Lists[std::countr_zero(mask)];
+            if (const auto iterator = list.Indices.find(Component); iterator != list.Indices.end())
+            {
+                const uint32_t index = iterator->second;
+                list.Indices.erase(iterator);
+                if (index != list.Components.size() - 1)
+                {
+                    Engine::Component* last = list.Components.back();
+                    list.Components[index] = last;
+                    list.Indices[last] = index;
+                }
+                list.Components.pop_back();
+            }
+            mask &= mask - 1;
+        }
+    }
+} // Engine
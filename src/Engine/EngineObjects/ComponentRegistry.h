@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/EngineObjects/Entity.h"
+
+namespace Engine
+{
+    /**
+     * @brief Keeps dense lists of live components of every exported class.
+     * A component is listed under its own class and every exported class it derives from.
+     * Entity keeps the registry up to date when components are added, removed or deserialized.
+     */
+    class ComponentRegistry final
+    {
+    private:
+        struct TypeList
+        {
+            std::vector<Component*> Components;
+            std::unordered_map<const Component*, uint32_t> Indices;
+        };
+
+    private:
+        static std::array<TypeList, Serialization::MaxTypeIds> Lists;
+
+    private:
+        ComponentRegistry() = default;
+
+    public:
+        /**
+         * @brief Adds a component to lists of all classes it is an instance of.
+         * @param Component Component to be added.
+         */
+        static void Register(Component* Component);
+
+        /**
+         * @brief Removes a component from all lists.
+         * @param Component Component to be removed.
+         */
+        static void Unregister(const Component* Component);
+
+        /**
+         * @brief Returns all live components that are instances of T. Order is unspecified.
+         * @tparam T Class with its own TypeId.
+         */
+        template<class T>
+        [[nodiscard]] static const std::vector<Component*>& GetComponents()
+        {
+            static_assert(Serialization::HasOwnTypeId<T>, "T has to be exported with SERIALIZATION_EXPORT_TYPE_ID.");
+            return Lists[T::GetStaticTypeId()].Components;
+        }
+
+        /**
+         * @brief Invokes a function for every entity that has components of all given classes.
+         * Iterates only components of T, other classes are checked with Entity::HasComponent.
+         * Each entity is visited once with its first component of every class, same as returned by GetComponent.
+         * @tparam T Class of the first component, preferably the rarest one.
+         * @tparam TOthers Classes of other required components.
+         * @param Function Invoked with entity and pointers to the components.
+         */
+        template<class T, class... TOthers, class TFunction>
+        static void ForEach(TFunction&& Function)
+        {
+            for (Component* component : GetComponents<T>())
+            {
+                Entity* owner = component->GetOwner();
+                if (owner == nullptr || owner->GetComponent<T>() != component)
+                {
+                    continue;
+                }
+                if ((owner->HasComponent<TOthers>() && ...))
+                {
+                    Function(owner, static_cast<T*>(component), owner->GetComponent<TOthers>()...);
+                }
+            }
+        }
+    };
+} // Engine
@@ -1,26 +1,45 @@
 #include "Entity.h"
 
+#include <bit>
+#include <cassert>
+#include <unordered_map>
+
+#include "ComponentRegistry.h"
 #include "GizmoManager.h"
+#include "SceneCommandBuffer.h"
 #include "Scene/Scene.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializationUtility.h"
+#include "Serialization/SerializedObjectFactory.h"
 
 namespace
 {
-    struct DeserializationPair
+    /**
+     * @brief Appends an entity, its transform, its components and all its descendants in order of SerializeEntity.
+     */
+    void CollectObjects(const Engine::Entity& Entity, std::vector<const Serialization::SerializedObject*>& Objects)
     {
-        const rapidjson::Value& Json;
-        Serialization::SerializedObject* Object;
-    };
+        Objects.push_back(&Entity);
+        Objects.push_back(Entity.GetTransform());
+        Objects.insert(Objects.end(), Entity.begin(), Entity.end());
+        for (const Engine::Transform* transform : *Entity.GetTransform())
+        {
+            CollectObjects(*transform->GetOwner(), Objects);
+        }
+    }
 }
 
 namespace Engine
 {
-    std::vector<Entity*> Entity::ToDestroy;
-
     Entity::~Entity()
     {
+        if (Scene != nullptr)
+        {
+            Scene->RemoveFromIndex(this);
+        }
         for (Component* component : Components)
         {
+            ComponentRegistry::Unregister(component);
             component->OnDestroy();
             delete component;
         }
@@ -32,87 +51,233 @@ namespace Engine
 #endif
     }
 
-    Entity* Entity::CloneAsConcrete() const
+    void Entity::Destroy()
     {
-        rapidjson::Document document;
-        document.SetArray();
-        SerializeEntity(document, document.GetAllocator());
-        return DeserializeEntity(document, GetScene(), GetTransform()->GetParent());
+        SceneCommandBuffer::GetInstance()->Destroy(this);
     }
 
-    void Entity::SerializeEntity(rapidjson::Value& Object, rapidjson::Document::AllocatorType& Allocator) const
+    Entity* Entity::CloneAsConcrete() const
     {
+        std::vector<const SerializedObject*> sources;
+        CollectObjects(*this, sources);
+
+        /*fields are copied as they are, references are remapped to the clones of the objects they point to*/
+        std::vector<SerializedObject*> clones;
+        clones.reserve(sources.size());
+        std::unordered_map<const SerializedObject*, SerializedObject*> cloneMap;
+        cloneMap.reserve(sources.size());
+        const Serialization::TypeMask entityType = Serialization::TypeMask(1) << GetStaticTypeId();
+        const Serialization::TypeMask transformType =
+                Serialization::TypeMask(1) << Engine::Transform::GetStaticTypeId();
+        for (size_t i = 0; i < sources.size(); ++i)
         {
-            Object.PushBack(this->Serialize(Allocator), Allocator);
-            for (const Component* component : *this)
+            const SerializedObject* source = sources[i];
+            SerializedObject* clone;
+            if (Serialization::TypeIdRegistry::GetMask(source) & entityType)
             {
-                Object.PushBack(component->Serialize(Allocator), Allocator);
+                const auto* sourceEntity = static_cast<const Entity*>(source);
+                auto* entity = new Entity();
+                entity->Name = sourceEntity->Name;
+                entity->Tags = sourceEntity->Tags;
+                entity->Prefab = sourceEntity->Prefab;
+                entity->SetScene(sourceEntity->GetScene());
+                clone = entity;
             }
-            for (const class Transform* transform : *(this->GetTransform()))
+            else if (Serialization::TypeIdRegistry::GetMask(source) & transformType)
             {
-                transform->GetOwner()->SerializeEntity(Object, Allocator);
+                /*transforms follow their entities*/
+                clone = static_cast<Entity*>(clones[i - 1])->GetTransform();
+            }
+            else
+            {
+                clone = Serialization::SerializedObjectFactory::CreateObject(source->GetType());
+                static_cast<Component*>(clone)->SetOwner(
+                        static_cast<Entity*>(cloneMap.at(static_cast<const Component*>(source)->GetOwner())));
             }
+            if (const Serialization::ClassReflection* reflection = source->GetReflection())
+            {
+                Serialization::CopyFields(source->GetReflectedFields(), clone->GetReflectedFields(), *reflection);
+            }
+            clones.push_back(clone);
+            cloneMap.emplace(source, clone);
         }
-    }
 
-    Entity* Entity::DeserializeEntity(rapidjson::Value& Object, class Scene* Scene, class Transform* Parent)
-    {
-        Serialization::ReferenceTable referenceTable;
-        std::vector<DeserializationPair> objects;
-        Entity* root = nullptr;
-
-        for (const rapidjson::Value& jsonObject : Object.GetArray())
+        std::vector<SerializedObject*> references;
+        for (size_t i = 0; i < sources.size(); ++i)
         {
-            SerializedObject* deserializedObject = Serialization::SerializedObjectFactory::CreateObject(
-                    jsonObject["type"].GetString());
-            deserializedObject->DeserializeValuePass(jsonObject, referenceTable);
-            DeserializationPair pair{jsonObject, deserializedObject};
-            objects.emplace_back(pair);
-            if (Entity* entity = dynamic_cast<Entity*>(deserializedObject))
+            SerializedObject* clone = clones[i];
+            if (Serialization::TypeIdRegistry::GetMask(clone) & entityType)
             {
-                entity->Scene = Scene;
-                if (root == nullptr)
+                auto* entity = static_cast<Entity*>(clone);
+                for (const Component* component : *static_cast<const Entity*>(sources[i]))
+                {
+                    entity->Components.push_back(static_cast<Component*>(cloneMap.at(component)));
+                }
+                entity->UpdateComponentIndices();
+                for (Component* component : entity->Components)
                 {
-                    root = entity;
+                    ComponentRegistry::Register(component);
                 }
+                continue;
             }
+
+            const Serialization::ClassReflection* reflection = clone->GetReflection();
+            if (reflection != nullptr)
+            {
+                for (const Serialization::FieldInfo& reference : reflection->GetReferences())
+                {
+                    references.clear();
+                    reference.CollectReferences(reference.Get(sources[i]->GetReflectedFields()), references);
+                    for (SerializedObject* object : references)
+                    {
+                        /*objects outside of the cloned hierarchy aren't referenced, like in prefab instances*/
+                        const auto iterator = cloneMap.find(object);
+                        reference.SetReference(reference.Get(clone->GetReflectedFields()),
+                                               iterator != cloneMap.end() ? iterator->second : nullptr);
+                    }
+                }
+            }
+            clone->OnReferencesResolved();
         }
 
-        for (DeserializationPair pair : objects)
+        auto* root = static_cast<Entity*>(clones[0]);
+        class Transform* parent = GetTransform()->GetParent();
+        if (parent == nullptr && GetScene() != nullptr)
         {
-            pair.Object->DeserializeReferencesPass(pair.Json, referenceTable);
+            parent = GetScene()->GetRoot()->GetTransform();
+        }
+        if (parent != nullptr)
+        {
+            root->GetTransform()->SetParent(parent);
         }
 
-        for (const DeserializationPair pair : objects)
+        for (SerializedObject* clone : clones)
         {
-            pair.Object->SetId(Utility::GenerateGuid());
-            if (Entity* entity = dynamic_cast<Entity*>(pair.Object))
+            if (Component* component = dynamic_cast<Component*>(clone))
             {
-                entity->GetTransform()->SetId(Utility::GenerateGuid());
+                component->Start();
             }
         }
+        return root;
+    }
 
-        if (root->GetTransform()->GetParent() == nullptr)
+    void Entity::SetScene(class Scene* const Scene)
+    {
+        if (this->Scene == Scene)
         {
-            if (Parent == nullptr)
-            {
-                root->GetTransform()->SetParent(Scene->GetRoot()->GetTransform());
-            }
-            else
+            return;
+        }
+        if (this->Scene != nullptr)
+        {
+            this->Scene->RemoveFromIndex(this);
+        }
+        this->Scene = Scene;
+        if (Scene != nullptr)
+        {
+            Scene->AddToIndex(this);
+        }
+    }
+
+    void Entity::SetName(const NameId Name)
+    {
+        if (this->Name == Name)
+        {
+            return;
+        }
+        MarkModified();
+        if (Scene != nullptr)
+        {
+            Scene->RemoveFromIndex(this);
+        }
+        this->Name = Name;
+        if (Scene != nullptr)
+        {
+            Scene->AddToIndex(this);
+        }
+    }
+
+    void Entity::AddTag(const TagId Tag)
+    {
+        if (Tag == InvalidTagId || HasTag(Tag))
+        {
+            return;
+        }
+        MarkModified();
+        if (Scene != nullptr)
+        {
+            Scene->RemoveFromIndex(this);
+        }
+        Tags |= TagMask(1) << Tag;
+        if (Scene != nullptr)
+        {
+            Scene->AddToIndex(this);
+        }
+    }
+
+    void Entity::RemoveTag(const TagId Tag)
+    {
+        if (!HasTag(Tag))
+        {
+            return;
+        }
+        MarkModified();
+        if (Scene != nullptr)
+        {
+            Scene->RemoveFromIndex(this);
+        }
+        Tags &= ~(TagMask(1) << Tag);
+        if (Scene != nullptr)
+        {
+            Scene->AddToIndex(this);
+        }
+    }
+
+    void Entity::AttachComponent(Component* const Component)
+    {
+        Components.push_back(Component);
+        MarkModified();
+        UpdateComponentIndices();
+        ComponentRegistry::Register(Component);
+    }
+
+    void Entity::DetachComponent(Component* const Component)
+    {
+        std::erase(Components, Component);
+        MarkModified();
+        UpdateComponentIndices();
+        ComponentRegistry::Unregister(Component);
+    }
+
+    void Entity::UpdateComponentIndices()
+    {
+        assert(Components.size() < NoComponent);
+        ComponentMask = 0;
+        ComponentIndices.fill(NoComponent);
+        for (size_t i = 0; i < Components.size(); ++i)
+        {
+            Serialization::TypeMask newTypes = Serialization::TypeIdRegistry::GetMask(Components[i]) & ~ComponentMask;
+            ComponentMask |= newTypes;
+            while (newTypes != 0)
             {
-                root->GetTransform()->SetParent(Parent);
+                ComponentIndices[std::countr_zero(newTypes)] = static_cast<uint8_t>(i);
+                newTypes &= newTypes - 1;
             }
         }
+    }
 
-        for (const DeserializationPair pair : objects)
+    void Entity::SerializeEntity(rapidjson::Value& Object, rapidjson::Document::AllocatorType& Allocator) const
+    {
         {
-            if (Component* component = dynamic_cast<Component*>(pair.Object))
+            Object.PushBack(this->Serialize(Allocator), Allocator);
+            for (const Component* component : *this)
             {
-                component->Start();
+                Object.PushBack(component->Serialize(Allocator), Allocator);
+            }
+            for (const class Transform* transform : *(this->GetTransform()))
+            {
+                transform->GetOwner()->SerializeEntity(Object, Allocator);
             }
         }
-
-        return root;
     }
 
 #if EDITOR
@@ -134,6 +299,11 @@ namespace Engine
             ImGui::PopID();
             ++i;
         }
+        /*fields of components are edited directly through their widgets*/
+        if (ImGui::IsWindowFocused() && ImGui::IsAnyItemActive())
+        {
+            MarkModified();
+        }
     }
 #endif
 
@@ -143,6 +313,20 @@ namespace Engine
         object.AddMember("type", Serialization::Serialize(TypeName, Allocator), Allocator);
         object.AddMember("id", Serialization::Serialize(GetID(), Allocator), Allocator);
         object.AddMember("name", Serialization::Serialize(GetName(), Allocator), Allocator);
+        if (Tags != 0)
+        {
+            rapidjson::Value tags(rapidjson::kArrayType);
+            for (TagMask mask = Tags; mask != 0; mask &= mask - 1)
+            {
+                const TagId tag = static_cast<TagId>(std::countr_zero(mask));
+                tags.PushBack(Serialization::Serialize(TagTable::GetString(tag), Allocator), Allocator);
+            }
+            object.AddMember("tags", tags, Allocator);
+        }
+        if (Prefab != NoPrefab)
+        {
+            object.AddMember("prefab", Serialization::Serialize(NameTable::GetString(Prefab), Allocator), Allocator);
+        }
         object.AddMember("transform", Transform.Serialize(Allocator), Allocator);
         object.AddMember("components", Serialization::Serialize(Components, Allocator), Allocator);
         return object;
@@ -150,16 +334,31 @@ namespace Engine
 
     void Entity::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
     {
-        GUID id;
+        Utility::Guid id;
         Serialization::Deserialize(Object, "id", id);
         SetId(id);
-        Serialization::Deserialize(Object, "name", Name);
+        std::string name = GetName();
+        Serialization::Deserialize(Object, "name", name);
+        SetName(name);
+        if (const auto tagsIterator = Object.FindMember("tags");
+            tagsIterator != Object.MemberEnd() && tagsIterator->value.IsArray())
+        {
+            for (const rapidjson::Value& tag : tagsIterator->value.GetArray())
+            {
+                AddTag(TagTable::Intern(tag.GetString()));
+            }
+        }
+        if (const auto prefabIterator = Object.FindMember("prefab");
+            prefabIterator != Object.MemberEnd() && prefabIterator->value.IsString())
+        {
+            Prefab = NameTable::Intern(prefabIterator->value.GetString());
+        }
         if (const auto transformIterator = Object.FindMember("transform");
             transformIterator != Object.MemberEnd() && transformIterator->value.IsObject())
         {
             Transform.DeserializeValuePass(transformIterator->value, ReferenceMap);
         }
-        ReferenceMap.emplace(id, this);
+        ReferenceMap.Add(id, this);
     }
 
     void Entity::DeserializeReferencesPass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)
@@ -170,5 +369,10 @@ namespace Engine
             Transform.DeserializeReferencesPass(transformIterator->value, ReferenceMap);
         }
         Serialization::Deserialize(Object, "components", Components, ReferenceMap);
+        UpdateComponentIndices();
+        for (Component* component : Components)
+        {
+            ComponentRegistry::Register(component);
+        }
     }
 }
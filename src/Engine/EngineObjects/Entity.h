@@ -1,12 +1,16 @@
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 
 #include "Engine/Components/Component.h"
 #include "Engine/Components/Transform.h"
+#include "Engine/EngineObjects/NameTable.h"
+#include "Engine/EngineObjects/SceneCommandBuffer.h"
 #include "Utility/Cloneable/TCloneable.h"
 
 namespace Engine
@@ -21,15 +25,29 @@ namespace Engine
     class Entity : public Serialization::SerializedObject, public Utility::TCloneable<Entity>
     {
         friend class Scene;
+        friend class SceneCommandBuffer;
 
     private:
-        static std::vector<Entity*> ToDestroy;
+        static constexpr uint8_t NoComponent = UINT8_MAX;
+
+    public:
+        static constexpr NameId NoPrefab = UINT32_MAX;
 
     private:
         Transform Transform;
         Scene* Scene = nullptr;
         std::vector<Component*> Components;
-        std::string Name = "New Entity";
+        NameId Name = NameTable::Intern("New Entity");
+        TagMask Tags = 0;
+        /*interned path of the prefab this entity is the root instance of, NoPrefab for other entities*/
+        NameId Prefab = NoPrefab;
+        /*whether serialized state of this entity or its components changed since the last autosave*/
+        bool IsModifiedFlag = true;
+
+        /*TypeIds of all components and their exported base classes*/
+        Serialization::TypeMask ComponentMask = 0;
+        /*index of the first component of every TypeId, NoComponent if there is none*/
+        std::array<uint8_t, Serialization::MaxTypeIds> ComponentIndices;
 
     public:
         /**
@@ -38,6 +56,7 @@ namespace Engine
         Entity() :
             Transform(Engine::Transform(this)), Components(std::vector<Component*>())
         {
+            ComponentIndices.fill(NoComponent);
         }
 
         ~Entity() override;
@@ -68,12 +87,9 @@ namespace Engine
         }
 
         /**
-         * @brief Sets scene for this entity.
+         * @brief Sets scene for this entity and moves it to that scene's name and tag index.
          */
-        void SetScene(class Scene* Scene)
-        {
-            this->Scene = Scene;
-        }
+        void SetScene(class Scene* Scene);
 
         /**
          * @brief Adds a new component to this entity.
@@ -85,7 +101,7 @@ namespace Engine
             static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
             T* component = new T();
             component->SetOwner(this);
-            Components.push_back(component);
+            AttachComponent(component);
             component->Start();
             return component;
         }
@@ -98,13 +114,13 @@ namespace Engine
         void AddComponent(Component* Component)
         {
             Component->SetOwner(this);
-            Components.push_back(Component);
+            AttachComponent(Component);
             Component->Start();
         }
 
         void RemoveComponent(Component* Component)
         {
-            std::erase(Components, Component);
+            DetachComponent(Component);
             Component->OnDestroy();
             delete Component;
         }
@@ -119,6 +135,14 @@ namespace Engine
         [[nodiscard]] T* GetComponent() const
         {
             static_assert(std::is_base_of_v<Component, T>, "Class not derived from IComponent");
+            if constexpr (Serialization::HasOwnTypeId<T>)
+            {
+                if (const Serialization::TypeId id = T::GetStaticTypeId(); id != Serialization::InvalidTypeId)
+                {
+                    const uint8_t index = ComponentIndices[id];
+                    return index != NoComponent ? static_cast<T*>(Components[index]) : nullptr;
+                }
+            }
             for (Component* component : Components)
             {
                 if (T* result = dynamic_cast<T*>(component))
@@ -130,27 +154,60 @@ namespace Engine
         }
 
         /**
-         * @brief Removes component from this entity by class.
-         * @tparam T Class of component to be removed.
+         * @brief Checks whether this entity has a component of given class.
+         * @tparam T Class of sought component.
+         * @return True if found, false otherwise.
          */
         template<class T>
-        void RemoveComponent()
+        [[nodiscard]] bool HasComponent() const
         {
+            static_assert(std::is_base_of_v<Component, T>, "Class not derived from IComponent");
+            if constexpr (Serialization::HasOwnTypeId<T>)
             {
-                static_assert(std::is_base_of_v<Component, T>, "Class not derived from IComponent");
-                if (Component* component = GetComponent<T>())
+                if (const Serialization::TypeId id = T::GetStaticTypeId(); id != Serialization::InvalidTypeId)
                 {
-                    std::erase(Components, component);
-                    component->OnDestroy();
-                    delete component;
+                    return (ComponentMask & Serialization::TypeMask(1) << id) != 0;
                 }
             }
+            return GetComponent<T>() != nullptr;
+        }
+
+        /**
+         * @brief Returns TypeIds of all components of this entity and their exported base classes.
+         */
+        [[nodiscard]] Serialization::TypeMask GetComponentMask() const
+        {
+            return ComponentMask;
+        }
+
+        /**
+         * @brief Removes component from this entity by class at the end of the frame, see SceneCommandBuffer.
+         * GetComponent<T>() keeps returning the component until SceneCommandBuffer::Apply, calling this again
+         * before then has no effect.
+         * @tparam T Class of component to be removed.
+         */
+        template<class T>
+        void RemoveComponent()
+        {
+            static_assert(std::is_base_of_v<Component, T>, "Class not derived from IComponent");
+            if (Component* component = GetComponent<T>())
+            {
+                SceneCommandBuffer::GetInstance()->RemoveComponent(component);
+            }
         }
 
         /**
          * @brief Returns name of this entity.
          */
-        [[nodiscard]] std::string GetName() const
+        [[nodiscard]] const std::string& GetName() const
+        {
+            return NameTable::GetString(Name);
+        }
+
+        /**
+         * @brief Returns interned name of this entity.
+         */
+        [[nodiscard]] NameId GetNameId() const
         {
             return Name;
         }
@@ -161,7 +218,59 @@ namespace Engine
         */
         void SetName(const std::string& Name)
         {
-            this->Name = Name;
+            SetName(NameTable::Intern(Name));
+        }
+
+        /**
+         * @brief Sets an interned name of this entity.
+         * @param Name A new name.
+         */
+        void SetName(NameId Name);
+
+        /**
+         * @brief Checks whether this entity has given tag.
+         */
+        [[nodiscard]] bool HasTag(const TagId Tag) const
+        {
+            return Tag != InvalidTagId && (Tags & TagMask(1) << Tag) != 0;
+        }
+
+        /**
+         * @brief Returns all tags of this entity.
+         */
+        [[nodiscard]] TagMask GetTags() const
+        {
+            return Tags;
+        }
+
+        /**
+         * @brief Adds a tag to this entity.
+         * @param Tag Tag to be added.
+         */
+        void AddTag(TagId Tag);
+
+        /**
+         * @brief Removes a tag from this entity.
+         * @param Tag Tag to be removed.
+         */
+        void RemoveTag(TagId Tag);
+
+        /**
+         * @brief Returns interned path of the prefab this entity is the root instance of, NoPrefab if there is none.
+         */
+        [[nodiscard]] NameId GetPrefab() const
+        {
+            return Prefab;
+        }
+
+        /**
+         * @brief Marks this entity as the root of a prefab instance, it's replaced when the prefab is reloaded.
+         * @param Prefab Interned path of the prefab file, NoPrefab to detach the instance from its prefab.
+         */
+        void SetPrefab(const NameId Prefab)
+        {
+            this->Prefab = Prefab;
+            MarkModified();
         }
 
         [[nodiscard]] std::vector<Component*>::iterator begin()
@@ -184,25 +293,44 @@ namespace Engine
             return Components.end();
         }
 
-        void Destroy()
+        /**
+         * @brief Marks this entity to be serialized again by the next autosave.
+         * Done by the entity and its transform, code changing fields of components directly has to call it.
+         */
+        void MarkModified()
         {
-            ToDestroy.push_back(this);
+            IsModifiedFlag = true;
         }
 
-        static void DestroyQueued()
+        /**
+         * @brief Clears the modified flag after this entity is serialized.
+         * @return True if the entity was modified.
+         */
+        bool ClearModified()
         {
-            for (int i = 0; i < ToDestroy.size(); ++i)
-            {
-                delete ToDestroy[i];
-            }
-            ToDestroy.clear();
+            return std::exchange(IsModifiedFlag, false);
         }
 
+        /**
+         * @brief Destroys this entity and its descendants at the end of the frame.
+         */
+        void Destroy();
+
         [[nodiscard]] Entity* CloneAsConcrete() const override;
 
-        void SerializeEntity(rapidjson::Value& Object, rapidjson::Document::AllocatorType& Allocator) const;
+    private:
+        void AttachComponent(Component* Component);
+
+        void DetachComponent(Component* Component);
 
-        static Entity* DeserializeEntity(rapidjson::Value& Object, class Scene* Scene, class Transform* Parent);
+        void UpdateComponentIndices();
+
+    public:
+        /**
+         * @brief Appends this entity, its components and all its descendants to a json array.
+         * The array is the content of prefab files, see PrefabLoader.
+         */
+        void SerializeEntity(rapidjson::Value& Object, rapidjson::Document::AllocatorType& Allocator) const;
 
 #if EDITOR
         void DrawImGui();
@@ -0,0 +1,258 @@
+#include "JobSystem.h"
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    constexpr std::array<uint32_t, 4> BenchmarkThreadCounts = {1, 2, 4, 8};
+    constexpr uint32_t BenchmarkJobCount = 100000;
+    constexpr uint32_t BenchmarkElementCount = 1 << 20;
+    constexpr uint32_t BenchmarkBatchSize = 16384;
+    constexpr uint32_t BenchmarkRepetitions = 10;
+
+    double GetMillisecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+
+    void ProcessElements(std::vector<float>& Values, const uint32_t First, const uint32_t Last)
+    {
+        for (uint32_t i = First; i < Last; ++i)
+        {
+            const auto value = static_cast<float>(i);
+            Values[i] = std::sqrt(value) * std::sin(value * 0.001f) + std::cos(value * 0.002f);
+        }
+    }
+}
+
+namespace Engine
+{
+    JobSystem* JobSystem::Instance = nullptr;
+    thread_local uint32_t JobSystem::WorkerIndex = 0;
+
+    JobSystem::JobSystem(const uint32_t WorkerCount) :
+        MainThreadId(std::this_thread::get_id())
+    {
+        for (uint32_t i = 0; i <= WorkerCount; ++i)
+        {
+            Queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (uint32_t i = 1; i <= WorkerCount; ++i)
+        {
+            Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(SleepMutex);
+            Running = false;
+        }
+        WakeUp.notify_all();
+        for (std::thread& worker : Workers)
+        {
+            worker.join();
+        }
+    }
+
+    void JobSystem::Initialize(uint32_t WorkerCount)
+    {
+        if (WorkerCount == 0)
+        {
+            WorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        }
+        WorkerIndex = 0;
+        Instance = new JobSystem(WorkerCount);
+        spdlog::info("Started job system with {0} worker threads.", WorkerCount);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        delete Instance;
+        Instance = nullptr;
+    }
+
+    void JobSystem::Benchmark()
+    {
+        ZoneScoped;
+        const uint32_t workerCount = Instance != nullptr ? Instance->GetThreadCount() - 1 : 0;
+        Shutdown();
+
+        std::vector<float> values(BenchmarkElementCount);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t repetition = 0; repetition < BenchmarkRepetitions; ++repetition)
+        {
+            ProcessElements(values, 0, BenchmarkElementCount);
+        }
+        const double serial = GetMillisecondsSince(start) / BenchmarkRepetitions;
+        spdlog::info("Jobs: {0} elements processed without jobs in {1:.3f} ms, {2} cores", BenchmarkElementCount,
+                     serial, std::thread::hardware_concurrency());
+
+        for (const uint32_t threads : BenchmarkThreadCounts)
+        {
+            /*the constructor is used directly, Initialize treats 0 workers as one per core*/
+            WorkerIndex = 0;
+            Instance = new JobSystem(threads - 1);
+
+            JobCounter counter;
+            start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < BenchmarkJobCount; ++i)
+            {
+                Instance->Schedule([] {}, &counter, nullptr, "BenchmarkJob");
+            }
+            Instance->Wait(counter);
+            const double jobNanoseconds = GetMillisecondsSince(start) * 1000000.0 / BenchmarkJobCount;
+
+            start = std::chrono::steady_clock::now();
+            for (uint32_t repetition = 0; repetition < BenchmarkRepetitions; ++repetition)
+            {
+                Instance->ParallelFor(BenchmarkElementCount, BenchmarkBatchSize,
+                                      [&values](const uint32_t First, const uint32_t Last)
+                                      {
+                                          ProcessElements(values, First, Last);
+                                      }, "BenchmarkParallelFor");
+            }
+            const double parallel = GetMillisecondsSince(start) / BenchmarkRepetitions;
+            spdlog::info("Jobs: {0} threads, {1:8.1f} ns per empty job, ParallelFor {2:8.3f} ms, speedup {3:.2f}x",
+                         threads, jobNanoseconds, parallel, serial / parallel);
+            Shutdown();
+        }
+
+        Initialize(workerCount);
+    }
+
+    void JobSystem::Schedule(std::function<void()> Function, JobCounter* const Counter,
+                             const JobCounter* const Dependency, const char* const Name)
+    {
+        if (Counter != nullptr)
+        {
+            Counter->Pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        Push(Job{std::move(Function), Counter, Dependency, Name});
+    }
+
+    void JobSystem::ScheduleOnMainThread(std::function<void()> Function)
+    {
+        std::lock_guard lock(MainThreadMutex);
+        MainThreadJobs.push_back(std::move(Function));
+    }
+
+    void JobSystem::ProcessMainThreadJobs()
+    {
+        ZoneScoped;
+        assert(IsMainThread());
+        std::vector<std::function<void()>> jobs;
+        {
+            std::lock_guard lock(MainThreadMutex);
+            jobs.swap(MainThreadJobs);
+        }
+        for (const std::function<void()>& job : jobs)
+        {
+            job();
+        }
+    }
+
+    void JobSystem::Wait(const JobCounter& Counter)
+    {
+        ZoneScoped;
+        while (!Counter.IsDone())
+        {
+            if (!TryRunJob())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::WorkerLoop(const uint32_t Index)
+    {
+        WorkerIndex = Index;
+        const std::string name = "Worker " + std::to_string(Index);
+        tracy::SetThreadName(name.c_str());
+
+        while (Running.load(std::memory_order_relaxed))
+        {
+            if (TryRunJob())
+            {
+                continue;
+            }
+            if (QueuedJobs.load() > 0)
+            {
+                /*only jobs waiting for their dependencies are left*/
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock lock(SleepMutex);
+            WakeUp.wait(lock, [this] { return QueuedJobs.load() > 0 || !Running.load(); });
+        }
+    }
+
+    void JobSystem::Push(Job&& Job)
+    {
+        /*threads not owned by the job system share the main thread's queue*/
+        WorkerQueue& queue = *Queues[WorkerIndex < Queues.size() ? WorkerIndex : 0];
+        {
+            std::lock_guard lock(queue.Mutex);
+            queue.Jobs.push_back(std::move(Job));
+        }
+        QueuedJobs.fetch_add(1);
+        {
+            /*prevents a worker from missing the notification between checking the queue and going to sleep*/
+            std::lock_guard lock(SleepMutex);
+        }
+        WakeUp.notify_one();
+    }
+
+    bool JobSystem::TryRunJob()
+    {
+        const uint32_t own = WorkerIndex < Queues.size() ? WorkerIndex : 0;
+        const uint32_t queueCount = static_cast<uint32_t>(Queues.size());
+        for (uint32_t i = 0; i < queueCount; ++i)
+        {
+            WorkerQueue& queue = *Queues[(own + i) % queueCount];
+            std::unique_lock lock(queue.Mutex);
+            if (queue.Jobs.empty())
+            {
+                continue;
+            }
+
+            /*own jobs are taken newest first, stolen ones oldest first*/
+            Job job = std::move(i == 0 ? queue.Jobs.back() : queue.Jobs.front());
+            i == 0 ? queue.Jobs.pop_back() : queue.Jobs.pop_front();
+
+            if (job.Dependency != nullptr && !job.Dependency->IsDone())
+            {
+                /*requeued at the end other threads steal from, so it is retried after newer jobs*/
+                queue.Jobs.push_front(std::move(job));
+                continue;
+            }
+            lock.unlock();
+
+            QueuedJobs.fetch_sub(1);
+            Execute(job);
+            return true;
+        }
+        return false;
+    }
+
+    void JobSystem::Execute(Job& Job)
+    {
+        ZoneScoped;
+        ZoneName(Job.Name, std::strlen(Job.Name));
+        Job.Function();
+        if (Job.Counter != nullptr)
+        {
+            /*has to be the last access, waiting thread may destroy the counter right after*/
+            Job.Counter->Pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+} // Engine
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    /**
+     * @brief Counts unfinished jobs. Jobs scheduled with a counter as a dependency start when it reaches zero.
+     * Has to outlive all jobs that reference it.
+     */
+    class JobCounter final
+    {
+        friend class JobSystem;
+
+    private:
+        std::atomic<uint32_t> Pending = 0;
+
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter&) = delete;
+
+        JobCounter& operator=(const JobCounter&) = delete;
+
+    public:
+        /**
+         * @brief Checks whether all jobs counted by this counter have finished.
+         */
+        [[nodiscard]] bool IsDone() const
+        {
+            return Pending.load(std::memory_order_acquire) == 0;
+        }
+    };
+
+    /**
+     * @brief Singleton running jobs on a pool of worker threads.
+     * Every worker owns a queue, pops its own jobs from the back and steals jobs of others from the front.
+     * Threads waiting for a counter run jobs in the meantime. Jobs that need the OpenGL context
+     * have to be scheduled with ScheduleOnMainThread.
+     */
+    class JobSystem final
+    {
+    private:
+        struct Job
+        {
+            std::function<void()> Function;
+            JobCounter* Counter;
+            const JobCounter* Dependency;
+            const char* Name;
+        };
+
+        struct WorkerQueue
+        {
+            std::mutex Mutex;
+            std::deque<Job> Jobs;
+        };
+
+    private:
+        static JobSystem* Instance;
+        static thread_local uint32_t WorkerIndex;
+
+        /*queue 0 belongs to the main thread*/
+        std::vector<std::unique_ptr<WorkerQueue>> Queues;
+        std::vector<std::thread> Workers;
+        std::thread::id MainThreadId;
+
+        std::atomic<uint32_t> QueuedJobs = 0;
+        std::atomic<bool> Running = true;
+        std::mutex SleepMutex;
+        std::condition_variable WakeUp;
+
+        std::mutex MainThreadMutex;
+        std::vector<std::function<void()>> MainThreadJobs;
+
+    private:
+        explicit JobSystem(uint32_t WorkerCount);
+
+    public:
+        ~JobSystem();
+
+    public:
+        /**
+         * @brief Starts worker threads. Has to be called from the main thread.
+         * @param WorkerCount Number of worker threads, 0 uses one thread per core except the main one.
+         */
+        static void Initialize(uint32_t WorkerCount = 0);
+
+        /**
+         * @brief Stops and joins worker threads. Jobs that haven't started are dropped.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Measures cost of a single job and speedup of ParallelFor on 1, 2, 4 and 8 threads, logs results.
+         * Restarts the JobSystem for every thread count, has to be called while no jobs are running.
+         */
+        static void Benchmark();
+
+        /**
+         * @brief Returns instance of the JobSystem, nullptr if it wasn't initialized.
+         */
+        static JobSystem* GetInstance()
+        {
+            return Instance;
+        }
+
+        /**
+         * @brief Queues a job on any thread.
+         * @param Function Work to be done.
+         * @param Counter Counter incremented now and decremented when the job finishes, may be nullptr.
+         * @param Dependency Job starts only after this counter reaches zero, may be nullptr.
+         * @param Name Name shown in the profiler, has to be a string literal.
+         */
+        void Schedule(std::function<void()> Function, JobCounter* Counter = nullptr,
+                      const JobCounter* Dependency = nullptr, const char* Name = "Job");
+
+        /**
+         * @brief Queues a job to be run on the main thread during ProcessMainThreadJobs.
+         * @param Function Work to be done.
+         */
+        void ScheduleOnMainThread(std::function<void()> Function);
+
+        /**
+         * @brief Runs all jobs queued with ScheduleOnMainThread. Called once per frame by the engine.
+         */
+        void ProcessMainThreadJobs();
+
+        /**
+         * @brief Blocks until the counter reaches zero, running other jobs in the meantime.
+         * @param Counter Counter to be waited for.
+         */
+        void Wait(const JobCounter& Counter);
+
+        /**
+         * @brief Splits range [0, Count) into batches, processes them in parallel and waits for all of them.
+         * @param Count Number of elements.
+         * @param BatchSize Maximum number of elements processed by a single job.
+         * @param Function Invoked with the first and one past the last element of every batch.
+         * @param Name Name shown in the profiler, has to be a string literal.
+         */
+        template<class TFunction>
+        void ParallelFor(const uint32_t Count, const uint32_t BatchSize, TFunction&& Function,
+                         const char* Name = "ParallelFor")
+        {
+            if (Count <= BatchSize)
+            {
+                Function(0u, Count);
+                return;
+            }
+            JobCounter counter;
+            for (uint32_t first = BatchSize; first < Count; first += BatchSize)
+            {
+                const uint32_t last = std::min(first + BatchSize, Count);
+                Schedule([&Function, first, last] { Function(first, last); }, &counter, nullptr, Name);
+            }
+            Function(0u, BatchSize);
+            Wait(counter);
+        }
+
+        /**
+         * @brief Returns number of threads that run jobs, including the main thread.
+         */
+        [[nodiscard]] uint32_t GetThreadCount() const
+        {
+            return static_cast<uint32_t>(Queues.size());
+        }
+
+        /**
+         * @brief Checks whether the calling thread is the main thread.
+         */
+        [[nodiscard]] bool IsMainThread() const
+        {
+            return std::this_thread::get_id() == MainThreadId;
+        }
+
+    private:
+        void WorkerLoop(uint32_t Index);
+
+        void Push(Job&& Job);
+
+        bool TryRunJob();
+
+        void Execute(Job& Job);
+
+    };
+} // Engine
@@ -6,6 +6,7 @@
 #include "RenderingManager.h"
 #include "Engine/Textures/Texture.h"
 #include "Utility/TextureUtilities.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 namespace Engine
 {
@@ -294,9 +295,11 @@ namespace Engine
         LightsScreenPositionBuffer[0].x = *reinterpret_cast<float*>(&ScreenLightsCount);
 
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, LightBuffer);
+        TELEMETRY_COUNT(BytesUploaded, LightBufferData.GetCurrentSize());
         glBufferData(GL_SHADER_STORAGE_BUFFER, LightBufferData.GetCurrentSize(), &LightBufferData, GL_DYNAMIC_DRAW);
 
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, LightsScreenSpacePositionsBuffer);
+        TELEMETRY_COUNT(BytesUploaded, LightsScreenPositionBuffer.size() * sizeof(glm::vec2));
         glBufferData(
                 GL_SHADER_STORAGE_BUFFER,
                 static_cast<GLsizeiptr>(LightsScreenPositionBuffer.size() * sizeof(glm::vec2)),
@@ -0,0 +1,76 @@
+#include "NameTable.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+#include "spdlog/spdlog.h"
+
+namespace Engine
+{
+    NameId NameTable::Intern(const std::string_view Name)
+    {
+        Storage& storage = GetStorage();
+        {
+            std::shared_lock lock(storage.Mutex);
+            if (const auto iterator = storage.Ids.find(Name); iterator != storage.Ids.end())
+            {
+                return iterator->second;
+            }
+        }
+        std::unique_lock lock(storage.Mutex);
+        /*another thread may have registered the name while the lock was released*/
+        if (const auto iterator = storage.Ids.find(Name); iterator != storage.Ids.end())
+        {
+            return iterator->second;
+        }
+        const uint64_t count = storage.Count.load(std::memory_order_relaxed);
+        if (count > UINT32_MAX)
+        {
+            spdlog::critical("Can't intern name {0}, all {1} names are taken.", Name, count);
+            std::abort();
+        }
+        const NameId id = static_cast<NameId>(count);
+        const auto [chunk, offset] = Locate(id);
+        std::unique_ptr<std::string[]>& strings = storage.Chunks[chunk];
+        if (strings == nullptr)
+        {
+            strings = std::make_unique<std::string[]>(FirstChunkSize << chunk);
+        }
+        strings[offset] = Name;
+        storage.Ids.emplace(strings[offset], id);
+        /*readers of GetString don't lock, the string has to be complete before they can see the id*/
+        storage.Count.store(count + 1, std::memory_order_release);
+        return id;
+    }
+
+    TagId TagTable::Intern(const std::string_view Tag)
+    {
+        Storage& storage = GetStorage();
+        const auto find = [&storage, Tag](const size_t Count) -> TagId
+        {
+            const auto begin = storage.Tags.begin();
+            const auto iterator = std::find(begin, begin + static_cast<ptrdiff_t>(Count), Tag);
+            return static_cast<size_t>(iterator - begin) < Count ? static_cast<TagId>(iterator - begin) : InvalidTagId;
+        };
+        if (const TagId id = find(storage.Count.load(std::memory_order_acquire)); id != InvalidTagId)
+        {
+            return id;
+        }
+        std::unique_lock lock(storage.Mutex);
+        /*another thread may have registered the tag before the lock was taken*/
+        const size_t count = storage.Count.load(std::memory_order_relaxed);
+        if (const TagId id = find(count); id != InvalidTagId)
+        {
+            return id;
+        }
+        if (count >= MaxTags)
+        {
+            spdlog::error("Can't register tag {0}, all {1} tags are taken.", Tag, MaxTags);
+            return InvalidTagId;
+        }
+        storage.Tags[count] = Tag;
+        storage.Count.store(count + 1, std::memory_order_release);
+        return static_cast<TagId>(count);
+    }
+} // Engine
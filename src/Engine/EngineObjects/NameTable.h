@@ -0,0 +1,153 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace Engine
+{
+    /**
+     * @brief Interned entity name, equal ids always mean equal strings.
+     */
+    typedef uint32_t NameId;
+
+    /**
+     * @brief Interned entity tag, index of a bit in TagMask.
+     */
+    typedef uint8_t TagId;
+
+    /**
+     * @brief Set of tags, bit n corresponds to TagId n.
+     */
+    typedef uint64_t TagMask;
+
+    constexpr TagId InvalidTagId = UINT8_MAX;
+    constexpr size_t MaxTags = sizeof(TagMask) * 8;
+
+    /**
+     * @brief Maps entity names to small integers, so they can be compared without touching strings.
+     * Interned strings are never released. Thread safe, so names can be set while objects are deserialized in parallel.
+     * Strings are read without locking, they're stored in chunks that never move and published by an atomic count.
+     */
+    class NameTable final
+    {
+    private:
+        /*chunk n holds FirstChunkSize << n strings, so all NameIds fit into ChunkCount chunks*/
+        static constexpr uint32_t FirstChunkBits = 8;
+        static constexpr uint64_t FirstChunkSize = 1ull << FirstChunkBits;
+        static constexpr size_t ChunkCount = sizeof(NameId) * 8 - FirstChunkBits + 1;
+
+        struct Storage
+        {
+            /*chunks are only added while Mutex is held exclusively, map keys point into them*/
+            std::array<std::unique_ptr<std::string[]>, ChunkCount> Chunks;
+            /*number of strings readable without locking, incremented after the string is constructed*/
+            std::atomic<uint64_t> Count = 0;
+            std::unordered_map<std::string_view, NameId> Ids;
+            std::shared_mutex Mutex;
+        };
+
+    private:
+        NameTable() = default;
+
+        static Storage& GetStorage()
+        {
+            static Storage storage;
+            return storage;
+        }
+
+        /**
+         * @brief Returns index of the chunk an id is stored in and its offset in the chunk.
+         */
+        static std::pair<size_t, uint64_t> Locate(const NameId Id)
+        {
+            const uint64_t shifted = static_cast<uint64_t>(Id) + FirstChunkSize;
+            const size_t chunk = static_cast<size_t>(std::bit_width(shifted)) - FirstChunkBits - 1;
+            return {chunk, shifted - (FirstChunkSize << chunk)};
+        }
+
+    public:
+        /**
+         * @brief Returns id of a name, registering it on first use.
+         * @param Name Name to be interned.
+         */
+        static NameId Intern(std::string_view Name);
+
+        /**
+         * @brief Returns string of an interned name.
+         * @param Id Id returned by Intern.
+         */
+        [[nodiscard]] static const std::string& GetString(const NameId Id)
+        {
+            const Storage& storage = GetStorage();
+            /*pairs with the release in Intern, makes the chunk pointer and the string visible*/
+            [[maybe_unused]] const uint64_t count = storage.Count.load(std::memory_order_acquire);
+            assert(Id < count);
+            const auto [chunk, offset] = Locate(Id);
+            return storage.Chunks[chunk][offset];
+        }
+    };
+
+    /**
+     * @brief Maps tag names to bits of TagMask. At most MaxTags distinct tags can exist.
+     * Thread safe, tags are read without locking like names of NameTable.
+     */
+    class TagTable final
+    {
+    private:
+        struct Storage
+        {
+            /*fixed size, so references returned by GetString stay valid*/
+            std::array<std::string, MaxTags> Tags;
+            /*number of tags readable without locking, incremented after the tag is constructed*/
+            std::atomic<size_t> Count = 0;
+            /*serializes registration of new tags*/
+            std::mutex Mutex;
+        };
+
+    private:
+        TagTable() = default;
+
+        static Storage& GetStorage()
+        {
+            static Storage storage;
+            return storage;
+        }
+
+    public:
+        /**
+         * @brief Returns id of a tag, registering it on first use.
+         * @param Tag Tag to be interned.
+         * @return Id of the tag or InvalidTagId if all MaxTags are taken.
+         */
+        static TagId Intern(std::string_view Tag);
+
+        /**
+         * @brief Returns name of an interned tag.
+         * @param Id Id returned by Intern.
+         */
+        [[nodiscard]] static const std::string& GetString(const TagId Id)
+        {
+            const Storage& storage = GetStorage();
+            [[maybe_unused]] const size_t count = storage.Count.load(std::memory_order_acquire);
+            assert(Id < count);
+            return storage.Tags[Id];
+        }
+
+        /**
+         * @brief Returns number of tags interned so far.
+         */
+        [[nodiscard]] static size_t GetCount()
+        {
+            return GetStorage().Count.load(std::memory_order_acquire);
+        }
+    };
+} // Engine
@@ -15,6 +15,10 @@ namespace Engine
     {
         #if !EDITOR
         UpdateManager::GetInstance()->RegisterPlayer(this);
+        // Tools are swapped during gameplay, read them now so the first swap doesn't hitch.
+        PrefabLoader::Preload(StripperPath);
+        PrefabLoader::Preload(VacuumPath);
+        PrefabLoader::Preload(BroomPath);
         if (!PrefabPath.empty())
         {
             Entity* prefabEntity = PrefabLoader::LoadPrefab(PrefabPath, this->GetScene(), this->GetScene()->GetRoot()->GetTransform());
@@ -141,17 +145,21 @@ namespace Engine
 
     void DefaultPlayer::ToolSwapper(Collider* collider) 
     {
+        static const NameId stripperColliderName = NameTable::Intern("StripperCollider");
+        static const NameId vacuumColliderName = NameTable::Intern("VacuumCollider");
+        static const NameId broomColliderName = NameTable::Intern("BroomCollider");
         if (canSwap)
         {
-            if (collider->GetOwner()->GetName() == "StripperCollider")
+            const NameId name = collider->GetOwner()->GetNameId();
+            if (name == stripperColliderName)
             {
                 SetTool(Tool::Stripper);
             }
-            else if (collider->GetOwner()->GetName() == "VacuumCollider")
+            else if (name == vacuumColliderName)
             {
                 SetTool(Tool::Vacuum);
             }
-            else if (collider->GetOwner()->GetName() == "BroomCollider")
+            else if (name == broomColliderName)
             {
                 SetTool(Tool::Broom);
             }
@@ -25,6 +25,7 @@ namespace Engine
                                      const float DeltaTime)
     {
         Frustum.UpdateFrustum(RenderData);
+        CameraPosition = RenderData.CameraPosition;
         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
         for (const auto& renderersGroup : ParticleEmitters)
         {
@@ -34,6 +34,7 @@ namespace Engine
         GodRays GodRays;
 
         Frustum Frustum;
+        glm::vec3 CameraPosition = glm::vec3(0.0f);
 
     private:
         explicit RenderingManager(glm::ivec2 Resolution);
@@ -113,6 +114,14 @@ namespace Engine
             return Frustum;
         }
 
+        /**
+         * @brief Returns position of the camera used in the last rendered frame.
+         */
+        [[nodiscard]] const glm::vec3& GetCameraPosition() const
+        {
+            return CameraPosition;
+        }
+
         void RenderAll(const CameraRenderData& RenderData, int ScreenWidth, int ScreenHeight, float DeltaTime);
 
         void RenderAllDirectionalShadowMap(const CameraRenderData& RenderData, unsigned int Target, unsigned int Width,
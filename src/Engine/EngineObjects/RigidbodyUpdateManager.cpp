@@ -1,5 +1,7 @@
 #include "RigidbodyUpdateManager.h"
-#include <algorithm>
+
+#include "UpdateManager.h"
+#include "tracy/Tracy.hpp"
 
 namespace Engine
 {
@@ -12,23 +14,17 @@ namespace Engine
         if (!Instance)
         {
             Instance = new RigidbodyUpdateManager();
+            UpdateManager::GetInstance()->RegisterComponent(Instance, UpdatePhase::Physics, 0);
         }
     }
 
     void RigidbodyUpdateManager::Update(float DeltaTime)
     {
-        for (Rigidbody* rigidbody : Updateables)
+        ZoneScoped;
+        Updateables.Flush();
+        Updateables.ForEach([DeltaTime](Rigidbody* const Rigidbody)
         {
-            if (rigidbody)
-            {
-                rigidbody->Update(DeltaTime);
-            }
-        }
-
-        for (Rigidbody* rigidbody : Dead)
-        {
-            std::erase(Updateables, rigidbody);
-        }
-        Dead.clear();
+            Rigidbody->Update(DeltaTime);
+        });
     }
 } // namespace Engine
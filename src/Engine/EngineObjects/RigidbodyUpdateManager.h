@@ -1,26 +1,27 @@
 #pragma once
 
-#include <vector>
+#include "Engine/Components/Interfaces/IUpdateable.h"
 #include "Engine/Components/Physics/Rigidbody.h"
+#include "Engine/EngineObjects/UpdateList.h"
 namespace Engine
 {
      /**
      * @brief Singleton responsible for updating RigidBody components.
+     * Ticked by UpdateManager in the physics phase, before colliders.
      */
-    class RigidbodyUpdateManager
+    class RigidbodyUpdateManager final : public IUpdateable
     {
     private:
         static RigidbodyUpdateManager* Instance;
 
-        std::vector<Rigidbody*> Updateables;
-        std::vector<Rigidbody*> Dead;
+        TUpdateList<Rigidbody> Updateables;
 
     private:
         RigidbodyUpdateManager();
 
     public:
         /**
-         * @brief Initializes the RigidbodyUpdateManager singleton.
+         * @brief Initializes the RigidbodyUpdateManager singleton. UpdateManager has to be initialized first.
          */
         static void Initialize();
 
@@ -33,24 +34,27 @@ namespace Engine
          * @brief Registers a new RigidBody to be updated.
          * @param Rigidbody The RigidBody to be registered.
          */
-        inline void RegisterRigidbody(Rigidbody* Rigidbody) { Updateables.push_back(Rigidbody); }
+        inline void RegisterRigidbody(Rigidbody* Rigidbody) { Updateables.Add(Rigidbody, Rigidbody->UpdateSlot); }
 
         /**
-         * @brief Marks a RigidBody to stop being updated after the current frame.
+         * @brief Stops updating a RigidBody. Safe to use inside the update loop.
          * @param Rigidbody The RigidBody to be unregistered.
          */
-        inline void UnregisterRigidbody(Rigidbody* Rigidbody) { Dead.push_back(Rigidbody); }
+        inline void UnregisterRigidbody(Rigidbody* Rigidbody) { Updateables.Remove(Rigidbody->UpdateSlot); }
 
         /**
-         * @brief Immediately stops updating a RigidBody. Should not be used inside the update loop.
+         * @brief Stops updating a RigidBody, same as UnregisterRigidbody.
          * @param Rigidbody The RigidBody to be unregistered.
          */
-        inline void UnregisterRigidbodyImmediate(Rigidbody* Rigidbody) { std::erase(Updateables, Rigidbody); }
+        inline void UnregisterRigidbodyImmediate(Rigidbody* Rigidbody)
+        {
+            Updateables.Remove(Rigidbody->UpdateSlot);
+        }
 
         /**
          * @brief Updates all registered RigidBody components.
          * @param DeltaTime The time elapsed since the last frame.
          */
-        void Update(float DeltaTime);
+        void Update(float DeltaTime) override;
     };
 } // namespace Engine
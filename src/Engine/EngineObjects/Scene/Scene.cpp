@@ -1,13 +1,23 @@
 #include "Scene.h"
 
+#include <algorithm>
+#include <bit>
+
 #include "Engine/Components/Renderers/AnimatedModelRenderer.h"
 #include "Engine/Components/Renderers/ModelRenderer.h"
+#include "Engine/EngineObjects/ComponentRegistry.h"
 #include "Engine/EngineObjects/GameMode/DefaultGameMode.h"
+#include "Engine/EngineObjects/JobSystem.h"
 #include "Engine/EngineObjects/Player/DefaultPlayer.h"
 #include "Engine/UI/Ui.h"
 #include "Engine/UI/UiImplementations/EmptyUi.h"
+#include "Serialization/CookedFilesUtility.h"
+#include "Serialization/Reflection.h"
 #include "Serialization/SerializedObjectFactory.h"
 #include "Serialization/SerializationUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+#include "Utility/AssertionsUtility.h"
 
 namespace
 {
@@ -16,6 +26,69 @@ namespace
         const rapidjson::Value& Json;
         Serialization::SerializedObject* Object;
     };
+
+    /**
+     * @brief Runs value pass of objects in parallel, then loads resources they requested on the main thread.
+     * Every batch fills its own reference table, the tables are merged into ReferenceMap afterwards.
+     * @param Objects Objects to be deserialized.
+     * @param ReferenceMap Reference table used in serialization.
+     * @param Threads Maximum number of threads, 0 uses all threads of the JobSystem.
+     */
+    void DeserializeValues(const std::vector<DeserializationPair>& Objects,
+                           Serialization::ReferenceTable& ReferenceMap, const uint32_t Threads)
+    {
+        ZoneScoped;
+        Engine::JobSystem* jobSystem = Engine::JobSystem::GetInstance();
+        const uint32_t count = static_cast<uint32_t>(Objects.size());
+        if (jobSystem == nullptr || count == 0)
+        {
+            for (const DeserializationPair pair : Objects)
+            {
+                pair.Object->DeserializeValuePass(pair.Json, ReferenceMap);
+            }
+            return;
+        }
+
+        const uint32_t threadCount = Threads == 0 ? jobSystem->GetThreadCount()
+                                                  : std::min(Threads, jobSystem->GetThreadCount());
+        /*one batch per thread, so no more than threadCount threads take part*/
+        const uint32_t batchSize = (count + threadCount - 1) / threadCount;
+        std::vector<Serialization::ReferenceTable> tables((count + batchSize - 1) / batchSize);
+        const auto deserializeBatch = [&Objects, &tables, batchSize](const uint32_t First, const uint32_t Last)
+        {
+            Serialization::ReferenceTable& table = tables[First / batchSize];
+            /*entities register their transforms as well*/
+            table.Reserve((Last - First) * 2);
+            for (uint32_t i = First; i < Last; ++i)
+            {
+                Objects[i].Object->DeserializeValuePass(Objects[i].Json, table);
+            }
+        };
+        jobSystem->ParallelFor(count, batchSize, deserializeBatch, "DeserializeValues");
+
+        for (const Serialization::ReferenceTable& table : tables)
+        {
+            ReferenceMap.Merge(table);
+        }
+        jobSystem->ProcessMainThreadJobs();
+    }
+
+    /**
+     * @brief Returns a string of a json object, an empty string if it's missing.
+     */
+    std::string GetStringMember(const rapidjson::Value& Value, const char* const Name)
+    {
+        const auto iterator = Value.FindMember(Name);
+        return iterator != Value.MemberEnd() ? iterator->value.GetString() : std::string();
+    }
+
+    /**
+     * @brief Returns a string of a cooked file, an empty string for None.
+     */
+    std::string GetCookedString(const Serialization::CookedFile& File, const uint32_t Index)
+    {
+        return Index != Serialization::CookedFile::None ? std::string(File.GetString(Index)) : std::string();
+    }
 }
 
 namespace Engine
@@ -24,15 +97,22 @@ namespace Engine
     {
         Root = new Entity();
         Root->SetName("Root");
+        Root->GetTransform()->SetHierarchy(&Transforms);
     }
 
     Scene::Scene(Entity* Root) :
         Root(Root)
     {
+        Root->GetTransform()->SetHierarchy(&Transforms);
     }
 
+    SERIALIZATION_REFLECTION(Scene,
+                             SERIALIZATION_FIELD(Skybox),
+                             SERIALIZATION_FIELD(Bounds))
+
     Scene::~Scene()
     {
+        ClearIndex();
         delete Root;
         delete Ui;
         delete GameMode;
@@ -72,16 +152,7 @@ namespace Engine
 
     rapidjson::Value Scene::Serialize(rapidjson::Document::AllocatorType& Allocator)
     {
-        CalculateBounds();
-        rapidjson::Value documentRoot = rapidjson::Value(rapidjson::kObjectType);
-        documentRoot.SetObject();
-        rapidjson::Value root = Root->Serialize(Allocator);
-        documentRoot.AddMember("Skybox", Serialization::Serialize(Skybox, Allocator), Allocator);
-        documentRoot.AddMember("Bounds", Serialization::Serialize(Bounds, Allocator), Allocator);
-        documentRoot.AddMember("UI", Serialization::Serialize(Ui->GetType(), Allocator), Allocator);
-        documentRoot.AddMember("GameMode", Serialization::Serialize(GameMode->GetType(), Allocator), Allocator);
-        documentRoot.AddMember("Player", Serialization::Serialize(Player->GetType(), Allocator), Allocator);
-        documentRoot.AddMember("Root", root, Allocator);
+        rapidjson::Value documentRoot = SerializeSettings(Allocator);
         rapidjson::Value objects = rapidjson::Value(rapidjson::kArrayType);
         for (const Component* component : *Root)
         {
@@ -96,91 +167,255 @@ namespace Engine
         return documentRoot;
     }
 
+    rapidjson::Value Scene::SerializeSettings(rapidjson::Document::AllocatorType& Allocator)
+    {
+        CalculateBounds();
+        rapidjson::Value documentRoot = rapidjson::Value(rapidjson::kObjectType);
+        documentRoot.SetObject();
+        rapidjson::Value root = Root->Serialize(Allocator);
+        documentRoot.AddMember("Skybox", Serialization::Serialize(Skybox, Allocator), Allocator);
+        documentRoot.AddMember("Bounds", Serialization::Serialize(Bounds, Allocator), Allocator);
+        documentRoot.AddMember("UI", Serialization::Serialize(Ui->GetType(), Allocator), Allocator);
+        documentRoot.AddMember("GameMode", Serialization::Serialize(GameMode->GetType(), Allocator), Allocator);
+        documentRoot.AddMember("Player", Serialization::Serialize(Player->GetType(), Allocator), Allocator);
+        documentRoot.AddMember("Root", root, Allocator);
+        return documentRoot;
+    }
+
     void Scene::Deserialize(const rapidjson::Value& Value)
     {
         Serialization::ReferenceTable referenceTable;
         std::vector<DeserializationPair> objects;
 
+        ClearIndex();
         delete Root;
         Root = new Entity();
         Root->SetName("Root");
 
-        delete Ui;
-        delete GameMode;
-        delete Player;
-
         Serialization::Deserialize(Value, "Skybox", Skybox);
-        LightManager::GetInstance()->SetEnvironmentMap(Skybox);
+        if (LightManager* const lightManager = LightManager::GetInstance())
+        {
+            lightManager->SetEnvironmentMap(Skybox);
+        }
 
         Serialization::Deserialize(Value, "Bounds", Bounds);
 
-        const auto uiIterator = Value.FindMember("UI");
-        if (uiIterator != Value.MemberEnd())
+        CreateGameplayObjects(GetStringMember(Value, "UI"), GetStringMember(Value, "GameMode"),
+                              GetStringMember(Value, "Player"));
+        Root->SetScene(this);
+
+        const rapidjson::Value& serializedObjects = Value["Objects"];
+        /*entities register their transforms as well*/
+        referenceTable.Reserve((serializedObjects.Size() + 1) * 2);
+        objects.reserve(serializedObjects.Size());
+
+        Root->DeserializeValuePass(Value["Root"], referenceTable);
+
+        /*object pools aren't thread safe, so objects are created up front*/
+        for (const rapidjson::Value& jsonObject : serializedObjects.GetArray())
         {
-            Ui = Ui::UiSerializationFactory::CreateObject(uiIterator->value.GetString());
+            Serialization::SerializedObject* deserializedObject
+                    = Serialization::SerializedObjectFactory::CreateObject(jsonObject["type"].GetString());
+            objects.push_back(DeserializationPair{jsonObject, deserializedObject});
         }
-        else
+
+        DeserializeValues(objects, referenceTable, DeserializationThreads);
+
+        for (const DeserializationPair pair : objects)
         {
-            Ui = new Ui::EmptyUi();
+            if (Entity* entity = dynamic_cast<Entity*>(pair.Object))
+            {
+                entity->SetScene(this);
+            }
         }
 
-        const auto gameModeIterator = Value.FindMember("GameMode");
-        if (gameModeIterator != Value.MemberEnd())
+        Root->DeserializeReferencesPass(Value["Root"], referenceTable);
+        for (DeserializationPair pair : objects)
         {
-            GameMode = GameModeFactory::CreateObject(gameModeIterator->value.GetString());
+            pair.Object->DeserializeReferencesPass(pair.Json, referenceTable);
         }
-        else
+        /*values were read into the new root directly, so it's stored once they're final*/
+        Root->GetTransform()->SetHierarchy(&Transforms);
+
+        GameMode->Start();
+        Player->Start();
+
+        for (const DeserializationPair pair : objects)
         {
-            GameMode = new DefaultGameMode();
+            if (Component* component = dynamic_cast<Component*>(pair.Object))
+            {
+                component->Start();
+            }
         }
+    }
 
-        const auto playerIterator = Value.FindMember("Player");
-        if (playerIterator != Value.MemberEnd())
+    void Scene::DeserializeCooked(const Serialization::CookedFile& File)
+    {
+        ZoneScoped;
+        ClearIndex();
+        delete Root;
+        Root = new Entity();
+        Root->SetName("Root");
+
+        const Serialization::CookedFile::SceneSettings& settings = File.GetSceneSettings();
+        std::span<const uint8_t> fields = settings.Fields;
+        if (!Serialization::ReadBinary(fields, this, GetStaticReflection()))
         {
-            Player = PlayerFactory::CreateObject(playerIterator->value.GetString());
+            spdlog::warn("Settings of a cooked scene are corrupted.");
         }
-        else
+        if (LightManager* const lightManager = LightManager::GetInstance())
         {
-            Player = new DefaultPlayer();
+            lightManager->SetEnvironmentMap(Skybox);
         }
 
-        Root->Scene = this;
-        Player->Scene = this;
-        GameMode->Scene = this;
+        CreateGameplayObjects(GetCookedString(File, settings.Ui), GetCookedString(File, settings.GameMode),
+                              GetCookedString(File, settings.Player));
+        Root->SetScene(this);
 
-        Root->DeserializeValuePass(Value["Root"], referenceTable);
+        const std::vector<Serialization::SerializedObject*> objects = InstantiateCooked(File, Root, this,
+                                                                                         DeserializationThreads);
+        /*values were read into the new root directly, so it's stored once they're final*/
+        Root->GetTransform()->SetHierarchy(&Transforms);
 
-        const rapidjson::Value& serializedObjects = Value["Objects"];
+        GameMode->Start();
+        Player->Start();
 
-        for (const rapidjson::Value& jsonObject : serializedObjects.GetArray())
+        for (Serialization::SerializedObject* object : objects)
         {
-            Serialization::SerializedObject* deserializedObject
-                    = Serialization::SerializedObjectFactory::CreateObject(jsonObject["type"].GetString());
-            deserializedObject->DeserializeValuePass(jsonObject, referenceTable);
-            DeserializationPair pair{jsonObject, deserializedObject};
-            objects.emplace_back(pair);
-            if (Entity* entity = dynamic_cast<Entity*>(deserializedObject))
+            if (Component* component = dynamic_cast<Component*>(object))
             {
-                entity->Scene = this;
+                component->Start();
             }
         }
+    }
 
-        Root->DeserializeReferencesPass(Value["Root"], referenceTable);
-        for (DeserializationPair pair : objects)
+    std::vector<Serialization::SerializedObject*> Scene::InstantiateCooked(const Serialization::CookedFile& File,
+                                                                          Entity* const Root, Scene* const Scene,
+                                                                          const uint32_t Threads)
+    {
+        ZoneScoped;
+        using Kind = Serialization::CookedFile::ObjectKind;
+        const uint32_t count = File.GetObjectCount();
+        std::vector<Serialization::SerializedObject*> created(count);
+
+        /*object pools aren't thread safe, so objects are created up front*/
+        for (uint32_t i = 0; i < count; ++i)
         {
-            pair.Object->DeserializeReferencesPass(pair.Json, referenceTable);
+            if (File.GetKind(i) == Kind::EntityTransform)
+            {
+                created[i] = static_cast<Entity*>(created[i - 1])->GetTransform();
+            }
+            else if (i == 0 && Root != nullptr)
+            {
+                created[i] = Root;
+            }
+            else
+            {
+                created[i] = File.Build(i);
+            }
         }
 
-        GameMode->Start();
-        Player->Start();
+        const auto readValues = [&File, &created](const uint32_t First, const uint32_t Last)
+        {
+            for (uint32_t i = First; i < Last; ++i)
+            {
+                if (!File.ReadValues(i, created[i]))
+                {
+                    spdlog::warn("Fields of a cooked object of type {0} are corrupted.", created[i]->GetType());
+                }
+                if (File.GetKind(i) != Kind::Entity)
+                {
+                    continue;
+                }
+                Entity* entity = static_cast<Entity*>(created[i]);
+                const Serialization::CookedFile::EntityData data = File.GetEntity(i);
+                if (data.Name != Serialization::CookedFile::None)
+                {
+                    entity->SetName(NameTable::Intern(File.GetString(data.Name)));
+                }
+                for (const uint32_t tag : data.Tags)
+                {
+                    entity->AddTag(TagTable::Intern(File.GetString(tag)));
+                }
+                if (data.Prefab != Serialization::CookedFile::None)
+                {
+                    entity->Prefab = NameTable::Intern(File.GetString(data.Prefab));
+                }
+            }
+        };
+        JobSystem* jobSystem = JobSystem::GetInstance();
+        if (jobSystem == nullptr || Threads == 1 || count == 0)
+        {
+            readValues(0, count);
+        }
+        else
+        {
+            const uint32_t threadCount = Threads == 0 ? jobSystem->GetThreadCount()
+                                                      : std::min(Threads, jobSystem->GetThreadCount());
+            /*one batch per thread, so no more than threadCount threads take part*/
+            jobSystem->ParallelFor(count, (count + threadCount - 1) / threadCount, readValues, "ReadCookedValues");
+            /*resources requested by objects are loaded on the main thread*/
+            jobSystem->ProcessMainThreadJobs();
+        }
 
-        for (const DeserializationPair pair : objects)
+        for (uint32_t i = 0; i < count; ++i)
         {
-            if (Component* component = dynamic_cast<Component*>(pair.Object))
+            if (File.GetKind(i) == Kind::Entity)
             {
-                component->Start();
+                static_cast<Entity*>(created[i])->SetScene(Scene);
+            }
+            else if (File.GetKind(i) == Kind::Component)
+            {
+                const uint32_t owner = File.GetOwner(i);
+                static_cast<Component*>(created[i])->SetOwner(
+                        owner != Serialization::CookedFile::None ? static_cast<Entity*>(created[owner]) : nullptr);
+            }
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (File.GetKind(i) != Kind::Entity)
+            {
+                File.ResolveReferences(i, created);
+                created[i]->OnReferencesResolved();
+                continue;
+            }
+            Entity* entity = static_cast<Entity*>(created[i]);
+            for (const uint32_t component : File.GetEntity(i).Components)
+            {
+                entity->Components.push_back(static_cast<Component*>(created[component]));
+            }
+            entity->UpdateComponentIndices();
+            for (Component* component : entity->Components)
+            {
+                ComponentRegistry::Register(component);
             }
         }
+
+        std::vector<Serialization::SerializedObject*> objects;
+        objects.reserve(count);
+        for (uint32_t i = Root != nullptr ? 1 : 0; i < count; ++i)
+        {
+            if (File.GetKind(i) != Kind::EntityTransform)
+            {
+                objects.push_back(created[i]);
+            }
+        }
+        return objects;
+    }
+
+    void Scene::CreateGameplayObjects(const std::string& UiType, const std::string& GameModeType,
+                                      const std::string& PlayerType)
+    {
+        delete Ui;
+        delete GameMode;
+        delete Player;
+
+        Ui = !UiType.empty() ? Ui::UiSerializationFactory::CreateObject(UiType) : new Ui::EmptyUi();
+        GameMode = !GameModeType.empty() ? GameModeFactory::CreateObject(GameModeType) : new DefaultGameMode();
+        Player = !PlayerType.empty() ? PlayerFactory::CreateObject(PlayerType) : new DefaultPlayer();
+        Player->Scene = this;
+        GameMode->Scene = this;
     }
 
     void Scene::DeleteEntity(Entity* const Entity)
@@ -191,41 +426,155 @@ namespace Engine
         delete Entity;
     }
 
-    void Scene::CalculateBounds()
+    bool Scene::Contains(const Entity* const Entity) const
     {
-        Bounds = Models::AABBox3(glm::vec3(0.0f), glm::vec3(0.0f));
-        CalculateBounds(Root);
+        const Transform* transform = Entity->GetTransform();
+        while (transform->GetParent() != nullptr)
+        {
+            transform = transform->GetParent();
+        }
+        return transform == Root->GetTransform();
     }
 
-    void Scene::CalculateBounds(Entity* const Entity)
+    const std::vector<Entity*>& Scene::FindEntitiesByName(const NameId Name) const
     {
-        for (const Transform* child : *Entity->GetTransform())
+        static const std::vector<Entity*> empty;
+        const auto iterator = EntitiesByName.find(Name);
+        return iterator != EntitiesByName.end() ? iterator->second.Entities : empty;
+    }
+
+    void Scene::AddToIndex(Entity* const Entity)
+    {
+        const auto addTo = [Entity](EntityList& List)
+        {
+            if (List.Indices.try_emplace(Entity, static_cast<uint32_t>(List.Entities.size())).second)
+            {
+                List.Entities.push_back(Entity);
+            }
+        };
+
+        addTo(EntitiesByName[Entity->GetNameId()]);
+        for (TagMask mask = Entity->GetTags(); mask != 0; mask &= mask - 1)
         {
-            CalculateBounds(child->GetOwner());
+            addTo(EntitiesByTag[std::countr_zero(mask)]);
         }
-        if (const ModelRenderer* renderer = Entity->GetComponent<ModelRenderer>())
+    }
+
+    void Scene::RemoveFromIndex(const Entity* const Entity)
+    {
+        const auto removeFrom = [Entity](EntityList& List)
         {
-            const Models::Model* model = renderer->GetModel();
-            const glm::mat4& modelMatrix = Entity->GetTransform()->GetLocalToWorldMatrix();
-            for (int i = 0; i < model->GetMeshCount(); ++i)
+            const auto iterator = List.Indices.find(Entity);
+            if (iterator == List.Indices.end())
             {
-                const Models::Mesh* mesh = model->GetMesh(i);
-                Models::AABBox3 aabb = mesh->GetAabBox().ToWorldSpace(modelMatrix);
-                Bounds.min = glm::min(Bounds.min, aabb.min);
-                Bounds.max = glm::max(Bounds.max, aabb.max);
+                return;
+            }
+            const uint32_t index = iterator->second;
+            List.Indices.erase(iterator);
+            if (index != List.Entities.size() - 1)
+            {
+                Engine::Entity* last = List.Entities.back();
+                List.Entities[index] = last;
+                List.Indices[last] = index;
+            }
+            List.Entities.pop_back();
+        };
+
+        if (const auto iterator = EntitiesByName.find(Entity->GetNameId()); iterator != EntitiesByName.end())
+        {
+            removeFrom(iterator->second);
+            if (iterator->second.Entities.empty())
+            {
+                EntitiesByName.erase(iterator);
+            }
+        }
+        for (TagMask mask = Entity->GetTags(); mask != 0; mask &= mask - 1)
+        {
+            removeFrom(EntitiesByTag[std::countr_zero(mask)]);
+        }
+    }
+
+    void Scene::ClearIndex()
+    {
+        EntitiesByName.clear();
+        for (EntityList& list : EntitiesByTag)
+        {
+            list.Entities.clear();
+            list.Indices.clear();
+        }
+    }
+
+    uint64_t Scene::CalculateStateChecksum() const
+    {
+        /*FNV-1a over raw bytes, so any difference in floating point state changes the result*/
+        uint64_t hash = 14695981039346656037ull;
+        const auto combine = [&hash](const void* const Data, const size_t Size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(Data);
+            for (size_t i = 0; i < Size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+
+        std::vector<Transform*> stack{Root->GetTransform()};
+        while (!stack.empty())
+        {
+            Transform* transform = stack.back();
+            stack.pop_back();
+            const glm::vec3 position = transform->GetPositionWorldSpace();
+            const glm::quat rotation = transform->GetRotation();
+            const glm::vec3 scale = transform->GetScale();
+            combine(&position, sizeof(position));
+            combine(&rotation, sizeof(rotation));
+            combine(&scale, sizeof(scale));
+            for (auto iterator = transform->GetChildren().rbegin(); iterator != transform->GetChildren().rend(); ++iterator)
+            {
+                stack.push_back(*iterator);
             }
         }
-        else if (const AnimatedModelRenderer* animatedRenderer = Entity->GetComponent<AnimatedModelRenderer>())
+        return hash;
+    }
+
+    void Scene::CalculateBounds()
+    {
+        ZoneScoped;
+        Bounds = Models::AABBox3(glm::vec3(0.0f), glm::vec3(0.0f));
+
+        ComponentRegistry::ForEach<ModelRenderer>([this](Entity* const Owner, const ModelRenderer* const Renderer)
         {
-            const Models::ModelAnimated* model = animatedRenderer->GetModel();
-            const glm::mat4& modelMatrix = Entity->GetTransform()->GetLocalToWorldMatrix();
+            if (!Contains(Owner))
+            {
+                return;
+            }
+            const Models::Model* model = Renderer->GetModel();
+            const glm::mat4& modelMatrix = Owner->GetTransform()->GetLocalToWorldMatrix();
             for (int i = 0; i < model->GetMeshCount(); ++i)
             {
-                const Models::MeshAnimated* mesh = model->GetMesh(i);
+                const Models::Mesh* mesh = model->GetMesh(i);
                 Models::AABBox3 aabb = mesh->GetAabBox().ToWorldSpace(modelMatrix);
                 Bounds.min = glm::min(Bounds.min, aabb.min);
                 Bounds.max = glm::max(Bounds.max, aabb.max);
             }
-        }
+        });
+
+        ComponentRegistry::ForEach<AnimatedModelRenderer>(
+                [this](Entity* const Owner, const AnimatedModelRenderer* const Renderer)
+                {
+                    // Entities with both renderers are bounded by their ModelRenderer only.
+                    if (!Contains(Owner) || Owner->HasComponent<ModelRenderer>())
+                    {
+                        return;
+                    }
+                    const Models::ModelAnimated* model = Renderer->GetModel();
+                    const glm::mat4& modelMatrix = Owner->GetTransform()->GetLocalToWorldMatrix();
+                    for (int i = 0; i < model->GetMeshCount(); ++i)
+                    {
+                        const Models::MeshAnimated* mesh = model->GetMesh(i);
+                        Models::AABBox3 aabb = mesh->GetAabBox().ToWorldSpace(modelMatrix);
+                        Bounds.min = glm::min(Bounds.min, aabb.min);
+                        Bounds.max = glm::max(Bounds.max, aabb.max);
+                    }
+                });
     }
 }
@@ -2,8 +2,12 @@
 
 #include "Engine/EngineObjects/Entity.h"
 #include "Engine/EngineObjects/LightManager.h"
+#include "Engine/EngineObjects/TransformHierarchy.h"
 #include "Engine/Textures/Texture.h"
+#include <array>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Engine/EngineObjects/GameMode/GameMode.h"
 #include "Engine/EngineObjects/Player/Player.h"
@@ -20,6 +24,12 @@ namespace Models
     class Model;
 }
 
+namespace Serialization
+{
+    class ClassReflection;
+    class CookedFile;
+}
+
 namespace Engine
 {
     namespace Ui
@@ -32,6 +42,18 @@ namespace Engine
      */
     class Scene final
     {
+        friend class Entity;
+
+    private:
+        /**
+         * @brief Entities of a name or tag, with their positions so they're removed without a search.
+         */
+        struct EntityList
+        {
+            std::vector<Entity*> Entities;
+            std::unordered_map<const Entity*, uint32_t> Indices;
+        };
+
     private:
         Entity* Root = nullptr;
         GameMode* GameMode = nullptr;
@@ -42,6 +64,16 @@ namespace Engine
 
         Models::AABBox3 Bounds;
 
+        /*transforms of all entities of this scene, world matrices are updated by UpdateTransforms*/
+        TransformHierarchy Transforms;
+
+        /*entities of this scene grouped by name and by tag, in no particular order*/
+        std::unordered_map<NameId, EntityList> EntitiesByName;
+        std::array<EntityList, MaxTags> EntitiesByTag;
+
+        /*maximum number of threads running the value pass of Deserialize, 0 uses all threads of the JobSystem*/
+        static inline uint32_t DeserializationThreads = 0;
+
     public:
         /**
          * @brief Constructs a new scene.
@@ -81,7 +113,10 @@ namespace Engine
         void SetSkybox(const Texture& Skybox)
         {
             this->Skybox = Skybox;
-            LightManager::GetInstance()->SetEnvironmentMap(Skybox);
+            if (LightManager* const lightManager = LightManager::GetInstance())
+            {
+                lightManager->SetEnvironmentMap(Skybox);
+            }
         }
 
         /**
@@ -174,12 +209,58 @@ namespace Engine
          */
         rapidjson::Value Serialize(rapidjson::Document::AllocatorType& Allocator);
 
+        /**
+         * @brief Saves everything Serialize does except for the "Objects" array.
+         * Used by writers that serialize objects one at a time.
+         * @param Allocator An allocator to be used.
+         * @return Json object without objects.
+         */
+        rapidjson::Value SerializeSettings(rapidjson::Document::AllocatorType& Allocator);
+
         /**
          * @brief Loads this scene from a json.
+         * Objects are created and their references resolved on the calling thread, values of objects are read
+         * in parallel on the JobSystem. Resources requested by objects are loaded on the main thread afterwards.
+         * Components are started in order of serialization.
          * @param Value Serialized scene.
          */
         void Deserialize(const rapidjson::Value& Value);
 
+        /**
+         * @brief Loads this scene from a cooked file, see Serialization::CookedFile.
+         * Objects are created like in Deserialize, but their fields are copied from blocks of the file
+         * and references are resolved by position, without parsing or looking up ids.
+         * @param File Cooked scene file.
+         */
+        void DeserializeCooked(const Serialization::CookedFile& File);
+
+        /**
+         * @brief Creates objects of a cooked scene or prefab and resolves their references.
+         * Values are read in parallel on the JobSystem, components aren't started.
+         * @param File Cooked file to instantiate.
+         * @param Root Entity used for the first object instead of a new one, nullptr to create it.
+         * @param Scene Scene the entities are added to.
+         * @param Threads Maximum number of threads reading values, 0 uses all threads of the JobSystem.
+         * @return Created objects in order of the file, without Root and transforms of entities.
+         */
+        static std::vector<Serialization::SerializedObject*> InstantiateCooked(const Serialization::CookedFile& File,
+                                                                              Entity* Root, Scene* Scene,
+                                                                              uint32_t Threads);
+
+        /**
+         * @brief Returns fields of a scene that are stored in cooked files.
+         */
+        [[nodiscard]] static const Serialization::ClassReflection& GetStaticReflection();
+
+        /**
+         * @brief Limits number of threads used by Deserialize.
+         * @param Threads Maximum number of threads, 0 uses all threads of the JobSystem.
+         */
+        static void SetDeserializationThreads(const uint32_t Threads)
+        {
+            DeserializationThreads = Threads;
+        }
+
         [[nodiscard]] std::string GetPath() const
         {
             return Path;
@@ -187,12 +268,73 @@ namespace Engine
 
         void SetPath(const std::string& Path) { this->Path = Path; }
 
+        /**
+         * @brief Recalculates world matrices of transforms modified since the last call. Called once per frame.
+         */
+        void UpdateTransforms()
+        {
+            Transforms.UpdateWorldMatrices();
+        }
+
         void DeleteEntity(Entity* Entity);
 
+        /**
+         * @brief Checks whether an entity is a part of this scene's hierarchy.
+         * @param Entity Entity to check.
+         * @return True if scene root is an ancestor of the entity or the entity itself.
+         */
+        [[nodiscard]] bool Contains(const Entity* Entity) const;
+
+        /**
+         * @brief Returns all entities of this scene with given name.
+         * @param Name Interned name.
+         */
+        [[nodiscard]] const std::vector<Entity*>& FindEntitiesByName(NameId Name) const;
+
+        /**
+         * @brief Returns any entity of this scene with given name.
+         * @param Name Interned name.
+         * @return Found entity or nullptr.
+         */
+        [[nodiscard]] Entity* FindEntityByName(const NameId Name) const
+        {
+            const std::vector<Entity*>& entities = FindEntitiesByName(Name);
+            return entities.empty() ? nullptr : entities.front();
+        }
+
+        /**
+         * @brief Returns all entities of this scene with given tag.
+         * @param Tag Interned tag.
+         */
+        [[nodiscard]] const std::vector<Entity*>& FindEntitiesWithTag(const TagId Tag) const
+        {
+            static const std::vector<Entity*> empty;
+            return Tag != InvalidTagId ? EntitiesByTag[Tag].Entities : empty;
+        }
+
+        /**
+         * @brief Hashes positions, rotations and scales of all entities in hierarchy order.
+         * Used to check that two runs of the same simulation ended in the same state.
+         */
+        [[nodiscard]] uint64_t CalculateStateChecksum() const;
+
     private:
+        /**
+         * @brief Replaces the UI, game mode and player with new objects of given types.
+         * Empty names create the default implementations.
+         */
+        void CreateGameplayObjects(const std::string& UiType, const std::string& GameModeType,
+                                   const std::string& PlayerType);
+
         void CalculateBounds();
 
-    private:
-        void CalculateBounds(Entity* Entity);
+        void AddToIndex(Entity* Entity);
+
+        void RemoveFromIndex(const Entity* Entity);
+
+        /**
+         * @brief Empties the name and tag index, so entities deleted afterwards don't have to be removed one by one.
+         */
+        void ClearIndex();
     };
 }
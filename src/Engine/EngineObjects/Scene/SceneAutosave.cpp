@@ -0,0 +1,154 @@
+#include "SceneAutosave.h"
+
+#include <filesystem>
+
+#include "Scene.h"
+#include "Engine/EngineObjects/Entity.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /**
+     * @brief Everything the background job writes, owned by the job so the scene can change in the meantime.
+     */
+    struct AutosaveSnapshot
+    {
+        std::string Path;
+        rapidjson::MemoryPoolAllocator<> Allocator;
+        rapidjson::Value Settings;
+        std::vector<std::shared_ptr<const std::vector<std::string>>> Entities;
+    };
+
+    std::string ToCompactJson(const rapidjson::Value& Value, rapidjson::StringBuffer& Buffer)
+    {
+        Buffer.Clear();
+        rapidjson::Writer<rapidjson::StringBuffer> writer(Buffer);
+        Value.Accept(writer);
+        return std::string(Buffer.GetString(), Buffer.GetSize());
+    }
+
+    void WriteSnapshot(const AutosaveSnapshot& Snapshot)
+    {
+        ZoneScoped;
+        /*the previous autosave stays intact until the new one is complete*/
+        const std::string temporaryPath = Snapshot.Path + ".tmp";
+        {
+            Serialization::JsonOutputFile file(temporaryPath.c_str());
+            if (!file.IsOpen())
+            {
+                spdlog::error("Failed to autosave scene to {0}.", Snapshot.Path);
+                return;
+            }
+            rapidjson::Writer<rapidjson::FileWriteStream> writer(file.GetStream());
+            writer.StartObject();
+            for (const auto& member : Snapshot.Settings.GetObject())
+            {
+                writer.Key(member.name.GetString(), member.name.GetStringLength());
+                member.value.Accept(writer);
+            }
+            writer.Key("Objects");
+            writer.StartArray();
+            for (const auto& entity : Snapshot.Entities)
+            {
+                for (const std::string& object : *entity)
+                {
+                    writer.RawValue(object.data(), object.size(), rapidjson::kObjectType);
+                }
+            }
+            writer.EndArray();
+            writer.EndObject();
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, Snapshot.Path, error);
+        if (error)
+        {
+            spdlog::error("Failed to autosave scene to {0}: {1}.", Snapshot.Path, error.message());
+        }
+    }
+}
+
+namespace Engine
+{
+    SceneAutosave::SceneAutosave(std::string Path) :
+        Path(std::move(Path))
+    {
+    }
+
+    SceneAutosave::~SceneAutosave()
+    {
+        Wait();
+    }
+
+    bool SceneAutosave::Save(Scene* const Scene)
+    {
+        ZoneScoped;
+        if (IsWriting())
+        {
+            return false;
+        }
+
+        auto snapshot = std::make_shared<AutosaveSnapshot>();
+        snapshot->Path = Path;
+        snapshot->Settings = Scene->SerializeSettings(snapshot->Allocator);
+
+        std::unordered_map<const Entity*, std::shared_ptr<const SerializedEntity>> entities;
+        entities.reserve(Entities.size());
+        rapidjson::MemoryPoolAllocator<> allocator;
+        rapidjson::StringBuffer buffer;
+        LastSerializedCount = 0;
+
+        /*entities are visited in the order Scene::Serialize writes them, the root is saved with the settings*/
+        std::vector<Entity*> stack = {Scene->GetRoot()};
+        while (!stack.empty())
+        {
+            Entity* entity = stack.back();
+            stack.pop_back();
+            const bool isRoot = entity == Scene->GetRoot();
+
+            /*entities are modified when they're created, so a reused address is never mistaken for a cached one*/
+            std::shared_ptr<const SerializedEntity>& serialized = entities[entity];
+            const auto cached = Entities.find(entity);
+            if (entity->ClearModified() || cached == Entities.end())
+            {
+                auto objects = std::make_shared<SerializedEntity>();
+                if (!isRoot)
+                {
+                    objects->push_back(ToCompactJson(entity->Serialize(allocator), buffer));
+                }
+                for (const Component* component : *entity)
+                {
+                    objects->push_back(ToCompactJson(component->Serialize(allocator), buffer));
+                }
+                allocator.Clear();
+                serialized = std::move(objects);
+                ++LastSerializedCount;
+            }
+            else
+            {
+                serialized = cached->second;
+            }
+            snapshot->Entities.push_back(serialized);
+
+            const std::vector<Transform*>& children = entity->GetTransform()->GetChildren();
+            for (auto child = children.rbegin(); child != children.rend(); ++child)
+            {
+                stack.push_back((*child)->GetOwner());
+            }
+        }
+        Entities = std::move(entities);
+
+        JobSystem::GetInstance()->Schedule([snapshot] { WriteSnapshot(*snapshot); }, &Writing, nullptr,
+                                           "WriteAutosave");
+        return true;
+    }
+
+    void SceneAutosave::Wait()
+    {
+        JobSystem::GetInstance()->Wait(Writing);
+    }
+} // Engine
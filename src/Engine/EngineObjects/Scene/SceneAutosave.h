@@ -0,0 +1,78 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/EngineObjects/JobSystem.h"
+
+namespace Engine
+{
+    class Entity;
+    class Scene;
+
+    /**
+     * @brief Saves a scene repeatedly to one file, serializing only entities modified since the previous save.
+     * Serialized entities are kept as compact json, the file is written from a snapshot of them on the JobSystem
+     * so the calling thread only pays for modified entities.
+     */
+    class SceneAutosave final
+    {
+    private:
+        /*an entity followed by its components, every object as compact json*/
+        using SerializedEntity = std::vector<std::string>;
+
+    private:
+        std::string Path;
+        std::unordered_map<const Entity*, std::shared_ptr<const SerializedEntity>> Entities;
+        /*counts the job writing the last snapshot*/
+        JobCounter Writing;
+        size_t LastSerializedCount = 0;
+
+    public:
+        /**
+         * @param Path File to save scenes to.
+         */
+        explicit SceneAutosave(std::string Path);
+
+        /**
+         * @brief Waits for the last snapshot to be written.
+         */
+        ~SceneAutosave();
+
+        SceneAutosave(const SceneAutosave&) = delete;
+
+        SceneAutosave& operator=(const SceneAutosave&) = delete;
+
+    public:
+        /**
+         * @brief Serializes modified entities and starts writing the file in the background. Main thread only.
+         * @param Scene Scene to save.
+         * @return False if the previous snapshot is still being written, nothing is saved then.
+         */
+        bool Save(Scene* Scene);
+
+        /**
+         * @brief Blocks until the last snapshot is written.
+         */
+        void Wait();
+
+        [[nodiscard]] bool IsWriting() const
+        {
+            return !Writing.IsDone();
+        }
+
+        [[nodiscard]] const std::string& GetPath() const
+        {
+            return Path;
+        }
+
+        /**
+         * @brief Returns number of entities serialized by the last Save, the rest was reused.
+         */
+        [[nodiscard]] size_t GetLastSerializedCount() const
+        {
+            return LastSerializedCount;
+        }
+    };
+} // Engine
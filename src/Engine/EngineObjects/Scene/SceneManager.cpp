@@ -1,22 +1,212 @@
 #include "SceneManager.h"
 
+#include <algorithm>
+#include <chrono>
+
+#include "Engine/EngineObjects/AssetHotReload.h"
+#include "Engine/EngineObjects/Entity.h"
+#include "rapidjson/prettywriter.h"
+#include "rapidjson/writer.h"
+#include "Serialization/CookedFilesUtility.h"
 #include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
 #include "Engine/EngineObjects/LightManager.h"
 
-namespace Engine
+namespace
 {
-    void SceneManager::SaveScene(const std::string& Path, Scene* const Scene)
+    /**
+     * @brief Writes an entity, its components and its descendants in the order of Entity::SerializeEntity.
+     */
+    template<class TWriter>
+    void WriteEntity(const Engine::Entity* Entity, TWriter& Writer, rapidjson::MemoryPoolAllocator<>& Allocator)
+    {
+        Entity->Serialize(Allocator).Accept(Writer);
+        for (const Engine::Component* component : *Entity)
+        {
+            component->Serialize(Allocator).Accept(Writer);
+        }
+        /*only one entity is kept in memory at a time*/
+        Allocator.Clear();
+        for (const Engine::Transform* transform : *Entity->GetTransform())
+        {
+            WriteEntity(transform->GetOwner(), Writer, Allocator);
+        }
+    }
+
+    /**
+     * @brief Writes the same json as Scene::Serialize without building it in memory first.
+     */
+    template<class TWriter>
+    void WriteScene(Engine::Scene* Scene, TWriter& Writer)
     {
+        Writer.StartObject();
+        {
+            rapidjson::MemoryPoolAllocator<> allocator;
+            const rapidjson::Value settings = Scene->SerializeSettings(allocator);
+            for (const auto& member : settings.GetObject())
+            {
+                Writer.Key(member.name.GetString(), member.name.GetStringLength());
+                member.value.Accept(Writer);
+            }
+        }
+
         rapidjson::MemoryPoolAllocator<> allocator;
-        const rapidjson::Value json = Scene->Serialize(allocator);
-        Serialization::WriteJsonFile(Path.c_str(), json);
+        Writer.Key("Objects");
+        Writer.StartArray();
+        const Engine::Entity* root = Scene->GetRoot();
+        for (const Engine::Component* component : *root)
+        {
+            component->Serialize(allocator).Accept(Writer);
+        }
+        allocator.Clear();
+        for (const Engine::Transform* transform : *root->GetTransform())
+        {
+            WriteEntity(transform->GetOwner(), Writer, allocator);
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+    }
+}
+
+namespace Engine
+{
+    std::vector<SceneManager::StreamedScene> SceneManager::Streams;
+    std::unique_ptr<SceneAutosave> SceneManager::Autosave;
+
+    void SceneManager::SaveScene(const std::string& Path, Scene* const Scene, const bool Pretty)
+    {
+        ZoneScoped;
+        {
+            Serialization::JsonOutputFile file(Path.c_str());
+            if (!file.IsOpen())
+            {
+                spdlog::error("Failed to save scene to {0}.", Path);
+                return;
+            }
+            if (Pretty)
+            {
+                rapidjson::PrettyWriter<rapidjson::FileWriteStream> writer(file.GetStream());
+                WriteScene(Scene, writer);
+            }
+            else
+            {
+                rapidjson::Writer<rapidjson::FileWriteStream> writer(file.GetStream());
+                WriteScene(Scene, writer);
+            }
+        }
+        /*the file is closed, so the watcher sees its final write time*/
+        AssetHotReload::OnAssetSaved(Path);
+    }
+
+    void SceneManager::UpdateAutosave(Scene* const Scene, const float DeltaTime)
+    {
+        if (AutosaveIntervalSeconds <= 0.0f || Scene->GetPath().empty())
+        {
+            return;
+        }
+        TimeSinceAutosave += DeltaTime;
+        if (TimeSinceAutosave < AutosaveIntervalSeconds)
+        {
+            return;
+        }
+
+        const std::string path = GetAutosavePath(Scene->GetPath());
+        if (Autosave == nullptr || Autosave->GetPath() != path)
+        {
+            Autosave = std::make_unique<SceneAutosave>(path);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (Autosave->Save(Scene))
+        {
+            TimeSinceAutosave = 0.0f;
+            const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - start;
+            spdlog::info("Autosaving {0}, serialized {1} modified entities in {2:.2f} ms.", path,
+                         Autosave->GetLastSerializedCount(), time.count());
+        }
+    }
+
+    void SceneManager::FinishAutosave()
+    {
+        Autosave.reset();
     }
 
     void SceneManager::LoadScene(const std::string& Path, Scene* Scene)
     {
+        const auto start = std::chrono::steady_clock::now();
+        Serialization::CookedFile cooked;
         rapidjson::Document data;
-        Serialization::ReadJsonFile(Path.c_str(), data);
-        Scene->Deserialize(data);
+        const bool isCooked = Serialization::ReadCookedFile(Path, cooked) && cooked.IsScene();
+        if (!isCooked)
+        {
+            Serialization::ReadJsonFile(Path.c_str(), data);
+        }
+        const auto read = std::chrono::steady_clock::now();
+        if (isCooked)
+        {
+            Scene->DeserializeCooked(cooked);
+        }
+        else
+        {
+            Scene->Deserialize(data);
+        }
         Scene->SetPath(Path);
+
+        const std::chrono::duration<float, std::milli> readTime = read - start;
+        const std::chrono::duration<float, std::milli> deserializeTime = std::chrono::steady_clock::now() - read;
+        spdlog::info("Loaded {0} scene {1} in {2:.2f} ms (read {3:.2f} ms, deserialize {4:.2f} ms).",
+                     isCooked ? "cooked" : "json", Path, readTime.count() + deserializeTime.count(), readTime.count(),
+                     deserializeTime.count());
+    }
+
+    SceneStream* SceneManager::StreamScene(const std::string& Path, Scene* const Scene)
+    {
+        for (StreamedScene& streamed : Streams)
+        {
+            if (streamed.Stream->GetPath() == Path)
+            {
+                if (Scene != nullptr)
+                {
+                    streamed.Target = Scene;
+                }
+                return streamed.Stream.get();
+            }
+        }
+        spdlog::info("Streaming scene {0}.", Path);
+        Streams.push_back(StreamedScene{std::make_unique<SceneStream>(Path), Scene});
+        return Streams.back().Stream.get();
+    }
+
+    void SceneManager::ActivateScene(const std::string& Path, Scene* const Scene)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        SceneStream* stream = StreamScene(Path);
+        stream->Finish();
+        stream->Activate(Scene);
+        std::erase_if(Streams, [stream](const StreamedScene& Streamed) { return Streamed.Stream.get() == stream; });
+
+        const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - start;
+        spdlog::info("Activated scene {0} in {1:.2f} ms.", Path, time.count());
+    }
+
+    void SceneManager::UpdateStreams()
+    {
+        if (Streams.empty())
+        {
+            return;
+        }
+        ZoneScoped;
+        const auto start = std::chrono::steady_clock::now();
+        for (const StreamedScene& streamed : Streams)
+        {
+            const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            streamed.Stream->Update(std::max(StreamingBudgetMilliseconds - elapsed.count(), 0.0f));
+        }
+
+        /*activation replaces the whole scene, so it happens before anything is updated this frame*/
+        std::erase_if(Streams, [](const StreamedScene& Streamed)
+        {
+            return Streamed.Target != nullptr && Streamed.Stream->Activate(Streamed.Target);
+        });
     }
 } // Engine
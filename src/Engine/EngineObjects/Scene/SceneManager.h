@@ -1,13 +1,35 @@
 #pragma once
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "Scene.h"
+#include "SceneAutosave.h"
+#include "SceneStream.h"
 
 namespace Engine
 {
 
     class SceneManager
     {
+    private:
+        struct StreamedScene
+        {
+            std::unique_ptr<SceneStream> Stream;
+            /*scene the stream is activated in once it's ready, nullptr if it's only preloaded*/
+            Scene* Target;
+        };
+
+    private:
+        static std::vector<StreamedScene> Streams;
+        /*time per frame spent uploading streamed assets*/
+        static inline float StreamingBudgetMilliseconds = 4.0f;
+
+        static std::unique_ptr<SceneAutosave> Autosave;
+        /*0 disables autosaving*/
+        static inline float AutosaveIntervalSeconds = 60.0f;
+        static inline float TimeSinceAutosave = 0.0f;
+
     private:
         SceneManager()
         {
@@ -15,17 +37,76 @@ namespace Engine
 
     public:
         /**
-         * @brief Saves scene to a file.
+         * @brief Saves scene to a file, objects are written one by one as they're serialized.
          * @param Path Path of a scene file.
          * @param Scene Scene to save.
+         * @param Pretty Whether to indent the file, compact files are smaller and faster to write.
          */
-        static void SaveScene(const std::string& Path, Scene* Scene);
+        static void SaveScene(const std::string& Path, Scene* Scene, bool Pretty = false);
 
         /**
-         * @brief Loads scene from a file.
+         * @brief Autosaves a scene once the autosave interval passes, see SceneAutosave.
+         * Called every frame by the editor.
+         * @param Scene Scene to save, it's saved next to its file.
+         * @param DeltaTime Time since the last call in seconds.
+         */
+        static void UpdateAutosave(Scene* Scene, float DeltaTime);
+
+        /**
+         * @brief Waits until the last autosave is written, has to be called before the JobSystem shuts down.
+         */
+        static void FinishAutosave();
+
+        /**
+         * @brief Sets time between autosaves.
+         * @param Seconds Interval, 0 disables autosaving.
+         */
+        static void SetAutosaveInterval(const float Seconds)
+        {
+            AutosaveIntervalSeconds = Seconds;
+        }
+
+        [[nodiscard]] static std::string GetAutosavePath(const std::string& ScenePath)
+        {
+            return ScenePath + ".autosave";
+        }
+
+        /**
+         * @brief Loads scene from a file, or from its cooked version if it's up to date.
          * @param Path Path of a scene file.
          * @param Scene Scene to load data to.
          */
         static void LoadScene(const std::string& Path, Scene* Scene);
+
+        /**
+         * @brief Starts loading a scene and its assets in the background, see SceneStream.
+         * Can be used to preload the next level while the current one is played.
+         * @param Path Path of a scene file.
+         * @param Scene Scene to load the data to once it's ready, nullptr to keep it until ActivateScene is called.
+         * @return Stream of the scene, can be polled for progress until it's activated.
+         */
+        static SceneStream* StreamScene(const std::string& Path, Scene* Scene = nullptr);
+
+        /**
+         * @brief Loads a streamed scene to a scene, waiting for the stream to finish if needed.
+         * Starts streaming if the scene wasn't streamed before.
+         * @param Path Path of a scene file.
+         * @param Scene Scene to load data to.
+         */
+        static void ActivateScene(const std::string& Path, Scene* Scene);
+
+        /**
+         * @brief Uploads assets of streamed scenes and activates ready ones. Called once per frame by the engine.
+         */
+        static void UpdateStreams();
+
+        /**
+         * @brief Sets time per frame spent uploading streamed assets.
+         * @param Milliseconds Time budget, at least one asset is uploaded per frame regardless.
+         */
+        static void SetStreamingBudget(const float Milliseconds)
+        {
+            StreamingBudgetMilliseconds = Milliseconds;
+        }
     };
 } // Engine
@@ -0,0 +1,211 @@
+#include "SceneSnapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "Scene.h"
+#include "Engine/EngineObjects/Entity.h"
+#include "Serialization/GuidHasher.h"
+#include "Serialization/Reflection.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /*objects a delta adds are the ones its baseline lookup doesn't find*/
+    constexpr uint32_t NotFound = Engine::SceneSnapshot::NotInBaseline;
+
+    /**
+     * @brief Visits every reflected object with state, entities are visited in the order Scene::Serialize
+     * writes them, each with its transform first.
+     */
+    template<class TFunction>
+    void ForEachObject(Engine::Scene* const Scene, TFunction&& Function)
+    {
+        const auto visit = [&Function](Engine::Entity* const Owner, Serialization::SerializedObject* const Object)
+        {
+            const Serialization::ClassReflection* reflection = Object->GetReflection();
+            if (reflection != nullptr && reflection->HasState())
+            {
+                Function(Owner, Object, *reflection);
+            }
+        };
+
+        std::vector<Engine::Entity*> stack = {Scene->GetRoot()};
+        while (!stack.empty())
+        {
+            Engine::Entity* entity = stack.back();
+            stack.pop_back();
+            visit(entity, entity->GetTransform());
+            for (Engine::Component* component : *entity)
+            {
+                visit(entity, component);
+            }
+
+            const std::vector<Engine::Transform*>& children = entity->GetTransform()->GetChildren();
+            for (auto child = children.rbegin(); child != children.rend(); ++child)
+            {
+                stack.push_back((*child)->GetOwner());
+            }
+        }
+    }
+
+    /**
+     * @brief Finds objects of a snapshot by id, expecting them to be requested in the order they were captured.
+     */
+    class ObjectLookup
+    {
+    private:
+        std::span<const Engine::SceneSnapshot::ObjectState> Objects;
+        size_t Next = 0;
+        /*built when an object isn't found at the expected position*/
+        std::unordered_map<Utility::Guid, uint32_t, Serialization::GuidHasher> Indices;
+
+    public:
+        explicit ObjectLookup(const std::span<const Engine::SceneSnapshot::ObjectState> Objects) :
+            Objects(Objects)
+        {
+        }
+
+    public:
+        /**
+         * @brief Returns index of an object or NotFound.
+         */
+        uint32_t Find(const Utility::Guid& Id)
+        {
+            if (Next < Objects.size() && Objects[Next].Id == Id)
+            {
+                return static_cast<uint32_t>(Next++);
+            }
+            if (Indices.empty())
+            {
+                Indices.reserve(Objects.size());
+                for (uint32_t i = 0; i < Objects.size(); ++i)
+                {
+                    Indices.emplace(Objects[i].Id, i);
+                }
+            }
+            const auto iterator = Indices.find(Id);
+            if (iterator == Indices.end())
+            {
+                return NotFound;
+            }
+            /*objects were added or removed, the following ones are likely in order again*/
+            Next = iterator->second + 1;
+            return iterator->second;
+        }
+    };
+}
+
+namespace Engine
+{
+    SceneSnapshot SceneSnapshot::Capture(Scene* const Scene)
+    {
+        return CaptureObjects(Scene, nullptr);
+    }
+
+    SceneSnapshot SceneSnapshot::CaptureDelta(Scene* const Scene, std::shared_ptr<const SceneSnapshot> Baseline)
+    {
+        if (Baseline != nullptr && Baseline->Baseline != nullptr)
+        {
+            Baseline = Baseline->Baseline;
+        }
+        return CaptureObjects(Scene, std::move(Baseline));
+    }
+
+    SceneSnapshot SceneSnapshot::CaptureObjects(Scene* const Scene, std::shared_ptr<const SceneSnapshot> Baseline)
+    {
+        ZoneScoped;
+        SceneSnapshot snapshot;
+        snapshot.Baseline = std::move(Baseline);
+        const SceneSnapshot* baseline = snapshot.Baseline.get();
+        ObjectLookup lookup(baseline != nullptr ? std::span(baseline->Objects) : std::span<const ObjectState>());
+
+        ForEachObject(Scene, [&snapshot, baseline, &lookup](Entity*, Serialization::SerializedObject* const Object,
+                                                            const Serialization::ClassReflection& Reflection)
+        {
+            const auto offset = static_cast<uint32_t>(snapshot.Data.size());
+            Serialization::WriteState(Object->GetReflectedFields(), Reflection, snapshot.Data);
+            ObjectState state = {Object->GetID(), NotInBaseline, offset,
+                                 static_cast<uint32_t>(snapshot.Data.size()) - offset};
+            if (baseline != nullptr)
+            {
+                state.BaselineIndex = lookup.Find(state.Id);
+                if (state.BaselineIndex != NotFound)
+                {
+                    const std::span<const uint8_t> previous =
+                            baseline->GetState(baseline->Objects[state.BaselineIndex]);
+                    if (previous.size() == state.Size &&
+                        std::memcmp(previous.data(), snapshot.Data.data() + offset, state.Size) == 0)
+                    {
+                        snapshot.Data.resize(offset);
+                        return;
+                    }
+                }
+            }
+            snapshot.Objects.push_back(state);
+        });
+
+        if (baseline != nullptr)
+        {
+            /*objects missing from the baseline are sorted last, NotInBaseline is the largest index*/
+            std::ranges::stable_sort(snapshot.Objects, {}, &ObjectState::BaselineIndex);
+        }
+        return snapshot;
+    }
+
+    size_t SceneSnapshot::Restore(Scene* const Scene) const
+    {
+        ZoneScoped;
+        const SceneSnapshot& full = IsDelta() ? *Baseline : *this;
+        ObjectLookup lookup(full.Objects);
+        const auto added = IsDelta()
+                               ? std::ranges::lower_bound(Objects, NotInBaseline, {}, &ObjectState::BaselineIndex)
+                               : Objects.end();
+        ObjectLookup addedLookup(std::span(added, Objects.end()));
+
+        std::vector<uint8_t> current;
+        size_t restored = 0;
+        ForEachObject(Scene, [&](Entity* const Owner, Serialization::SerializedObject* const Object,
+                                 const Serialization::ClassReflection& Reflection)
+        {
+            const Utility::Guid id = Object->GetID();
+            const uint32_t index = lookup.Find(id);
+            std::span<const uint8_t> state;
+            if (index != NotFound)
+            {
+                const auto changed = std::ranges::lower_bound(Objects.begin(), added, index, {},
+                                                              &ObjectState::BaselineIndex);
+                state = changed != added && changed->BaselineIndex == index
+                            ? GetState(*changed)
+                            : full.GetState(full.Objects[index]);
+            }
+            else if (const uint32_t addedIndex = addedLookup.Find(id); addedIndex != NotFound)
+            {
+                state = GetState(added[addedIndex]);
+            }
+            else
+            {
+                return;
+            }
+
+            /*restoring marks transforms and entities dirty, so unchanged objects are left alone*/
+            current.clear();
+            Serialization::WriteState(Object->GetReflectedFields(), Reflection, current);
+            if (current.size() == state.size() && std::memcmp(current.data(), state.data(), state.size()) == 0)
+            {
+                return;
+            }
+            if (!Serialization::ReadState(state, Object->GetReflectedFields(), Reflection))
+            {
+                spdlog::error("Snapshot state of {0} doesn't match its fields.", Object->GetType());
+                return;
+            }
+            Object->OnFieldsRestored();
+            Owner->MarkModified();
+            ++restored;
+        });
+        return restored;
+    }
+} // Engine
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Utility/GuidUtility.h"
+
+namespace Engine
+{
+    class Scene;
+
+    /**
+     * @brief In-memory state of every reflected object of a scene: transforms, reflected component fields
+     * and their runtime fields, like rigidbody velocities. Restoring writes the state back to objects that still
+     * exist, nothing is created or destroyed and assigned resources are left as they are.
+     * A delta snapshot only keeps objects changed since a full baseline snapshot.
+     */
+    class SceneSnapshot final
+    {
+    public:
+        static constexpr uint32_t NotInBaseline = std::numeric_limits<uint32_t>::max();
+
+        struct ObjectState
+        {
+            Utility::Guid Id;
+            /*index of the object in the baseline, NotInBaseline in full snapshots and for objects added since*/
+            uint32_t BaselineIndex;
+            uint32_t Offset;
+            uint32_t Size;
+        };
+
+    private:
+        std::shared_ptr<const SceneSnapshot> Baseline;
+        /*full snapshots keep objects in scene order, deltas keep them sorted by BaselineIndex*/
+        std::vector<ObjectState> Objects;
+        std::vector<uint8_t> Data;
+
+    public:
+        /**
+         * @brief Captures state of every object of a scene.
+         * @param Scene Scene to capture. Main thread only.
+         */
+        [[nodiscard]] static SceneSnapshot Capture(Scene* Scene);
+
+        /**
+         * @brief Captures state of objects changed since a baseline.
+         * Deltas are always relative to a full snapshot, a delta given as baseline is replaced by its own baseline.
+         * @param Scene Scene to capture. Main thread only.
+         * @param Baseline Snapshot of the same scene.
+         */
+        [[nodiscard]] static SceneSnapshot CaptureDelta(Scene* Scene, std::shared_ptr<const SceneSnapshot> Baseline);
+
+        /**
+         * @brief Writes captured state back to objects of a scene, objects whose state didn't change are skipped.
+         * Objects created after the capture keep their state.
+         * @param Scene Scene the snapshot was captured from. Main thread only.
+         * @return Number of restored objects.
+         */
+        size_t Restore(Scene* Scene) const;
+
+        [[nodiscard]] bool IsDelta() const
+        {
+            return Baseline != nullptr;
+        }
+
+        /**
+         * @brief Returns number of objects stored in this snapshot, not counting the baseline.
+         */
+        [[nodiscard]] size_t GetObjectCount() const
+        {
+            return Objects.size();
+        }
+
+        /**
+         * @brief Returns memory used by this snapshot in bytes, not counting the baseline.
+         */
+        [[nodiscard]] size_t GetSize() const
+        {
+            return Objects.size() * sizeof(ObjectState) + Data.size();
+        }
+
+    private:
+        static SceneSnapshot CaptureObjects(Scene* Scene, std::shared_ptr<const SceneSnapshot> Baseline);
+
+        [[nodiscard]] std::span<const uint8_t> GetState(const ObjectState& Object) const
+        {
+            return {Data.data() + Object.Offset, Object.Size};
+        }
+    };
+} // Engine
@@ -0,0 +1,330 @@
+#include "SceneStream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "Scene.h"
+#include "Engine/Prefabs/PrefabLoader.h"
+#include "Engine/Textures/TextureManager.h"
+#include "Materials/MaterialManager.h"
+#include "Models/Model.h"
+#include "Models/ModelManager.h"
+#include "Shaders/ShaderManager.h"
+#include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /**
+     * @brief Removes paths of assets that are already loaded.
+     */
+    template<class TPredicate>
+    void RemoveLoaded(std::vector<std::string>& Paths, TPredicate&& IsLoaded)
+    {
+        std::erase_if(Paths, [&IsLoaded](const std::string& Path) { return IsLoaded(Path); });
+    }
+
+    float GetMillisecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+}
+
+namespace Engine
+{
+    SceneStream::SceneStream(std::string Path) :
+        Path(std::move(Path))
+    {
+        JobSystem::GetInstance()->Schedule([this] { Read(); }, &Jobs, nullptr, "ReadScene");
+    }
+
+    SceneStream::~SceneStream()
+    {
+        /*jobs write to this stream until they finish*/
+        JobSystem::GetInstance()->Wait(Jobs);
+    }
+
+    void SceneStream::Read()
+    {
+        ZoneScoped;
+        const bool isCooked = Serialization::ReadCookedFile(Path, Cooked);
+        if (!isCooked)
+        {
+            Serialization::ReadJsonFile(Path.c_str(), Document);
+        }
+        if (!Serialization::ReadManifest(Path, Manifest))
+        {
+            if (isCooked)
+            {
+                Serialization::ReadJsonFile(Path.c_str(), Document);
+            }
+            /*walking materials and prefabs reads every one of them, built manifests skip that*/
+            Manifest = Serialization::BuildManifest(Document);
+        }
+        CompletedSteps.fetch_add(1);
+        IsRead.store(true, std::memory_order_release);
+    }
+
+    void SceneStream::StartDecoding()
+    {
+        using Serialization::AssetType;
+
+        /*managers aren't thread safe, so loaded assets are filtered on the main thread*/
+        RemoveLoaded(Manifest.Textures, [](const std::string& Texture)
+        {
+            return TextureManager::IsValid(Texture.c_str());
+        });
+        RemoveLoaded(Manifest.Models, [](const std::string& Model)
+        {
+            return Models::ModelManager::IsValid(Model.c_str());
+        });
+        RemoveLoaded(Manifest.Materials, [](const std::string& Material)
+        {
+            return Materials::MaterialManager::IsValid(Material);
+        });
+
+        /*hdr textures are converted to cube maps on the GPU*/
+        for (const std::string& texturePath : Manifest.Textures)
+        {
+            if (texturePath.ends_with(".dds"))
+            {
+                StreamedTextures.push_back(texturePath);
+            }
+            else
+            {
+                MainThreadLoads.push_back({AssetType::Texture, [&texturePath]
+                {
+                    TextureManager::GetTexture(texturePath.c_str());
+                }});
+            }
+        }
+        /*materials are created once all their textures are uploaded*/
+        for (const std::string& materialPath : Manifest.Materials)
+        {
+            MainThreadLoads.push_back({AssetType::Material, [&materialPath]
+            {
+                Materials::MaterialManager::GetMaterial(materialPath);
+            }});
+        }
+        for (const Shaders::ShaderSourceFiles& files : Manifest.Shaders)
+        {
+            MainThreadLoads.push_back({AssetType::Shader, [&files] { Shaders::ShaderManager::GetShader(files); }});
+        }
+        for (const std::string& shaderPath : Manifest.ComputeShaders)
+        {
+            MainThreadLoads.push_back({AssetType::ComputeShader, [&shaderPath]
+            {
+                Shaders::ShaderManager::GetComputeShader(shaderPath.c_str());
+            }});
+        }
+        for (const std::string& modelPath : Manifest.AnimatedModels)
+        {
+            MainThreadLoads.push_back({AssetType::AnimatedModel, [&modelPath]
+            {
+                Models::ModelManager::GetAnimatedModel(modelPath.c_str());
+            }});
+        }
+        for (const std::string& animationPath : Manifest.Animations)
+        {
+            MainThreadLoads.push_back({AssetType::Animation, [&animationPath]
+            {
+                Models::ModelManager::GetAnimation(animationPath.c_str());
+            }});
+        }
+        for (const std::string& prefabPath : Manifest.Prefabs)
+        {
+            MainThreadLoads.push_back({AssetType::Prefab, [&prefabPath] { PrefabLoader::Preload(prefabPath); }});
+        }
+
+        Timings[static_cast<size_t>(AssetType::Texture)].Count = StreamedTextures.size();
+        Timings[static_cast<size_t>(AssetType::Model)].Count = Manifest.Models.size();
+        for (const MainThreadLoad& load : MainThreadLoads)
+        {
+            ++Timings[static_cast<size_t>(load.Type)].Count;
+        }
+
+        PendingUploads = StreamedTextures.size() + Manifest.Models.size();
+        TotalSteps = 1 + PendingUploads * 2 + MainThreadLoads.size();
+        for (const std::string& texturePath : StreamedTextures)
+        {
+            JobSystem::GetInstance()->Schedule([this, &texturePath] { DecodeTexture(texturePath); }, &Jobs, nullptr,
+                                               "DecodeTexture");
+        }
+        for (const std::string& modelPath : Manifest.Models)
+        {
+            JobSystem::GetInstance()->Schedule([this, &modelPath] { DecodeModel(modelPath); }, &Jobs, nullptr,
+                                               "DecodeModel");
+        }
+        IsDecodingStarted = true;
+    }
+
+    void SceneStream::DecodeTexture(const std::string& TexturePath)
+    {
+        ZoneScoped;
+        const auto start = std::chrono::steady_clock::now();
+        DecodedTexture texture{TexturePath, Utility::DdsImage()};
+        if (!Utility::ReadDds(TexturePath.c_str(), texture.Image))
+        {
+            spdlog::warn("Failed to stream texture {0}, it will be loaded with the scene.", TexturePath);
+        }
+        Timings[static_cast<size_t>(Serialization::AssetType::Texture)].DecodeNanoseconds.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        CompletedSteps.fetch_add(1);
+        std::lock_guard lock(DecodedMutex);
+        DecodedTextures.push_back(std::move(texture));
+    }
+
+    void SceneStream::DecodeModel(const std::string& ModelPath)
+    {
+        ZoneScoped;
+        const auto start = std::chrono::steady_clock::now();
+        DecodedModel model{ModelPath, Models::Model::Read(ModelPath.c_str())};
+        Timings[static_cast<size_t>(Serialization::AssetType::Model)].DecodeNanoseconds.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        CompletedSteps.fetch_add(1);
+        std::lock_guard lock(DecodedMutex);
+        DecodedModels.push_back(std::move(model));
+    }
+
+    void SceneStream::Update(const float BudgetMilliseconds)
+    {
+        ZoneScoped;
+        if (IsReadyFlag || !IsRead.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        if (!IsDecodingStarted)
+        {
+            StartDecoding();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto isOverBudget = [start, BudgetMilliseconds]
+        {
+            return GetMillisecondsSince(start) >= BudgetMilliseconds;
+        };
+
+        while (PendingUploads > 0)
+        {
+            DecodedTexture texture;
+            DecodedModel model;
+            bool hasTexture = false;
+            bool hasModel = false;
+            {
+                std::lock_guard lock(DecodedMutex);
+                if (!DecodedTextures.empty())
+                {
+                    texture = std::move(DecodedTextures.back());
+                    DecodedTextures.pop_back();
+                    hasTexture = true;
+                }
+                else if (!DecodedModels.empty())
+                {
+                    model = std::move(DecodedModels.back());
+                    DecodedModels.pop_back();
+                    hasModel = true;
+                }
+            }
+            if (!hasTexture && !hasModel)
+            {
+                /*waiting for decoding jobs*/
+                return;
+            }
+
+            const auto uploadStart = std::chrono::steady_clock::now();
+            if (hasTexture && !texture.Image.Data.empty())
+            {
+                TextureManager::AddTexture(texture.Path.c_str(), texture.Image);
+            }
+            else if (hasModel)
+            {
+                Models::ModelManager::AddModel(model.Path.c_str(), model.Meshes);
+            }
+            const Serialization::AssetType type =
+                    hasTexture ? Serialization::AssetType::Texture : Serialization::AssetType::Model;
+            Timings[static_cast<size_t>(type)].LoadMilliseconds += GetMillisecondsSince(uploadStart);
+            --PendingUploads;
+            CompletedSteps.fetch_add(1);
+            if (isOverBudget())
+            {
+                return;
+            }
+        }
+
+        while (CompletedLoads < MainThreadLoads.size())
+        {
+            const MainThreadLoad& load = MainThreadLoads[CompletedLoads++];
+            const auto loadStart = std::chrono::steady_clock::now();
+            load.Load();
+            Timings[static_cast<size_t>(load.Type)].LoadMilliseconds += GetMillisecondsSince(loadStart);
+            CompletedSteps.fetch_add(1);
+            if (isOverBudget())
+            {
+                return;
+            }
+        }
+
+        IsReadyFlag = true;
+        LogTimings();
+    }
+
+    void SceneStream::Finish()
+    {
+        ZoneScoped;
+        while (!IsReadyFlag)
+        {
+            JobSystem::GetInstance()->Wait(Jobs);
+            Update(std::numeric_limits<float>::infinity());
+        }
+    }
+
+    bool SceneStream::Activate(Scene* const Scene)
+    {
+        if (!IsReadyFlag)
+        {
+            return false;
+        }
+        ZoneScoped;
+        if (Cooked.IsOpen() && Cooked.IsScene())
+        {
+            Scene->DeserializeCooked(Cooked);
+        }
+        else
+        {
+            Scene->Deserialize(Document);
+        }
+        Scene->SetPath(Path);
+        return true;
+    }
+
+    void SceneStream::LogTimings() const
+    {
+        spdlog::info("Streamed scene {0} with {1} assets.", Path, Manifest.GetSize());
+        for (size_t i = 0; i < Timings.size(); ++i)
+        {
+            const AssetTiming& timing = Timings[i];
+            if (timing.Count == 0)
+            {
+                continue;
+            }
+            const float decodeMilliseconds = static_cast<float>(timing.DecodeNanoseconds.load()) / 1'000'000.0f;
+            spdlog::info("  {0} {1}: decoding {2:.2f} ms on workers, loading {3:.2f} ms on the main thread.",
+                         timing.Count, Serialization::AssetTypeNames[i], decodeMilliseconds, timing.LoadMilliseconds);
+        }
+    }
+
+    float SceneStream::GetProgress() const
+    {
+        if (IsReadyFlag)
+        {
+            return 1.0f;
+        }
+        if (!IsDecodingStarted)
+        {
+            return 0.0f;
+        }
+        return std::min(static_cast<float>(CompletedSteps.load()) / static_cast<float>(TotalSteps), 1.0f);
+    }
+} // Engine
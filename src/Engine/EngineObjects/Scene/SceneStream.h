@@ -0,0 +1,144 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Engine/EngineObjects/JobSystem.h"
+#include "Models/Mesh.h"
+#include "rapidjson/document.h"
+#include "Serialization/AssetManifest.h"
+#include "Serialization/CookedFilesUtility.h"
+#include "Utility/DDSLoader.h"
+
+namespace Engine
+{
+    class Scene;
+
+    /**
+     * @brief Scene file loaded in the background together with every asset in its manifest.
+     * The file is read and textures and models are decoded on the JobSystem, uploads to the GPU and assets
+     * that can only be created on the main thread are loaded by Update within a time budget.
+     */
+    class SceneStream final
+    {
+    private:
+        struct DecodedTexture
+        {
+            std::string Path;
+            Utility::DdsImage Image;
+        };
+
+        struct DecodedModel
+        {
+            std::string Path;
+            std::vector<Models::MeshData> Meshes;
+        };
+
+        struct MainThreadLoad
+        {
+            Serialization::AssetType Type;
+            std::function<void()> Load;
+        };
+
+        struct AssetTiming
+        {
+            size_t Count = 0;
+            /*summed over worker threads*/
+            std::atomic<int64_t> DecodeNanoseconds = 0;
+            float LoadMilliseconds = 0.0f;
+        };
+
+    private:
+        std::string Path;
+        /*the scene is activated from the cooked file when it's open, json is read only if it's needed*/
+        Serialization::CookedFile Cooked;
+        rapidjson::Document Document;
+        /*counts jobs reading the file and decoding assets, the stream can't be destroyed before they finish*/
+        JobCounter Jobs;
+        std::atomic<bool> IsRead = false;
+        bool IsDecodingStarted = false;
+        bool IsReadyFlag = false;
+
+        /*written by the reading job*/
+        Serialization::AssetManifest Manifest;
+        std::vector<std::string> StreamedTextures;
+
+        std::mutex DecodedMutex;
+        std::vector<DecodedTexture> DecodedTextures;
+        std::vector<DecodedModel> DecodedModels;
+        size_t PendingUploads = 0;
+        /*assets loaded after all uploads, in order*/
+        std::vector<MainThreadLoad> MainThreadLoads;
+        size_t CompletedLoads = 0;
+        std::array<AssetTiming, static_cast<size_t>(Serialization::AssetType::Count)> Timings;
+
+        /*reading the file, decoding and uploading every asset are steps of the progress*/
+        size_t TotalSteps = 1;
+        std::atomic<size_t> CompletedSteps = 0;
+
+    public:
+        /**
+         * @brief Starts reading a scene file in the background.
+         * @param Path Path of a scene file.
+         */
+        explicit SceneStream(std::string Path);
+
+        ~SceneStream();
+
+        SceneStream(const SceneStream&) = delete;
+
+        SceneStream& operator=(const SceneStream&) = delete;
+
+    public:
+        /**
+         * @brief Starts decoding of assets once the file is read and uploads decoded assets. Main thread only.
+         * @param BudgetMilliseconds Time after which no further upload is started, at least one is always done.
+         */
+        void Update(float BudgetMilliseconds);
+
+        /**
+         * @brief Blocks until the scene is ready, helping with decoding in the meantime. Main thread only.
+         */
+        void Finish();
+
+        /**
+         * @brief Deserializes the streamed scene. Main thread only.
+         * @param Scene Scene to load data to.
+         * @return False if the stream isn't ready yet.
+         */
+        bool Activate(Scene* Scene);
+
+        /**
+         * @brief Checks whether the file is read and all its assets are uploaded.
+         */
+        [[nodiscard]] bool IsReady() const
+        {
+            return IsReadyFlag;
+        }
+
+        /**
+         * @brief Returns part of the work done, from 0 to 1. Can be shown on a loading screen.
+         */
+        [[nodiscard]] float GetProgress() const;
+
+        [[nodiscard]] const std::string& GetPath() const
+        {
+            return Path;
+        }
+
+    private:
+        void Read();
+
+        void StartDecoding();
+
+        void DecodeTexture(const std::string& TexturePath);
+
+        void DecodeModel(const std::string& ModelPath);
+
+        void LogTimings() const;
+    };
+} // Engine
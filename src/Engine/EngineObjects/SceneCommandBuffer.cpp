@@ -0,0 +1,179 @@
+#include "SceneCommandBuffer.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "Entity.h"
+#include "Engine/Components/Colliders/Collider.h"
+#include "Engine/Components/Colliders/SpatialPartitioning.h"
+#include "Scene/Scene.h"
+#include "tracy/Tracy.hpp"
+
+namespace Engine
+{
+    SceneCommandBuffer* SceneCommandBuffer::Instance = nullptr;
+
+    void SceneCommandBuffer::Initialize()
+    {
+        Instance = new SceneCommandBuffer();
+    }
+
+    void SceneCommandBuffer::Spawn(class Scene* const Scene, Entity* const Parent,
+                                   std::function<void(Entity*)> Initializer)
+    {
+        Record(Command{CommandType::Spawn, Scene, nullptr, Parent, nullptr, nullptr, std::move(Initializer)});
+    }
+
+    void SceneCommandBuffer::Destroy(Entity* const Entity)
+    {
+        std::lock_guard lock(Mutex);
+        ToDestroy.push_back(Entity);
+    }
+
+    void SceneCommandBuffer::RemoveComponent(Component* const Component)
+    {
+        std::lock_guard lock(Mutex);
+        if (ToRemove.insert(Component).second)
+        {
+            Commands.push_back(
+                Command{CommandType::RemoveComponent, nullptr, Component->GetOwner(), nullptr, Component, nullptr, {}});
+        }
+    }
+
+    void SceneCommandBuffer::SetParent(Entity* const Entity, Engine::Entity* const Parent)
+    {
+        Record(Command{CommandType::SetParent, nullptr, Entity, Parent, nullptr, nullptr, {}});
+    }
+
+    void SceneCommandBuffer::Defer(Entity* const Entity, std::function<void(Engine::Entity*)> Function)
+    {
+        Record(Command{CommandType::Custom, nullptr, Entity, nullptr, nullptr, nullptr, std::move(Function)});
+    }
+
+    void SceneCommandBuffer::Record(Command&& Command)
+    {
+        std::lock_guard lock(Mutex);
+        Commands.push_back(std::move(Command));
+    }
+
+    void SceneCommandBuffer::Apply()
+    {
+        ZoneScoped;
+        std::vector<Command> commands;
+        std::vector<Entity*> toDestroy;
+        {
+            std::lock_guard lock(Mutex);
+            commands.swap(Commands);
+            toDestroy.swap(ToDestroy);
+        }
+
+        for (Command& command : commands)
+        {
+            switch (command.Type)
+            {
+                case CommandType::Spawn:
+                {
+                    Entity* entity = command.Scene->SpawnEntity(command.Parent);
+                    if (command.Callback)
+                    {
+                        command.Callback(entity);
+                    }
+                    break;
+                }
+                case CommandType::AddComponent:
+                {
+                    Component* component = command.CreateComponent();
+                    component->SetOwner(command.Target);
+                    command.Target->AttachComponent(component);
+                    component->Start();
+                    if (command.Callback)
+                    {
+                        command.Callback(command.Target);
+                    }
+                    break;
+                }
+                case CommandType::RemoveComponent:
+                {
+                    {
+                        /*the address may be reused by a component added afterwards, which can be removed again*/
+                        std::lock_guard lock(Mutex);
+                        ToRemove.erase(command.Component);
+                    }
+                    if (std::ranges::find(*command.Target, command.Component) != command.Target->end())
+                    {
+                        command.Target->DetachComponent(command.Component);
+                        command.Component->OnDestroy();
+                        delete command.Component;
+                    }
+                    break;
+                }
+                case CommandType::SetParent:
+                    command.Target->GetTransform()->SetParent(command.Parent->GetTransform());
+                    break;
+                case CommandType::Custom:
+                    command.Callback(command.Target);
+                    break;
+            }
+        }
+
+        if (!toDestroy.empty())
+        {
+            DestroyAll(toDestroy);
+        }
+    }
+
+    void SceneCommandBuffer::DestroyAll(std::vector<Entity*>& Entities)
+    {
+        ZoneScoped;
+        const std::unordered_set<const Entity*> doomed(Entities.begin(), Entities.end());
+        const auto hasDoomedAncestor = [&doomed](const Entity* Entity)
+        {
+            for (const Transform* parent = Entity->GetTransform()->GetParent(); parent != nullptr;
+                 parent = parent->GetParent())
+            {
+                if (doomed.contains(parent->GetOwner()))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        /*entities are deleted in order of recording, so OnDestroy calls and scene indices don't depend on addresses*/
+        std::unordered_set<const Entity*> recorded;
+        recorded.reserve(doomed.size());
+        std::erase_if(Entities, [&recorded](const Entity* Entity) { return !recorded.insert(Entity).second; });
+        /*deleting an entity deletes its descendants, so only topmost ones are deleted explicitly*/
+        std::erase_if(Entities, hasDoomedAncestor);
+
+        /*whole broadphase is updated once instead of once per collider*/
+        std::vector<Collider*> colliders;
+        std::vector<const Transform*> stack;
+        for (const Entity* entity : Entities)
+        {
+            stack.push_back(entity->GetTransform());
+            while (!stack.empty())
+            {
+                const Transform* transform = stack.back();
+                stack.pop_back();
+                for (Component* component : *transform->GetOwner())
+                {
+                    if (Collider* collider = dynamic_cast<Collider*>(component))
+                    {
+                        colliders.push_back(collider);
+                    }
+                }
+                for (const Transform* child : *transform)
+                {
+                    stack.push_back(child);
+                }
+            }
+        }
+        SpatialPartitioning::GetInstance().RemoveColliders(colliders);
+
+        for (const Entity* entity : Entities)
+        {
+            delete entity;
+        }
+    }
+} // Engine
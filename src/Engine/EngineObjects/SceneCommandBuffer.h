@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    class Component;
+    class Entity;
+    class Scene;
+
+    /**
+     * @brief Singleton collecting structural scene changes to be applied at a single point of the frame.
+     * Commands may be recorded from any thread and are applied in order of recording by Apply,
+     * except destruction, which is applied last for all entities at once, still in order of recording.
+     * Every entity is destroyed at most once, descendants of destroyed entities are skipped.
+     */
+    class SceneCommandBuffer final
+    {
+    private:
+        enum class CommandType : uint8_t
+        {
+            Spawn,
+            AddComponent,
+            RemoveComponent,
+            SetParent,
+            Custom
+        };
+
+        struct Command
+        {
+            CommandType Type;
+            Scene* Scene;
+            Entity* Target;
+            Entity* Parent;
+            Component* Component;
+            Engine::Component* (*CreateComponent)();
+            std::function<void(Entity*)> Callback;
+        };
+
+    private:
+        static SceneCommandBuffer* Instance;
+
+        std::mutex Mutex;
+        std::vector<Command> Commands;
+        std::vector<Entity*> ToDestroy;
+        /*components with a recorded removal, a component is deleted once even if its removal is recorded again*/
+        std::unordered_set<const Component*> ToRemove;
+
+    private:
+        SceneCommandBuffer() = default;
+
+    public:
+        /**
+         * @brief Initializes a new SceneCommandBuffer.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Returns instance of the SceneCommandBuffer.
+         */
+        static SceneCommandBuffer* GetInstance()
+        {
+            return Instance;
+        }
+
+        /**
+         * @brief Records spawning of a new entity.
+         * @param Scene Scene the entity is spawned in.
+         * @param Parent Parent of the entity. If nullptr scene root becomes parent.
+         * @param Initializer Called with the spawned entity when the command is applied, may be empty.
+         */
+        void Spawn(Scene* Scene, Entity* Parent, std::function<void(Entity*)> Initializer = {});
+
+        /**
+         * @brief Records destruction of an entity and all its descendants.
+         * @param Entity Entity to be destroyed.
+         */
+        void Destroy(Entity* Entity);
+
+        /**
+         * @brief Records adding a new component to an entity.
+         * @tparam T Component's class.
+         * @param Entity Entity the component is added to.
+         * @param Initializer Called with the entity after the component has started, may be empty.
+         */
+        template<class T>
+        void AddComponent(Entity* const Entity, std::function<void(Engine::Entity*)> Initializer = {})
+        {
+            static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
+            Record(Command{CommandType::AddComponent, nullptr, Entity, nullptr, nullptr,
+                           []() -> Component* { return new T(); }, std::move(Initializer)});
+        }
+
+        /**
+         * @brief Records removal of a component from its owner. The component stays attached until Apply.
+         * Recording removal of a component that is already going to be removed has no effect, so a component
+         * created at its address later in the same Apply is never removed by mistake.
+         * @param Component Component to be removed.
+         */
+        void RemoveComponent(Component* Component);
+
+        /**
+         * @brief Records reparenting of an entity.
+         * @param Entity Entity to be moved.
+         * @param Parent A new parent.
+         */
+        void SetParent(Entity* Entity, Engine::Entity* Parent);
+
+        /**
+         * @brief Records any other change of an entity.
+         * @param Entity Entity passed to the function.
+         * @param Function Called with the entity when the command is applied.
+         */
+        void Defer(Entity* Entity, std::function<void(Engine::Entity*)> Function);
+
+        /**
+         * @brief Applies all recorded commands. Has to be called from the main thread outside of any update loop.
+         * Commands recorded while applying are applied during the next call.
+         */
+        void Apply();
+
+    private:
+        void Record(Command&& Command);
+
+        void DestroyAll(std::vector<Entity*>& Entities);
+    };
+} // Engine
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <random>
+
+namespace Engine
+{
+    /**
+     * @brief Time and random numbers of gameplay.
+     * Both depend only on the seed and on the steps of updates, so a headless run with a fixed time step and replayed
+     * input reaches the same state every time. Only used on the main thread.
+     */
+    class Simulation final
+    {
+    private:
+        static inline double Time = 0.0;
+        static inline std::mt19937 RandomEngine;
+
+    private:
+        Simulation() = default;
+
+    public:
+        /**
+         * @brief Starts time at zero and seeds random numbers.
+         * @param Seed Seed of the random engine, runs with the same seed draw the same numbers.
+         */
+        static void Reset(const uint32_t Seed)
+        {
+            Time = 0.0;
+            RandomEngine.seed(Seed);
+        }
+
+        /**
+         * @brief Advances time by one update step, called by UpdateManager before the step is ticked.
+         */
+        static void Advance(const float DeltaTime)
+        {
+            Time += DeltaTime;
+        }
+
+        /**
+         * @brief Returns seconds simulated since Reset, the sum of all update steps.
+         */
+        [[nodiscard]] static double GetTime()
+        {
+            return Time;
+        }
+
+        /**
+         * @brief Returns the random engine, e.g. to shuffle with. Every draw advances the sequence of the simulation.
+         */
+        [[nodiscard]] static std::mt19937& GetRandomEngine()
+        {
+            return RandomEngine;
+        }
+
+        /**
+         * @brief Returns a uniformly distributed number in [Min, Max).
+         */
+        [[nodiscard]] static float GetRandomFloat(const float Min, const float Max)
+        {
+            return std::uniform_real_distribution<float>(Min, Max)(RandomEngine);
+        }
+    };
+} // Engine
@@ -0,0 +1,259 @@
+#include "Telemetry.h"
+
+#if TELEMETRY
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "rapidjson/document.h"
+#include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "UpdateManager.h"
+#if EDITOR
+#include "imgui.h"
+#endif
+
+namespace Engine
+{
+    static_assert(static_cast<size_t>(TelemetryTimer::LateUpdate) + 1 == UpdatePhaseCount,
+                  "Update phases have to be the first telemetry timers.");
+
+    std::array<Telemetry::AtomicCounter, TelemetryCounterCount> Telemetry::Counters{};
+    std::array<float, TelemetryTimerCount> Telemetry::Timers{};
+    std::array<FrameTelemetry, Telemetry::HistorySize> Telemetry::History{};
+    uint64_t Telemetry::RecordedFrames = 0;
+    std::string Telemetry::OutputPath;
+    float Telemetry::CountMilliseconds = -1.0f;
+
+    namespace
+    {
+        /**
+         * @brief Times Count calls on a counter nobody else uses.
+         * @return Milliseconds per call.
+         */
+        float CalibrateCount()
+        {
+            constexpr uint64_t calls = 100000;
+            std::atomic<uint64_t> counter = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < calls; ++i)
+            {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }
+            const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - start;
+            return counter.load(std::memory_order_relaxed) == calls ? duration.count() / calls : 0.0f;
+        }
+    }
+
+    void Telemetry::EndFrame(const uint64_t Frame)
+    {
+        if (CountMilliseconds < 0.0f)
+        {
+            CountMilliseconds = CalibrateCount();
+        }
+        const auto start = std::chrono::steady_clock::now();
+
+        FrameTelemetry& frame = History[RecordedFrames % HistorySize];
+        frame.Frame = Frame;
+        frame.Milliseconds = Timers;
+        Timers.fill(0.0f);
+        /*counters other than uploaded bytes are incremented by one, so their values are numbers of calls*/
+        uint64_t calls = 0;
+        for (size_t i = 0; i < TelemetryCounterCount; ++i)
+        {
+            frame.Counters[i] = Counters[i].Value.exchange(0, std::memory_order_relaxed);
+            calls += static_cast<TelemetryCounter>(i) != TelemetryCounter::BytesUploaded ? frame.Counters[i] : 0;
+        }
+        ++RecordedFrames;
+
+        const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - start;
+        frame.Milliseconds[static_cast<size_t>(TelemetryTimer::Telemetry)] +=
+                duration.count() + static_cast<float>(calls) * CountMilliseconds;
+    }
+
+    float Telemetry::GetOverheadPercentage()
+    {
+        double overhead = 0.0;
+        double frameTime = 0.0;
+        for (size_t age = 0; age < GetFrameCount(); ++age)
+        {
+            overhead += GetFrame(age).Milliseconds[static_cast<size_t>(TelemetryTimer::Telemetry)];
+            frameTime += GetFrame(age).Milliseconds[static_cast<size_t>(TelemetryTimer::Frame)];
+        }
+        return frameTime > 0.0 ? static_cast<float>(overhead * 100.0 / frameTime) : 0.0f;
+    }
+
+    size_t Telemetry::GetFrameCount()
+    {
+        return static_cast<size_t>(std::min<uint64_t>(RecordedFrames, HistorySize));
+    }
+
+    const FrameTelemetry& Telemetry::GetFrame(const size_t Age)
+    {
+        return History[(RecordedFrames - 1 - Age) % HistorySize];
+    }
+
+    const char* Telemetry::GetTimerName(const TelemetryTimer Timer)
+    {
+        switch (Timer)
+        {
+            case TelemetryTimer::Render:
+                return "Render";
+            case TelemetryTimer::StructuralChanges:
+                return "StructuralChanges";
+            case TelemetryTimer::Telemetry:
+                return "Telemetry";
+            case TelemetryTimer::Frame:
+                return "Frame";
+            default:
+                return UpdateManager::GetPhaseName(static_cast<UpdatePhase>(Timer));
+        }
+    }
+
+    const char* Telemetry::GetCounterName(const TelemetryCounter Counter)
+    {
+        switch (Counter)
+        {
+            case TelemetryCounter::DrawCalls:
+                return "DrawCalls";
+            case TelemetryCounter::UniformsSet:
+                return "UniformsSet";
+            case TelemetryCounter::ColliderPairsTested:
+                return "ColliderPairsTested";
+            case TelemetryCounter::PathsSolved:
+                return "PathsSolved";
+            case TelemetryCounter::PooledAllocations:
+                return "PooledAllocations";
+            case TelemetryCounter::BytesUploaded:
+                return "BytesUploaded";
+            default:
+                return "Unknown";
+        }
+    }
+
+    void Telemetry::WriteOutput()
+    {
+        if (OutputPath.empty())
+        {
+            return;
+        }
+        if (Write(OutputPath))
+        {
+            spdlog::info("Telemetry of {0} frames written to {1}.", GetFrameCount(), OutputPath);
+        }
+    }
+
+    bool Telemetry::Write(const std::string& Path)
+    {
+        const size_t frameCount = GetFrameCount();
+        if (Path.ends_with(".json"))
+        {
+            rapidjson::Document document;
+            document.SetObject();
+            rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+
+            rapidjson::Value frames(rapidjson::kArrayType);
+            for (size_t age = frameCount; age-- > 0;)
+            {
+                const FrameTelemetry& frame = GetFrame(age);
+                rapidjson::Value object(rapidjson::kObjectType);
+                object.AddMember("frame", frame.Frame, allocator);
+                for (size_t i = 0; i < TelemetryTimerCount; ++i)
+                {
+                    object.AddMember(rapidjson::StringRef(GetTimerName(static_cast<TelemetryTimer>(i))),
+                                     frame.Milliseconds[i], allocator);
+                }
+                for (size_t i = 0; i < TelemetryCounterCount; ++i)
+                {
+                    object.AddMember(rapidjson::StringRef(GetCounterName(static_cast<TelemetryCounter>(i))),
+                                     frame.Counters[i], allocator);
+                }
+                frames.PushBack(object, allocator);
+            }
+            document.AddMember("frames", frames, allocator);
+            Serialization::WriteJsonFile(Path.c_str(), document);
+            return true;
+        }
+
+        std::ofstream file(Path);
+        if (!file)
+        {
+            spdlog::error("Failed to open telemetry output {0}.", Path);
+            return false;
+        }
+
+        file << "Frame";
+        for (size_t i = 0; i < TelemetryTimerCount; ++i)
+        {
+            file << ',' << GetTimerName(static_cast<TelemetryTimer>(i)) << "Ms";
+        }
+        for (size_t i = 0; i < TelemetryCounterCount; ++i)
+        {
+            file << ',' << GetCounterName(static_cast<TelemetryCounter>(i));
+        }
+        file << '\n';
+
+        for (size_t age = frameCount; age-- > 0;)
+        {
+            const FrameTelemetry& frame = GetFrame(age);
+            file << frame.Frame;
+            for (const float milliseconds : frame.Milliseconds)
+            {
+                file << ',' << milliseconds;
+            }
+            for (const uint64_t counter : frame.Counters)
+            {
+                file << ',' << counter;
+            }
+            file << '\n';
+        }
+        return true;
+    }
+
+#if EDITOR
+    void Telemetry::DrawImGui()
+    {
+        ImGui::Begin("Telemetry");
+        const size_t frameCount = GetFrameCount();
+        if (frameCount == 0)
+        {
+            ImGui::End();
+            return;
+        }
+
+        std::array<float, HistorySize> frameTimes{};
+        float maxFrameTime = 0.0f;
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            frameTimes[i] = GetFrame(frameCount - 1 - i).Milliseconds[static_cast<size_t>(TelemetryTimer::Frame)];
+            maxFrameTime = std::max(maxFrameTime, frameTimes[i]);
+        }
+        ImGui::PlotLines("Frame ms", frameTimes.data(), static_cast<int>(frameCount), 0, nullptr, 0.0f,
+                         maxFrameTime, ImVec2(0.0f, 60.0f));
+
+        const FrameTelemetry& last = GetFrame(0);
+        if (ImGui::BeginTable("TelemetryTimers", 2))
+        {
+            for (size_t i = 0; i < TelemetryTimerCount; ++i)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(GetTimerName(static_cast<TelemetryTimer>(i)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f ms", last.Milliseconds[i]);
+            }
+            for (size_t i = 0; i < TelemetryCounterCount; ++i)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(GetCounterName(static_cast<TelemetryCounter>(i)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(last.Counters[i]));
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+#endif
+} // Engine
+#endif
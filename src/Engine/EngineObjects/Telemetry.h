@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Engine
+{
+    /**
+     * @brief Timed parts of a frame. Update phases come first, in the order of UpdatePhase.
+     */
+    enum class TelemetryTimer : uint8_t
+    {
+        Input,
+        Gameplay,
+        Ai,
+        Physics,
+        Animation,
+        LateUpdate,
+        Render,
+        StructuralChanges,
+        /*cost of telemetry itself: EndFrame and counter increments, estimated from their calibrated cost*/
+        Telemetry,
+        Frame,
+        Count
+    };
+
+    /**
+     * @brief Events counted every frame.
+     */
+    enum class TelemetryCounter : uint8_t
+    {
+        DrawCalls,
+        UniformsSet,
+        ColliderPairsTested,
+        PathsSolved,
+        /*objects taken from object pools, allocations from global new aren't counted*/
+        PooledAllocations,
+        BytesUploaded,
+        Count
+    };
+
+    constexpr size_t TelemetryTimerCount = static_cast<size_t>(TelemetryTimer::Count);
+    constexpr size_t TelemetryCounterCount = static_cast<size_t>(TelemetryCounter::Count);
+
+    /**
+     * @brief Timings and counters of a single frame.
+     */
+    struct FrameTelemetry
+    {
+        uint64_t Frame = 0;
+        std::array<float, TelemetryTimerCount> Milliseconds{};
+        std::array<uint64_t, TelemetryCounterCount> Counters{};
+    };
+
+#if TELEMETRY
+    /**
+     * @brief Keeps timings and counters of the last HistorySize frames.
+     * Counters may be incremented from any thread, timers and frames are recorded by the main thread only.
+     * Compiled out when TELEMETRY is 0, use the TELEMETRY_* macros at call sites.
+     */
+    class Telemetry final
+    {
+    public:
+        static constexpr size_t HistorySize = 256;
+
+    private:
+        /*every counter has its own cache line so threads counting different events don't contend*/
+        struct alignas(64) AtomicCounter
+        {
+            std::atomic<uint64_t> Value = 0;
+        };
+
+    private:
+        static std::array<AtomicCounter, TelemetryCounterCount> Counters;
+        static std::array<float, TelemetryTimerCount> Timers;
+
+        static std::array<FrameTelemetry, HistorySize> History;
+        /*number of frames recorded since start*/
+        static uint64_t RecordedFrames;
+        static std::string OutputPath;
+        /*cost of a single uncontended Count call, measured by the first EndFrame*/
+        static float CountMilliseconds;
+
+    public:
+        Telemetry() = delete;
+
+    public:
+        /**
+         * @brief Adds to a counter of the current frame. Thread safe.
+         * @param Counter Counter to increment.
+         * @param Amount Value added to the counter.
+         */
+        static void Count(const TelemetryCounter Counter, const uint64_t Amount = 1)
+        {
+            Counters[static_cast<size_t>(Counter)].Value.fetch_add(Amount, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Adds time to a timer of the current frame. Main thread only.
+         * @param Timer Timer the time is added to.
+         * @param Milliseconds Measured time.
+         */
+        static void AddTime(const TelemetryTimer Timer, const float Milliseconds)
+        {
+            Timers[static_cast<size_t>(Timer)] += Milliseconds;
+        }
+
+        /**
+         * @brief Moves values of the current frame into the history and resets them.
+         * Records the time it took and the estimated cost of the frame's Count calls as the Telemetry timer.
+         * @param Frame Number of the finished frame.
+         */
+        static void EndFrame(uint64_t Frame);
+
+        /**
+         * @brief Returns time of the Telemetry timer relative to the Frame timer over the recorded history.
+         * @return Overhead in percent of frame time, 0 if no frame was recorded.
+         */
+        [[nodiscard]] static float GetOverheadPercentage();
+
+        /**
+         * @brief Returns number of frames available in the history.
+         */
+        [[nodiscard]] static size_t GetFrameCount();
+
+        /**
+         * @brief Returns a recorded frame.
+         * @param Age 0 for the last finished frame, 1 for the one before it and so on. Has to be less than GetFrameCount.
+         */
+        [[nodiscard]] static const FrameTelemetry& GetFrame(size_t Age);
+
+        [[nodiscard]] static const char* GetTimerName(TelemetryTimer Timer);
+
+        [[nodiscard]] static const char* GetCounterName(TelemetryCounter Counter);
+
+        /**
+         * @brief Sets file the history is written to by WriteOutput. Empty path disables writing.
+         */
+        static void SetOutputPath(const std::string& Path)
+        {
+            OutputPath = Path;
+        }
+
+        /**
+         * @brief Writes the history to the output path, if one was set.
+         */
+        static void WriteOutput();
+
+        /**
+         * @brief Writes the history from the oldest frame to the newest.
+         * Format is JSON if the path ends with .json, CSV otherwise.
+         * @return True if the file was written.
+         */
+        static bool Write(const std::string& Path);
+
+#if EDITOR
+        /**
+         * @brief Draws an ImGui window with frame times and counters of the last frame.
+         */
+        static void DrawImGui();
+#endif
+    };
+
+    /**
+     * @brief Adds time from construction to destruction to a telemetry timer.
+     */
+    class ScopedTelemetryTimer final
+    {
+    private:
+        TelemetryTimer Timer;
+        std::chrono::steady_clock::time_point Start;
+
+    public:
+        explicit ScopedTelemetryTimer(const TelemetryTimer Timer) :
+            Timer(Timer), Start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ScopedTelemetryTimer(const ScopedTelemetryTimer&) = delete;
+
+        ScopedTelemetryTimer& operator=(const ScopedTelemetryTimer&) = delete;
+
+        ~ScopedTelemetryTimer()
+        {
+            const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - Start;
+            Telemetry::AddTime(Timer, duration.count());
+        }
+    };
+#endif
+} // Engine
+
+#if TELEMETRY
+#define TELEMETRY_CONCAT_IMPL(A, B) A##B
+#define TELEMETRY_CONCAT(A, B) TELEMETRY_CONCAT_IMPL(A, B)
+#define TELEMETRY_COUNT(Counter, Amount) ::Engine::Telemetry::Count(::Engine::TelemetryCounter::Counter, (Amount))
+#define TELEMETRY_SCOPED_TIMER(Timer) \
+    const ::Engine::ScopedTelemetryTimer TELEMETRY_CONCAT(telemetryTimer, __LINE__)(::Engine::TelemetryTimer::Timer)
+#else
+#define TELEMETRY_COUNT(Counter, Amount) ((void) 0)
+#define TELEMETRY_SCOPED_TIMER(Timer) ((void) 0)
+#endif
@@ -0,0 +1,269 @@
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+
+#include "JobSystem.h"
+#include "tracy/Tracy.hpp"
+
+namespace Engine
+{
+    TransformHierarchy::Handle TransformHierarchy::Create(const Handle Parent)
+    {
+        const int32_t parentIndex = Parent != InvalidHandle ? static_cast<int32_t>(HandleToDense[Parent]) : -1;
+        const uint32_t depth = parentIndex >= 0 ? Depths[parentIndex] + 1 : 0;
+        const uint32_t index = GetSize();
+
+        if (LevelOffsets.empty())
+        {
+            LevelOffsets.push_back(0);
+        }
+        if (!Depths.empty() && depth < Depths.back())
+        {
+            NeedsRebuild = true;
+        }
+        else if (depth == GetLevelCount())
+        {
+            LevelOffsets.push_back(index + 1);
+        }
+        else
+        {
+            LevelOffsets.back() = index + 1;
+        }
+
+        Handle handle;
+        if (FreeHandles.empty())
+        {
+            handle = static_cast<Handle>(HandleToDense.size());
+            HandleToDense.push_back(index);
+        }
+        else
+        {
+            handle = FreeHandles.back();
+            FreeHandles.pop_back();
+            HandleToDense[handle] = index;
+        }
+
+        Positions.emplace_back(0.0f);
+        Rotations.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+        Scales.emplace_back(1.0f);
+        LocalToWorldMatrices.emplace_back(1.0f);
+        WorldToLocalMatrices.emplace_back(1.0f);
+        Parents.push_back(parentIndex);
+        Depths.push_back(depth);
+        Dirty.push_back(1);
+        Changed.push_back(0);
+        Removed.push_back(0);
+        DenseToHandle.push_back(handle);
+        HasPendingChanges = true;
+        return handle;
+    }
+
+    void TransformHierarchy::Destroy(const Handle Node)
+    {
+        assert(IsValid(Node));
+        Removed[HandleToDense[Node]] = 1;
+        HandleToDense[Node] = InvalidHandle;
+        NeedsRebuild = true;
+    }
+
+    void TransformHierarchy::SetParent(const Handle Node, const Handle Parent)
+    {
+        const uint32_t index = HandleToDense[Node];
+        const int32_t parentIndex = Parent != InvalidHandle ? static_cast<int32_t>(HandleToDense[Parent]) : -1;
+#if DEBUG
+        for (int32_t ancestor = parentIndex; ancestor >= 0; ancestor = Parents[ancestor])
+        {
+            assert(ancestor != static_cast<int32_t>(index) && "Node can't be parented to its own descendant.");
+        }
+#endif
+        Parents[index] = parentIndex;
+        MarkDirty(index);
+        NeedsRebuild = true;
+    }
+
+    void TransformHierarchy::UpdateWorldMatrices()
+    {
+        ZoneScoped;
+        if (!HasPendingChanges && !NeedsRebuild)
+        {
+            std::ranges::fill(Changed, 0);
+            return;
+        }
+        PrepareUpdate();
+        HasPendingChanges = false;
+
+        JobSystem* jobSystem = JobSystem::GetInstance();
+        if (jobSystem == nullptr || GetSize() < ParallelBatchSize)
+        {
+            UpdateRange(0, GetSize());
+            return;
+        }
+
+        for (uint32_t level = 0; level < GetLevelCount(); ++level)
+        {
+            uint32_t first, last;
+            GetLevelRange(level, first, last);
+            const auto updateBatch = [this, first](const uint32_t Begin, const uint32_t End)
+            {
+                UpdateRange(first + Begin, first + End);
+            };
+            jobSystem->ParallelFor(last - first, ParallelBatchSize, updateBatch, "TransformHierarchy");
+        }
+    }
+
+    void TransformHierarchy::PrepareUpdate()
+    {
+        if (NeedsRebuild)
+        {
+            Rebuild();
+        }
+    }
+
+    void TransformHierarchy::UpdateRange(const uint32_t First, const uint32_t Last)
+    {
+        for (uint32_t i = First; i < Last; ++i)
+        {
+            const int32_t parent = Parents[i];
+            const bool changed = Dirty[i] || (parent >= 0 && Changed[parent]);
+            Changed[i] = changed;
+            Dirty[i] = 0;
+            if (!changed)
+            {
+                continue;
+            }
+
+            const glm::mat4 local = CalculateLocalMatrix(Positions[i], Rotations[i], Scales[i]);
+            const glm::mat4 localInverse = CalculateInverseLocalMatrix(Positions[i], Rotations[i], Scales[i]);
+            LocalToWorldMatrices[i] = parent >= 0 ? LocalToWorldMatrices[parent] * local : local;
+            WorldToLocalMatrices[i] = parent >= 0 ? localInverse * WorldToLocalMatrices[parent] : localInverse;
+        }
+    }
+
+    glm::mat4 TransformHierarchy::CalculateLocalMatrix(const glm::vec3& Position, const glm::quat& Rotation,
+                                                       const glm::vec3& Scale)
+    {
+        glm::mat4 local = glm::mat4(glm::mat3_cast(Rotation));
+        local[0] *= Scale.x;
+        local[1] *= Scale.y;
+        local[2] *= Scale.z;
+        local[3] = glm::vec4(Position, 1.0f);
+        return local;
+    }
+
+    glm::mat4 TransformHierarchy::CalculateInverseLocalMatrix(const glm::vec3& Position, const glm::quat& Rotation,
+                                                              const glm::vec3& Scale)
+    {
+        // Inverse of T * R * S is S^-1 * R^T * T^-1, no general 4x4 inverse needed.
+        const glm::vec3 inverseScale(Scale.x != 0.0f ? 1.0f / Scale.x : 0.0f,
+                                     Scale.y != 0.0f ? 1.0f / Scale.y : 0.0f,
+                                     Scale.z != 0.0f ? 1.0f / Scale.z : 0.0f);
+        glm::mat3 inverseRotationScale = glm::transpose(glm::mat3_cast(Rotation));
+        for (int column = 0; column < 3; ++column)
+        {
+            inverseRotationScale[column] *= inverseScale;
+        }
+        glm::mat4 localInverse = glm::mat4(inverseRotationScale);
+        localInverse[3] = glm::vec4(-(inverseRotationScale * Position), 1.0f);
+        return localInverse;
+    }
+
+    void TransformHierarchy::Rebuild()
+    {
+        ZoneScoped;
+        constexpr int32_t unknown = -1;
+        constexpr int32_t removed = -2;
+
+        const uint32_t count = GetSize();
+        std::vector<int32_t> depths(count, unknown);
+        std::vector<uint32_t> chain;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            chain.clear();
+            int32_t node = static_cast<int32_t>(i);
+            while (node >= 0 && depths[node] == unknown)
+            {
+                chain.push_back(node);
+                node = Parents[node];
+            }
+
+            int32_t depth = node >= 0 ? depths[node] : -1;
+            for (auto iterator = chain.rbegin(); iterator != chain.rend(); ++iterator)
+            {
+                depth = depth == removed || Removed[*iterator] ? removed : depth + 1;
+                depths[*iterator] = depth;
+            }
+        }
+
+        std::vector<uint32_t> order;
+        order.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (depths[i] == removed)
+            {
+                if (HandleToDense[DenseToHandle[i]] == i)
+                {
+                    HandleToDense[DenseToHandle[i]] = InvalidHandle;
+                }
+                FreeHandles.push_back(DenseToHandle[i]);
+            }
+            else
+            {
+                order.push_back(i);
+            }
+        }
+        std::ranges::stable_sort(order, [&depths](const uint32_t A, const uint32_t B)
+        {
+            return depths[A] < depths[B];
+        });
+
+        std::vector<int32_t> newIndices(count, -1);
+        for (uint32_t i = 0; i < order.size(); ++i)
+        {
+            newIndices[order[i]] = static_cast<int32_t>(i);
+        }
+
+        const auto gather = [&order](auto& Values)
+        {
+            std::remove_reference_t<decltype(Values)> result;
+            result.reserve(order.size());
+            for (const uint32_t index : order)
+            {
+                result.push_back(Values[index]);
+            }
+            Values = std::move(result);
+        };
+        gather(Positions);
+        gather(Rotations);
+        gather(Scales);
+        gather(LocalToWorldMatrices);
+        gather(WorldToLocalMatrices);
+        gather(Parents);
+        gather(DenseToHandle);
+
+        const uint32_t newCount = static_cast<uint32_t>(order.size());
+        Depths.resize(newCount);
+        LevelOffsets.assign(1, 0);
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            Parents[i] = Parents[i] >= 0 ? newIndices[Parents[i]] : -1;
+            Depths[i] = static_cast<uint32_t>(depths[order[i]]);
+            HandleToDense[DenseToHandle[i]] = i;
+            if (Depths[i] == GetLevelCount())
+            {
+                LevelOffsets.push_back(i + 1);
+            }
+            else
+            {
+                LevelOffsets.back() = i + 1;
+            }
+        }
+
+        /*reparented subtrees need new world matrices*/
+        Dirty.assign(newCount, 1);
+        Changed.assign(newCount, 0);
+        Removed.assign(newCount, 0);
+        NeedsRebuild = false;
+    }
+} // Engine
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+namespace Engine
+{
+    /**
+     * @brief Contiguous storage of transforms for large hierarchies.
+     * Nodes are kept ordered by depth, so every parent precedes its children and nodes of the same depth
+     * are contiguous. Setters only raise a flag on the modified node, world matrices of all dirty nodes and
+     * their descendants are recalculated by a single linear pass.
+     * Transforms of a scene are stored in its hierarchy, they read matrices from it and keep it in sync
+     * with their local state.
+     */
+    class TransformHierarchy final
+    {
+    public:
+        using Handle = uint32_t;
+        static constexpr Handle InvalidHandle = UINT32_MAX;
+        /*number of nodes updated by a single job, smaller hierarchies are updated on the calling thread*/
+        static constexpr uint32_t ParallelBatchSize = 1024;
+
+    private:
+        std::vector<glm::vec3> Positions;
+        std::vector<glm::quat> Rotations;
+        std::vector<glm::vec3> Scales;
+        std::vector<glm::mat4> LocalToWorldMatrices;
+        std::vector<glm::mat4> WorldToLocalMatrices;
+        std::vector<int32_t> Parents;
+        std::vector<uint32_t> Depths;
+        std::vector<uint8_t> Dirty;
+        std::vector<uint8_t> Changed;
+        std::vector<uint8_t> Removed;
+
+        std::vector<Handle> DenseToHandle;
+        std::vector<uint32_t> HandleToDense;
+        std::vector<Handle> FreeHandles;
+
+        /*first node of every depth, followed by the total node count*/
+        std::vector<uint32_t> LevelOffsets;
+        bool NeedsRebuild = false;
+        /*whether any node was modified since the last update*/
+        bool HasPendingChanges = false;
+
+    public:
+        TransformHierarchy() = default;
+
+    public:
+        /**
+         * @brief Adds a new node representing an identity transformation.
+         * @param Parent Parent node or InvalidHandle for a root.
+         * @return Handle of the new node.
+         */
+        Handle Create(Handle Parent = InvalidHandle);
+
+        /**
+         * @brief Removes a node with all of its descendants. Storage is compacted on the next update.
+         * @param Node Node to be removed.
+         */
+        void Destroy(Handle Node);
+
+        /**
+         * @brief Attaches a node to a new parent.
+         * @param Node Node to be moved.
+         * @param Parent New parent or InvalidHandle to make it a root.
+         */
+        void SetParent(Handle Node, Handle Parent);
+
+        [[nodiscard]] Handle GetParent(Handle Node) const
+        {
+            const int32_t parent = Parents[HandleToDense[Node]];
+            return parent >= 0 ? DenseToHandle[parent] : InvalidHandle;
+        }
+
+        [[nodiscard]] bool IsValid(Handle Node) const
+        {
+            return Node < HandleToDense.size() && HandleToDense[Node] != InvalidHandle;
+        }
+
+        [[nodiscard]] const glm::vec3& GetPositionLocalSpace(Handle Node) const
+        {
+            return Positions[HandleToDense[Node]];
+        }
+
+        void SetPositionLocalSpace(Handle Node, const glm::vec3& Position)
+        {
+            const uint32_t index = HandleToDense[Node];
+            Positions[index] = Position;
+            MarkDirty(index);
+        }
+
+        [[nodiscard]] const glm::quat& GetRotation(Handle Node) const
+        {
+            return Rotations[HandleToDense[Node]];
+        }
+
+        void SetRotation(Handle Node, const glm::quat& Rotation)
+        {
+            const uint32_t index = HandleToDense[Node];
+            Rotations[index] = Rotation;
+            MarkDirty(index);
+        }
+
+        [[nodiscard]] const glm::vec3& GetScale(Handle Node) const
+        {
+            return Scales[HandleToDense[Node]];
+        }
+
+        void SetScale(Handle Node, const glm::vec3& Scale)
+        {
+            const uint32_t index = HandleToDense[Node];
+            Scales[index] = Scale;
+            MarkDirty(index);
+        }
+
+        /**
+         * @brief Sets position, rotation and scale of a node at once.
+         */
+        void SetLocal(Handle Node, const glm::vec3& Position, const glm::quat& Rotation, const glm::vec3& Scale)
+        {
+            const uint32_t index = HandleToDense[Node];
+            Positions[index] = Position;
+            Rotations[index] = Rotation;
+            Scales[index] = Scale;
+            MarkDirty(index);
+        }
+
+        /**
+         * @brief Returns local to world space matrix calculated by the last update.
+         */
+        [[nodiscard]] const glm::mat4& GetLocalToWorldMatrix(Handle Node) const
+        {
+            return LocalToWorldMatrices[HandleToDense[Node]];
+        }
+
+        /**
+         * @brief Returns world to local space matrix calculated by the last update.
+         */
+        [[nodiscard]] const glm::mat4& GetWorldToLocalMatrix(Handle Node) const
+        {
+            return WorldToLocalMatrices[HandleToDense[Node]];
+        }
+
+        /**
+         * @brief Returns true if world matrix of a node was recalculated by the last update.
+         */
+        [[nodiscard]] bool HasChanged(Handle Node) const
+        {
+            return Changed[HandleToDense[Node]] != 0;
+        }
+
+        [[nodiscard]] uint32_t GetSize() const
+        {
+            return static_cast<uint32_t>(Parents.size());
+        }
+
+        /**
+         * @brief Recalculates world matrices of all modified nodes and their descendants.
+         * Large levels are split between threads of the JobSystem if it is running.
+         */
+        void UpdateWorldMatrices();
+
+        /**
+         * @brief Compacts and reorders storage if hierarchy has changed. Has to be called before UpdateRange.
+         */
+        void PrepareUpdate();
+
+        [[nodiscard]] uint32_t GetLevelCount() const
+        {
+            return LevelOffsets.empty() ? 0 : static_cast<uint32_t>(LevelOffsets.size()) - 1;
+        }
+
+        /**
+         * @brief Returns range of dense indices holding nodes of a given depth.
+         * Ranges of a single level may be updated concurrently, levels have to be updated in order.
+         */
+        void GetLevelRange(uint32_t Level, uint32_t& First, uint32_t& Last) const
+        {
+            First = LevelOffsets[Level];
+            Last = LevelOffsets[Level + 1];
+        }
+
+        /**
+         * @brief Recalculates world matrices of dirty nodes in [First, Last).
+         * Parents of these nodes have to be already updated.
+         */
+        void UpdateRange(uint32_t First, uint32_t Last);
+
+        /**
+         * @brief Returns local to parent's space matrix of a translation, rotation and scale.
+         */
+        [[nodiscard]] static glm::mat4 CalculateLocalMatrix(const glm::vec3& Position, const glm::quat& Rotation,
+                                                            const glm::vec3& Scale);
+
+        /**
+         * @brief Returns parent's to local space matrix of a translation, rotation and scale.
+         */
+        [[nodiscard]] static glm::mat4 CalculateInverseLocalMatrix(const glm::vec3& Position,
+                                                                   const glm::quat& Rotation, const glm::vec3& Scale);
+
+    private:
+        void MarkDirty(const uint32_t Index)
+        {
+            Dirty[Index] = 1;
+            HasPendingChanges = true;
+        }
+
+        void Rebuild();
+    };
+} // Engine
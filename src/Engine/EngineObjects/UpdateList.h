@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine
+{
+    /**
+     * @brief Position of an object in a TUpdateList. Stored by the object itself and kept up to date by the list,
+     * so the object is found without a lookup.
+     */
+    struct UpdateListSlot
+    {
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        uint32_t Index = InvalidIndex;
+
+        [[nodiscard]] bool IsValid() const
+        {
+            return Index != InvalidIndex;
+        }
+    };
+
+    /**
+     * @brief Unordered list of objects ticked every frame.
+     * Every object stores its slot, so removal is O(1): the slot is cleared at once and
+     * compacted with swap-remove on the next Flush. Objects may be added or removed while the list is iterated.
+     * @tparam T Class of stored objects.
+     */
+    template<class T>
+    class TUpdateList
+    {
+    private:
+        struct Entry
+        {
+            T* Item;
+            UpdateListSlot* Slot;
+        };
+
+    private:
+        std::vector<Entry> Items;
+        std::vector<uint32_t> Dead;
+        size_t Size = 0;
+
+    public:
+        /**
+         * @brief Adds an object to the list. Adding an object twice has no effect.
+         * @param Item Object to be added.
+         * @param Slot Slot stored by the object, has to outlive its membership in the list.
+         */
+        void Add(T* const Item, UpdateListSlot& Slot)
+        {
+            if (Slot.IsValid())
+            {
+                return;
+            }
+            Slot.Index = static_cast<uint32_t>(Items.size());
+            Items.push_back({Item, &Slot});
+            ++Size;
+        }
+
+        /**
+         * @brief Removes an object from the list. It won't be visited again, even during current iteration.
+         * Removing an object that isn't in the list has no effect.
+         * @param Slot Slot the object was added with.
+         */
+        void Remove(UpdateListSlot& Slot)
+        {
+            if (!Slot.IsValid())
+            {
+                return;
+            }
+            Items[Slot.Index] = {nullptr, nullptr};
+            Dead.push_back(Slot.Index);
+            Slot.Index = UpdateListSlot::InvalidIndex;
+            --Size;
+        }
+
+        /**
+         * @brief Compacts slots of removed objects. Must not be called while the list is iterated.
+         */
+        void Flush()
+        {
+            if (Dead.empty())
+            {
+                return;
+            }
+            /*going from the back guarantees that the last item is alive or is the one being removed*/
+            std::ranges::sort(Dead, std::greater());
+            for (const uint32_t slot : Dead)
+            {
+                if (slot != Items.size() - 1)
+                {
+                    const Entry last = Items.back();
+                    Items[slot] = last;
+                    last.Slot->Index = slot;
+                }
+                Items.pop_back();
+            }
+            Dead.clear();
+        }
+
+        /**
+         * @brief Invokes a function for every object that was in the list when iteration started and is still in it.
+         * @param Function Invoked with a pointer to every object.
+         */
+        template<class TFunction>
+        void ForEach(TFunction&& Function)
+        {
+            const size_t count = Items.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (T* item = Items[i].Item)
+                {
+                    Function(item);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns number of objects in the list.
+         */
+        [[nodiscard]] size_t GetSize() const
+        {
+            return Size;
+        }
+    };
+} // Engine
@@ -1,7 +1,14 @@
 #include "UpdateManager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 #include "GameMode/GameMode.h"
 #include "Player/Player.h"
+#include "Simulation.h"
+#include "Telemetry.h"
+#include "tracy/Tracy.hpp"
 
 namespace Engine
 {
@@ -14,30 +21,102 @@ namespace Engine
         Instance = new UpdateManager;
     }
 
+    void UpdateManager::RegisterComponent(IUpdateable* const Component, const UpdatePhase Phase, const int Priority)
+    {
+        TUpdateList<IUpdateable>& list = Phases[static_cast<size_t>(Phase)].Groups[Priority];
+        if (Component->UpdateList == &list)
+        {
+            return;
+        }
+        UnregisterComponent(Component);
+        Component->UpdateList = &list;
+        list.Add(Component, Component->UpdateSlot);
+    }
+
+    void UpdateManager::UnregisterComponent(IUpdateable* const Component)
+    {
+        if (Component->UpdateList != nullptr)
+        {
+            Component->UpdateList->Remove(Component->UpdateSlot);
+            Component->UpdateList = nullptr;
+        }
+    }
+
     void UpdateManager::Update(const float DeltaTime)
     {
-        if (!Dead.empty())
+        Simulation::Advance(DeltaTime);
+        for (PhaseData& phase : Phases)
         {
-            for (IUpdateable* component : Dead)
+            for (auto& [priority, updateables] : phase.Groups)
             {
-                std::erase(Updateables, component);
+                updateables.Flush();
             }
-            Dead.clear();
         }
 
-        if (GameMode)
+        for (size_t i = 0; i < UpdatePhaseCount; ++i)
+        {
+            TickPhase(static_cast<UpdatePhase>(i), DeltaTime);
+        }
+    }
+
+    void UpdateManager::TickPhase(const UpdatePhase Phase, const float DeltaTime)
+    {
+        ZoneScoped;
+        const char* name = GetPhaseName(Phase);
+        ZoneName(name, std::strlen(name));
+        const auto start = std::chrono::steady_clock::now();
+
+        PhaseData& phase = Phases[static_cast<size_t>(Phase)];
+        if (Phase == UpdatePhase::Gameplay)
         {
-            GameMode->Update(DeltaTime);
+            if (GameMode)
+            {
+                GameMode->Update(DeltaTime);
+            }
+
+            if (Player)
+            {
+                Player->Update(DeltaTime);
+            }
         }
 
-        if (Player)
+        size_t updateables = 0;
+        for (auto& [priority, list] : phase.Groups)
         {
-            Player->Update(DeltaTime);
+            updateables += list.GetSize();
+            list.ForEach([DeltaTime](IUpdateable* const Component)
+            {
+                Component->Update(DeltaTime);
+            });
         }
 
-        for (IUpdateable* component : Updateables)
+        const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - start;
+        phase.Statistics.LastMilliseconds = duration.count();
+        phase.Statistics.MaxMilliseconds = std::max(phase.Statistics.MaxMilliseconds, duration.count());
+        phase.Statistics.Updateables = updateables;
+#if TELEMETRY
+        Telemetry::AddTime(static_cast<TelemetryTimer>(Phase), duration.count());
+#endif
+    }
+
+    const char* UpdateManager::GetPhaseName(const UpdatePhase Phase)
+    {
+        switch (Phase)
         {
-            component->Update(DeltaTime);
+            case UpdatePhase::Input:
+                return "Input";
+            case UpdatePhase::Gameplay:
+                return "Gameplay";
+            case UpdatePhase::Ai:
+                return "AI";
+            case UpdatePhase::Physics:
+                return "Physics";
+            case UpdatePhase::Animation:
+                return "Animation";
+            case UpdatePhase::LateUpdate:
+                return "LateUpdate";
+            default:
+                return "Unknown";
         }
     }
 } // Engine
@@ -1,7 +1,10 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <map>
 #include "Engine/Components/Interfaces/IUpdateable.h"
+#include "Engine/EngineObjects/UpdateList.h"
 
 namespace Engine
 {
@@ -11,16 +14,51 @@ namespace Engine
 
 namespace Engine
 {
+    /**
+     * @brief Parts of a frame, ticked in order of declaration.
+     */
+    enum class UpdatePhase : uint8_t
+    {
+        Input,
+        Gameplay,
+        Ai,
+        Physics,
+        Animation,
+        LateUpdate,
+        Count
+    };
+
+    constexpr size_t UpdatePhaseCount = static_cast<size_t>(UpdatePhase::Count);
+
+    /**
+     * @brief Timing of a single update phase.
+     */
+    struct UpdatePhaseStatistics
+    {
+        float LastMilliseconds = 0.0f;
+        float MaxMilliseconds = 0.0f;
+        size_t Updateables = 0;
+    };
+
     /**
      * @brief Singleton responsible for ticking updateable components.
+     * Updateables are grouped into phases. Within a phase lower priorities are ticked first,
+     * order of updateables with equal priority is unspecified.
      */
     class UpdateManager
     {
+    private:
+        struct PhaseData
+        {
+            /*updateables grouped by priority, map keeps lists in place*/
+            std::map<int, TUpdateList<IUpdateable>> Groups;
+            UpdatePhaseStatistics Statistics;
+        };
+
     private:
         static UpdateManager* Instance;
 
-        std::vector<IUpdateable*> Updateables;
-        std::vector<IUpdateable*> Dead;
+        std::array<PhaseData, UpdatePhaseCount> Phases;
 
         GameMode* GameMode = nullptr;
         Player* Player = nullptr;
@@ -43,22 +81,20 @@ namespace Engine
         }
 
         /**
-         * @brief Registers new Updateable to be ticked.
+         * @brief Registers new Updateable to be ticked. Registering it again moves it to the new phase and priority.
+         * The list and slot are stored in the component, so neither registering nor unregistering looks anything up.
          * @param Component Component to be registered.
+         * @param Phase Phase in which the component is ticked.
+         * @param Priority Components with lower priority are ticked earlier within the phase.
          */
-        void RegisterComponent(IUpdateable* Component)
-        {
-            Updateables.push_back(Component);
-        }
+        void RegisterComponent(IUpdateable* Component, UpdatePhase Phase = UpdatePhase::Gameplay, int Priority = 0);
 
         /**
-         * @brief Stops component from being ticked afer this frame.
+         * @brief Stops component from being ticked. Safe to call inside update loop,
+         * the component is not ticked again even if it wasn't reached in this frame yet.
          * @param Component Component to be unregistered.
          */
-        void UnregisterComponent(IUpdateable* Component)
-        {
-            Dead.push_back(Component);
-        }
+        void UnregisterComponent(IUpdateable* Component);
 
         /**
          * @brief Stops component from being ticked. Should not be used inside update loop.
@@ -103,9 +139,25 @@ namespace Engine
         }
 
         /**
-         * @brief Calls Update() on all Updateables.
+         * @brief Calls Update() on all Updateables, phase by phase.
          * @param DeltaTime Time since last frame.
          */
         void Update(float DeltaTime);
+
+        /**
+         * @brief Returns timing of a phase measured in the last Update.
+         */
+        [[nodiscard]] const UpdatePhaseStatistics& GetStatistics(const UpdatePhase Phase) const
+        {
+            return Phases[static_cast<size_t>(Phase)].Statistics;
+        }
+
+        /**
+         * @brief Returns display name of a phase.
+         */
+        [[nodiscard]] static const char* GetPhaseName(UpdatePhase Phase);
+
+    private:
+        void TickPhase(UpdatePhase Phase, float DeltaTime);
     };
 } // Engine
@@ -7,6 +7,7 @@
 #include "Engine/Engine.h"
 #include "Engine/EngineObjects/Scene/SceneManager.h"
 #include "Engine/EngineObjects/Entity.h"
+#include "Engine/EngineObjects/Telemetry.h"
 #include "Engine/Components/Updateable.h"
 #include "Engine/Components/Renderers/ParticleEmitter.h"
 #include "Engine/Components/Audio/AudioSource.h"
@@ -36,6 +37,9 @@ void Engine::EditorGUI::Render(uint64_t Frame, Scene* scene, CameraRenderData re
     DrawGenerativeSystem(scene);
     m_MaterialMenu.DrawMaterialEditor();
     m_PrefabWindow.DrawImGui(scene);
+#if TELEMETRY
+    Telemetry::DrawImGui();
+#endif
 
     //m_TopBar.Draw();
 
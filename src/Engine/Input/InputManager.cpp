@@ -1,5 +1,8 @@
 #include "InputManager.h"
+#include <fstream>
 #include <iostream>
+#include <spdlog/spdlog.h>
+#include "Utility/BinaryStreamUtilities.h"
 #include "Engine/EngineObjects/UpdateManager.h"
 
 InputManager& InputManager::GetInstance()
@@ -14,6 +17,7 @@ InputManager::InputManager() :
 {
 }
 
+#if !HEADLESS
 void InputManager::Init(GLFWwindow* window) {
     m_Window = window;
     glfwSetKeyCallback(window, KeyCallback);
@@ -21,14 +25,47 @@ void InputManager::Init(GLFWwindow* window) {
     glfwSetCursorPosCallback(window, CursorPosCallback);
     glfwSetScrollCallback(window, ScrollCallback);
 }
+#endif
 
 void InputManager::Update() 
 {
+    if (m_Replaying)
+    {
+        if (m_ReplayFrame < m_Frames.size())
+        {
+            const InputFrame& frame = m_Frames[m_ReplayFrame++];
+            m_Keys = frame.keys;
+            m_MouseButtons = frame.mouseButtons;
+            m_MousePosition = frame.mousePosition;
+            m_ScrollOffset = frame.scrollOffset;
+            m_GamepadButtons = frame.gamepadButtons;
+            m_GamepadAxes = frame.gamepadAxes;
+        }
+        else
+        {
+            m_Keys = {};
+            m_MouseButtons = {};
+            m_ScrollOffset = 0.0f;
+            m_GamepadButtons = {};
+            m_GamepadAxes = {};
+        }
+        m_MouseDelta = m_MousePosition - m_LastMousePosition;
+        m_LastMousePosition = m_MousePosition;
+        return;
+    }
+
+    if (m_Recording)
+    {
+        m_Frames.push_back({m_Keys, m_MouseButtons, m_MousePosition, m_ScrollOffset, m_GamepadButtons, m_GamepadAxes});
+    }
+
     m_MouseDelta = m_MousePosition - m_LastMousePosition;
     m_LastMousePosition = m_MousePosition;
     m_ScrollOffset = 0.0f;
 
-    if (glfwJoystickIsGamepad(GLFW_JOYSTICK_1))
+#if !HEADLESS
+    // GLFW is only initialized along with a window.
+    if (m_Window != nullptr && glfwJoystickIsGamepad(GLFW_JOYSTICK_1))
     {
         GLFWgamepadstate state;
         if (glfwGetGamepadState(GLFW_JOYSTICK_1, &state))
@@ -40,6 +77,47 @@ void InputManager::Update()
                 m_GamepadAxes[i] = state.axes[i];
         }
     }
+#endif
+}
+
+void InputManager::StartRecording(const std::string& path)
+{
+    m_Frames.clear();
+    m_RecordingPath = path;
+    m_Recording = true;
+}
+
+void InputManager::StopRecording()
+{
+    if (!m_Recording)
+        return;
+
+    m_Recording = false;
+    std::ofstream file(m_RecordingPath, std::ios::binary);
+    if (!file)
+    {
+        spdlog::error("Can't write input recording to {0}.", m_RecordingPath);
+        return;
+    }
+    Utility::WriteBinary(file, ReplayMagic);
+    Utility::WriteBinary(file, m_Frames);
+    spdlog::info("Recorded {0} frames of input to {1}.", m_Frames.size(), m_RecordingPath);
+}
+
+bool InputManager::LoadReplay(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    uint32_t magic = 0;
+    Utility::ReadBinary(file, magic);
+    if (!file || magic != ReplayMagic)
+    {
+        spdlog::error("{0} is not an input recording.", path);
+        return false;
+    }
+    Utility::ReadBinary(file, m_Frames);
+    m_ReplayFrame = 0;
+    m_Replaying = true;
+    return true;
 }
 
 bool InputManager::IsKeyPressed(int key) const { return key >= 0 && key < GLFW_KEY_LAST && m_Keys[key]; }
@@ -2,13 +2,18 @@
 #include <GLFW/glfw3.h>  
 #include <glm/glm.hpp>  
 #include <array> 
+#include <string>
+#include <vector>
 
 class InputManager  
 {  
 public:  
    static InputManager& GetInstance();  
 
-   void Init(GLFWwindow* window);  
+#if !HEADLESS
+   // Receives input of a window, without it input only changes by replays.
+   void Init(GLFWwindow* window);
+#endif
    void Update();  
 
    bool IsKeyPressed(int key) const;  
@@ -20,6 +25,14 @@ public:
    bool IsGamepadButtonPressed(int button) const;  
    float GetGamepadAxis(int axis) const;  
 
+   // Records state of every Update() until StopRecording() writes it to a file.
+   void StartRecording(const std::string& path);
+   void StopRecording();
+
+   // Replaces live input with frames loaded from a recording, one frame per Update().
+   bool LoadReplay(const std::string& path);
+   bool IsReplaying() const { return m_Replaying; }
+
 private:  
    InputManager();  
    ~InputManager() = default;  
@@ -42,6 +55,24 @@ private:
    std::array<bool, 15> m_GamepadButtons = {};  
    std::array<float, 6> m_GamepadAxes = {};  
 
+   struct InputFrame
+   {
+      std::array<bool, GLFW_KEY_LAST> keys;
+      std::array<bool, GLFW_MOUSE_BUTTON_LAST> mouseButtons;
+      glm::vec2 mousePosition;
+      float scrollOffset;
+      std::array<bool, 15> gamepadButtons;
+      std::array<float, 6> gamepadAxes;
+   };
+
+   static constexpr uint32_t ReplayMagic = 0x494E5054; // "INPT"
+
+   std::vector<InputFrame> m_Frames;
+   std::string m_RecordingPath;
+   size_t m_ReplayFrame = 0;
+   bool m_Recording = false;
+   bool m_Replaying = false;
+
    // Callback bridging  
    static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);  
    static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);  
@@ -1,15 +1,81 @@
 #include "PrefabLoader.h"
 
+#include "Serialization/CookedFilesUtility.h"
 #include "Serialization/SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
 
 namespace Engine
 {
+    std::unordered_map<std::string, std::unique_ptr<PrefabTemplate>> PrefabLoader::Templates;
+
     Entity* PrefabLoader::LoadPrefab(const std::string& Path, Scene* const Scene, Transform* const Parent)
     {
-        rapidjson::Document document;
-        Serialization::ReadJsonFile(Path.c_str(), document);
-        rapidjson::Value& content = document["Prefab"].GetArray();
-        return Entity::DeserializeEntity(content, Scene, Parent);
+        Entity* instance = Preload(Path).Instantiate(Scene, Parent);
+        if (instance != nullptr)
+        {
+            instance->SetPrefab(NameTable::Intern(Path));
+        }
+        return instance;
+    }
+
+    const PrefabTemplate& PrefabLoader::Preload(const std::string& Path)
+    {
+        auto [iterator, inserted] = Templates.try_emplace(Path);
+        if (inserted)
+        {
+            iterator->second = ReadTemplate(Path);
+        }
+        return *iterator->second;
+    }
+
+    std::unique_ptr<PrefabTemplate> PrefabLoader::ReadTemplate(const std::string& Path)
+    {
+        ZoneScoped;
+        Serialization::CookedFile cooked;
+        if (!Serialization::ReadCookedFile(Path, cooked))
+        {
+            /*json prefabs are cooked in memory, so they're instantiated the same way as cooked files*/
+            rapidjson::Document document;
+            Serialization::ReadJsonFile(Path.c_str(), document);
+            if (!Serialization::CookJson(document, Path.c_str(), cooked))
+            {
+                spdlog::error("Failed to read prefab {0}.", Path);
+            }
+        }
+        return std::make_unique<PrefabTemplate>(std::move(cooked));
+    }
+
+    bool PrefabLoader::Reload(const std::string& Path, const rapidjson::Value& Document)
+    {
+        ZoneScoped;
+        if (!Document.IsObject())
+        {
+            return false;
+        }
+        const auto prefab = Document.FindMember("Prefab");
+        if (prefab == Document.MemberEnd() || !prefab->value.IsArray())
+        {
+            return false;
+        }
+        Serialization::CookedFile cooked;
+        if (!Serialization::CookJson(Document, Path.c_str(), cooked))
+        {
+            return false;
+        }
+        Templates[Path] = std::make_unique<PrefabTemplate>(std::move(cooked));
+        return true;
+    }
+
+    std::vector<std::string> PrefabLoader::GetCachedPaths()
+    {
+        std::vector<std::string> paths;
+        paths.reserve(Templates.size());
+        for (const auto& pair : Templates)
+        {
+            paths.push_back(pair.first);
+        }
+        return paths;
     }
 
     void PrefabLoader::SavePrefabToFile(const std::string& Path, const Entity* Entity)
@@ -20,5 +86,6 @@ namespace Engine
         Entity->SerializeEntity(content, document.GetAllocator());
         document.AddMember("Prefab", content, document.GetAllocator());
         Serialization::WriteJsonFile(Path.c_str(), document);
+        Templates.erase(Path);
     }
 }
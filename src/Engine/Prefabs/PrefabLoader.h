@@ -1,19 +1,71 @@
 #pragma once
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Engine/EngineObjects/Scene/Scene.h"
+#include "PrefabTemplate.h"
 
 namespace Engine
 {
-
+    /**
+     * @brief Loads prefabs from files. Every file is read and parsed once, later loads instantiate the cached template.
+     */
     class PrefabLoader
     {
+    private:
+        static std::unordered_map<std::string, std::unique_ptr<PrefabTemplate>> Templates;
+
     private:
         PrefabLoader() = default;
 
     public:
+        /**
+         * @brief Instantiates a prefab, reading it from the file first if it's not cached yet.
+         * The instance root remembers the prefab, see Entity::GetPrefab.
+         * @param Path Path of the prefab file.
+         * @param Scene Scene the prefab is spawned in.
+         * @param Parent Parent of the prefab root. If nullptr scene root becomes parent.
+         * @return Root entity of the instance.
+         */
         static Entity* LoadPrefab(const std::string& Path, Scene* Scene, Transform* Parent);
 
+        /**
+         * @brief Reads and parses a prefab file ahead of time, so the first LoadPrefab doesn't hitch.
+         * @param Path Path of the prefab file.
+         * @return Cached template.
+         */
+        static const PrefabTemplate& Preload(const std::string& Path);
+
+        /**
+         * @brief Reads and parses a prefab file to a new template, the cache is neither used nor updated.
+         * @param Path Path of the prefab file.
+         */
+        [[nodiscard]] static std::unique_ptr<PrefabTemplate> ReadTemplate(const std::string& Path);
+
+        /**
+         * @brief Removes all cached templates, the files are read again on next use.
+         */
+        static void ClearCache()
+        {
+            Templates.clear();
+        }
+
+        /**
+         * @brief Replaces the cached template of a prefab with new content of its file.
+         * Existing instances are left as they are.
+         * @param Path Path of the prefab file.
+         * @param Document Parsed prefab file.
+         * @return False if the document doesn't contain a valid prefab, the cached template is kept then.
+         */
+        static bool Reload(const std::string& Path, const rapidjson::Value& Document);
+
+        /**
+         * @brief Returns paths of all cached prefabs.
+         */
+        [[nodiscard]] static std::vector<std::string> GetCachedPaths();
+
         static void SavePrefabToFile(const std::string& Path, const Entity* Entity);
     };
 
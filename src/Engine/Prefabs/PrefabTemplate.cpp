@@ -0,0 +1,65 @@
+#include "PrefabTemplate.h"
+
+#include "Engine/EngineObjects/Entity.h"
+#include "Engine/EngineObjects/Scene/Scene.h"
+#include "tracy/Tracy.hpp"
+
+namespace Engine
+{
+    PrefabTemplate::PrefabTemplate(Serialization::CookedFile&& File) :
+        Cooked(std::move(File))
+    {
+    }
+
+    Entity* PrefabTemplate::Instantiate(Scene* const Scene, Transform* const Parent) const
+    {
+        ZoneScoped;
+        const Serialization::TypeMask entityType = Serialization::TypeMask(1) << Entity::GetStaticTypeId();
+
+        /*prefabs are small, reading them on the calling thread is cheaper than scheduling jobs*/
+        const std::vector<Serialization::SerializedObject*> objects = Scene::InstantiateCooked(Cooked, nullptr,
+                                                                                               Scene, 1);
+        Entity* root = nullptr;
+
+        for (Serialization::SerializedObject* object : objects)
+        {
+            object->ResetId();
+            if (Serialization::TypeIdRegistry::GetMask(object) & entityType)
+            {
+                Entity* entity = static_cast<Entity*>(object);
+                entity->GetTransform()->ResetId();
+                if (root == nullptr)
+                {
+                    root = entity;
+                }
+            }
+        }
+
+        if (root == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (root->GetTransform()->GetParent() == nullptr)
+        {
+            if (Parent == nullptr)
+            {
+                root->GetTransform()->SetParent(Scene->GetRoot()->GetTransform());
+            }
+            else
+            {
+                root->GetTransform()->SetParent(Parent);
+            }
+        }
+
+        for (Serialization::SerializedObject* object : objects)
+        {
+            if (Component* component = dynamic_cast<Component*>(object))
+            {
+                component->Start();
+            }
+        }
+
+        return root;
+    }
+} // Engine
@@ -0,0 +1,49 @@
+#pragma once
+#include "Serialization/CookedFilesUtility.h"
+
+namespace Engine
+{
+    class Entity;
+    class Scene;
+    class Transform;
+
+    /**
+     * @brief Prefab in the cooked format, ready to be instantiated any number of times.
+     * Json prefabs are cooked in memory when the template is created, so every instance is read from binary field
+     * blocks whose references are object indices, with types resolved once.
+     */
+    class PrefabTemplate final
+    {
+    private:
+        /*objects in order of serialization, the first entity becomes root of every instance*/
+        Serialization::CookedFile Cooked;
+
+    public:
+        /**
+         * @brief Creates a template from a cooked prefab.
+         * @param File Cooked file, read from disk or cooked by Serialization::CookJson.
+         */
+        explicit PrefabTemplate(Serialization::CookedFile&& File);
+
+        PrefabTemplate(const PrefabTemplate&) = delete;
+
+        PrefabTemplate& operator=(const PrefabTemplate&) = delete;
+
+    public:
+        /**
+         * @brief Checks whether the template contains any objects to instantiate.
+         */
+        [[nodiscard]] bool IsValid() const
+        {
+            return Cooked.GetObjectCount() != 0;
+        }
+
+        /**
+         * @brief Creates new objects from this template. All objects receive new ids and their components are started.
+         * @param Scene Scene the entities are spawned in.
+         * @param Parent Parent of the instance root. If nullptr scene root becomes parent.
+         * @return Root entity of the instance or nullptr if the template contains no entity.
+         */
+        Entity* Instantiate(Scene* Scene, Transform* Parent) const;
+    };
+} // Engine
@@ -1,6 +1,7 @@
 #include "CubeGeometry.h"
 
 #include "glad/glad.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 namespace Engine
 {
@@ -40,9 +41,11 @@ namespace Engine
         glBindBuffer(GL_ARRAY_BUFFER, VertexBuffer);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ElementBuffer);
+        TELEMETRY_COUNT(BytesUploaded, sizeof(faceIndices));
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(faceIndices), faceIndices,
                      GL_STATIC_DRAW);
 
+        TELEMETRY_COUNT(BytesUploaded, sizeof(vertices));
         glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
                      vertices, GL_STATIC_DRAW);
 
@@ -62,6 +65,7 @@ namespace Engine
     void Engine::CubeGeometry::Draw()
     {
         glBindVertexArray(VertexArray);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
         glBindVertexArray(0);
     }
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace Engine
+{
+    /**
+     * @brief Tells whether an OpenGL context is current.
+     * Headless runs don't create one, assets are then loaded without uploading anything to the GPU and objects get
+     * placeholder ids, so they can still be told apart and serialized.
+     */
+    class GraphicsContext final
+    {
+    private:
+        static inline bool Available = false;
+
+    private:
+        GraphicsContext() = default;
+
+    public:
+        [[nodiscard]] static bool IsAvailable()
+        {
+            return Available;
+        }
+
+        /**
+         * @brief Called by the engine once the OpenGL functions are loaded.
+         */
+        static void SetAvailable(const bool IsAvailable)
+        {
+            Available = IsAvailable;
+        }
+    };
+} // Engine
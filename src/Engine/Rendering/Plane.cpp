@@ -1,5 +1,6 @@
 #include "Plane.h"
 #include "glad/glad.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 struct Engine::Plane::CachedData Engine::Plane::Plane::CachedData;
 
@@ -21,6 +22,7 @@ void Engine::Plane::Draw()
 {
     static Plane plane;
     glBindVertexArray(CachedData.VertexArray);
+    TELEMETRY_COUNT(DrawCalls, 1);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
     glBindVertexArray(0);
 }
@@ -35,9 +37,11 @@ void Engine::Plane::Initialize()
     glBindBuffer(GL_ARRAY_BUFFER, CachedData.VertexBuffer);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, CachedData.ElementBuffer);
+    TELEMETRY_COUNT(BytesUploaded, sizeof(FaceIndices));
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(FaceIndices), FaceIndices,
                  GL_STATIC_DRAW);
 
+    TELEMETRY_COUNT(BytesUploaded, sizeof(Vertices));
     glBufferData(GL_ARRAY_BUFFER, sizeof(Vertices),
                  Vertices, GL_STATIC_DRAW);
 
@@ -1,5 +1,6 @@
 #include "ScreenQuad.h"
 #include "glad/glad.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 struct Engine::Rendering::ScreenQuad::CachedData Engine::Rendering::ScreenQuad::CachedData;
 
@@ -23,6 +24,7 @@ Engine::Rendering::ScreenQuad::~ScreenQuad() = default;
 void Engine::Rendering::ScreenQuad::Draw() const // NOLINT(*-convert-member-functions-to-static)
 {
     glBindVertexArray(CachedData.VertexArray);
+    TELEMETRY_COUNT(DrawCalls, 1);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
     glBindVertexArray(0);
 }
@@ -49,9 +51,11 @@ void Engine::Rendering::ScreenQuad::Initialize()
     glBindBuffer(GL_ARRAY_BUFFER, CachedData.VertexBuffer);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, CachedData.ElementBuffer);
+    TELEMETRY_COUNT(BytesUploaded, sizeof(faceIndices));
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(faceIndices), faceIndices,
                  GL_STATIC_DRAW);
 
+    TELEMETRY_COUNT(BytesUploaded, sizeof(vertices));
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices),
                  vertices, GL_STATIC_DRAW);
 
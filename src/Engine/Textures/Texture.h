@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include "glad/glad.h"
+#include "Engine/Rendering/GraphicsContext.h"
 #include "Utility/AssertionsUtility.h"
 
 namespace Engine
@@ -29,7 +30,8 @@ namespace Engine
 
         [[nodiscard]] uint64_t GetHandleReadonly() const
         {
-            if (TextureId == 0)
+            /*placeholder textures of headless runs have no handle*/
+            if (TextureId == 0 || !GraphicsContext::IsAvailable())
             {
                 return 0;
             }
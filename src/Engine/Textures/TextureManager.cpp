@@ -4,6 +4,7 @@
 #include <filesystem>
 
 #include "Texture.h"
+#include "Utility/DDSLoader.h"
 #include "Utility/TextureUtilities.h"
 
 
@@ -21,7 +22,11 @@ namespace Engine
         }
 
         uint32_t textureId;
-        if (std::filesystem::path(path).extension() == ".hdr")
+        if (!GraphicsContext::IsAvailable())
+        {
+            textureId = NextPlaceholderId++;
+        }
+        else if (std::filesystem::path(path).extension() == ".hdr")
         {
             textureId = Utility::LoadHdrCubeMapFromFile(Path);
         }
@@ -35,14 +40,28 @@ namespace Engine
         return Texture(textureId);
     }
 
+    Texture TextureManager::AddTexture(const char* const Path, const Utility::DdsImage& Image)
+    {
+        const std::string path = Path;
+
+        if (const auto iterator = Textures.find(path); iterator != Textures.end())
+        {
+            return Texture(iterator->second);
+        }
+
+        const uint32_t textureId = GraphicsContext::IsAvailable() ? Utility::UploadTexture2D(Image)
+                                                                  : NextPlaceholderId++;
+        Textures.emplace(path, textureId);
+        return Texture(textureId);
+    }
+
     bool TextureManager::DeleteTexture(const char* Path)
     {
         const std::string path = Path;
         if (const auto iterator = Textures.find(path);
             iterator != Textures.end())
         {
-            const uint32_t id = iterator->second.GetId();
-            glDeleteTextures(1, &id);
+            ReleaseTexture(iterator->second);
             Textures.erase(iterator);
             return true;
         }
@@ -55,8 +74,7 @@ namespace Engine
         {
             if (pair.second == Texture)
             {
-                const uint32_t id = pair.second.GetId();
-                glDeleteTextures(1, &id);
+                ReleaseTexture(pair.second);
                 Textures.erase(pair.first);
                 return true;
             }
@@ -68,8 +86,7 @@ namespace Engine
     {
         for (const auto& pair : Textures)
         {
-            const uint32_t id = pair.second.GetId();
-            glDeleteTextures(1, &id);
+            ReleaseTexture(pair.second);
         }
         Textures.clear();
     }
@@ -103,4 +120,13 @@ namespace Engine
 
         return std::string();
     }
+
+    void TextureManager::ReleaseTexture(const Texture Texture)
+    {
+        if (GraphicsContext::IsAvailable())
+        {
+            const uint32_t id = Texture.GetId();
+            glDeleteTextures(1, &id);
+        }
+    }
 } // Engine
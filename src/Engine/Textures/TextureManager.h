@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -7,6 +8,11 @@ namespace Engine
     class Texture;
 }
 
+namespace Utility
+{
+    struct DdsImage;
+}
+
 namespace Engine
 {
     /**
@@ -16,6 +22,8 @@ namespace Engine
     {
     private:
         static std::unordered_map<std::string, Texture> Textures;
+        /*id given to the next texture loaded without an OpenGL context*/
+        static inline uint32_t NextPlaceholderId = 1;
 
     private:
         TextureManager() = default;
@@ -28,6 +36,14 @@ namespace Engine
          */
         static Texture GetTexture(const char* Path);
 
+        /**
+         * @brief Creates a texture from data read in advance, used by asset streaming.
+         * @param Path Path to a texture file, later GetTexture calls with this path return the texture.
+         * @param Image Data read from the file with Utility::ReadDds.
+         * @return A loaded texture, or the existing one if the path is already loaded.
+         */
+        static Texture AddTexture(const char* Path, const Utility::DdsImage& Image);
+
         /**
          * @brief Frees resources used by an existing texture.
          * @param Path Path to a texture file.
@@ -67,5 +83,8 @@ namespace Engine
          * @return
          */
         static std::string GetTexturePath(Texture Texture);
+
+    private:
+        static void ReleaseTexture(Texture Texture);
     };
 } // Engine
@@ -2,7 +2,9 @@
 
 #include <rapidjson/document.h>
 
+#include "Engine/Rendering/GraphicsContext.h"
 #include "Serialization/SerializationUtility.h"
+#include "Utility/AssertionsUtility.h"
 #include "Utility/TextureUtilities.h"
 
 namespace Engine::Ui
@@ -17,9 +19,14 @@ namespace Engine::Ui
 
         rapidjson::Document document;
 
-        int atlasWidth;
-        int atlasHeight;
-        GlyphAtlas = Utility::LoadTexture2DFromFile(atlasPath.c_str(), GL_RGBA, 4,GL_RGBA, atlasWidth, atlasHeight);
+        /*glyph metrics are still read without an OpenGL context, only texture coordinates are meaningless then*/
+        int atlasWidth = 1;
+        int atlasHeight = 1;
+        if (GraphicsContext::IsAvailable())
+        {
+            GlyphAtlas = Utility::LoadTexture2DFromFile(atlasPath.c_str(), GL_RGBA, 4,GL_RGBA, atlasWidth,
+                                                        atlasHeight);
+        }
 
         Serialization::ReadJsonFile(descriptorPath.c_str(), document);
 
@@ -6,6 +6,7 @@
 #include "FontRendering/FontVertex.h"
 #include "FontRendering/TextManager.h"
 #include "Shaders/ShaderManager.h"
+#include "Engine/EngineObjects/Telemetry.h"
 
 namespace Engine::Ui
 {
@@ -37,6 +38,7 @@ namespace Engine::Ui
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, Font->GetGlyphAtlas());
         glBindVertexArray(VertexArray);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawArrays(GL_TRIANGLES, 0, VertexCount);
         glBindVertexArray(0);
     }
@@ -115,6 +117,7 @@ namespace Engine::Ui
         glBindVertexArray(VertexArray);
         glBindBuffer(GL_ARRAY_BUFFER, VertexBuffer);
 
+        TELEMETRY_COUNT(BytesUploaded, VertexCount * sizeof(FontVertex));
         glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(VertexCount * sizeof(FontVertex)), vertices,
                      GL_STATIC_DRAW);
 
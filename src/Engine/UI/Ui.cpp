@@ -9,13 +9,19 @@ namespace Engine::Ui
 {
     Ui::Ui()
     {
-        RenderingManager::GetInstance()->RegisterUi(this);
-        UpdateManager::GetInstance()->RegisterComponent(this);
+        if (RenderingManager* const renderingManager = RenderingManager::GetInstance())
+        {
+            renderingManager->RegisterUi(this);
+        }
+        UpdateManager::GetInstance()->RegisterComponent(this, UpdatePhase::LateUpdate);
     }
 
     Ui::~Ui()
     {
-        RenderingManager::GetInstance()->UnregisterUi(this);
+        if (RenderingManager* const renderingManager = RenderingManager::GetInstance())
+        {
+            renderingManager->UnregisterUi(this);
+        }
         UpdateManager::GetInstance()->UnregisterComponent(this);
     }
 
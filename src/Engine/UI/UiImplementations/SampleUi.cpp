@@ -1,5 +1,5 @@
 #include "SampleUi.h"
-#include "GLFW/glfw3.h"
+#include "Engine/EngineObjects/Simulation.h"
 #include "Engine/Textures/TextureManager.h"
 #include "Engine/UI/Image.h"
 #include "Engine/UI/Text.h"
@@ -45,10 +45,11 @@ namespace Engine::Ui
 
     void SampleUi::Update(const float DeltaTime)
     {
-        MovingImage->Rect.SetPositionPixels(glm::vec3(720 * std::cos(glfwGetTime()), -200, 0));
-        MovingImage->Rect.SetRotation(glfwGetTime() * 180);
+        const double time = Simulation::GetTime();
+        MovingImage->Rect.SetPositionPixels(glm::vec3(720 * std::cos(time), -200, 0));
+        MovingImage->Rect.SetRotation(time * 180);
         MovingImage->GetRect().SetSizePixels(
-                glm::vec2(480, 270) * static_cast<float>(std::cos(glfwGetTime()) * 0.25f + 0.75));
+                glm::vec2(480, 270) * static_cast<float>(std::cos(time) * 0.25f + 0.75));
         Timer += DeltaTime;
         if (Timer > 1.0f)
         {
@@ -1,17 +1,26 @@
 #pragma once
-#include <functional>
-#include <combaseapi.h>
+#include <cstddef>
+#include <cstring>
 
 namespace Events
 {
     /**
      * @brief Class representing callback to an event.
+     * Stores an object pointer and its method in place, so it never allocates.
+     * Two Actions are equal if they are bound to the same method of the same object.
      */
     class Action
     {
     private:
-        GUID Id;
-        std::function<void()> Callback;
+        /*enough for pointers to methods of classes with multiple inheritance*/
+        static constexpr size_t MethodStorageSize = 2 * sizeof(void*);
+
+        typedef void (*Thunk)(void* Owner, const std::byte* Method);
+
+    private:
+        void* Owner;
+        Thunk Call;
+        alignas(void*) std::byte Method[MethodStorageSize] = {};
 
     public:
         Action() = delete;
@@ -23,19 +32,29 @@ namespace Events
          * @param Method A Method to call.
          */
         template<class U>
-        Action(U* Owner, void (U::* Method)()) : // NOLINT(*-pro-type-member-init)
-            Callback([Owner, Method]() { (Owner->*Method)(); })
+        Action(U* Owner, void (U::* Method)()) :
+            Owner(Owner), Call(&CallMethod<U>)
+        {
+            static_assert(sizeof(Method) <= MethodStorageSize, "Method pointer doesn't fit into Action.");
+            std::memcpy(this->Method, &Method, sizeof(Method));
+        }
+
+    private:
+        template<class U>
+        static void CallMethod(void* const Owner, const std::byte* const Method)
         {
-            (void) CoCreateGuid(&Id); // ID initialized here.
+            void (U::* method)();
+            std::memcpy(&method, Method, sizeof(method));
+            (static_cast<U*>(Owner)->*method)();
         }
 
     public:
         /**
          * @brief Calls method associated with this Action.
          */
-        void Invoke()
+        void Invoke() const
         {
-            Callback();
+            Call(Owner, Method);
         }
 
     public:
@@ -46,7 +65,7 @@ namespace Events
          */
         bool operator==(const Action& Other) const
         {
-            return Id == Other.Id;
+            return Owner == Other.Owner && Call == Other.Call && std::memcmp(Method, Other.Method, sizeof(Method)) == 0;
         }
     };
 } // Events
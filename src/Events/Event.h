@@ -1,19 +1,32 @@
 #pragma once
-#include <functional>
+#include <algorithm>
 #include <vector>
 
+#include "ListenerHandle.h"
 #include "Action.h"
 
 namespace Events
 {
     /**
      * @brief Event Actions can subscribe to.
+     * Listeners may be added or removed by other listeners while the event is being invoked.
+     * Removed listeners are not called anymore, added ones are first called on the next Invoke.
      */
     class Event
     {
+    private:
+        struct Listener
+        {
+            Action Callback;
+            ListenerHandle Handle;
+        };
 
     private:
-        std::vector<Action> Listeners;
+        std::vector<Listener> Listeners;
+        ListenerHandle LastHandle = InvalidListenerHandle;
+        /*number of Invoke calls in progress, removal only marks listeners while it's not zero*/
+        uint32_t InvokeDepth = 0;
+        bool HasRemovedListeners = false;
 
     public:
         /**
@@ -28,10 +41,12 @@ namespace Events
         /**
          * @brief Adds a new listener to this Event.
          * @param Listener A listener to add.
+         * @return Handle that can be used to remove the listener.
          */
-        void AddListener(const Action& Listener)
+        ListenerHandle AddListener(const Action& Listener)
         {
-            Listeners.push_back(Listener);
+            Listeners.push_back({Listener, ++LastHandle});
+            return LastHandle;
         }
 
         /**
@@ -40,7 +55,16 @@ namespace Events
          */
         void RemoveListener(const Action& Listener)
         {
-            std::erase(Listeners, Listener);
+            RemoveIf([&Listener](const Event::Listener& Other) { return Other.Callback == Listener; });
+        }
+
+        /**
+         * @brief Removes listener from this event.
+         * @param Handle Handle returned by AddListener.
+         */
+        void RemoveListener(const ListenerHandle Handle)
+        {
+            RemoveIf([Handle](const Event::Listener& Other) { return Other.Handle == Handle; });
         }
 
         /**
@@ -70,7 +94,7 @@ namespace Events
          */
         void RemoveAllListeners()
         {
-            Listeners.clear();
+            RemoveIf([](const Event::Listener&) { return true; });
         }
 
         /**
@@ -78,9 +102,38 @@ namespace Events
          */
         void Invoke()
         {
-            for (Action& Listener : Listeners)
+            ++InvokeDepth;
+            const size_t count = Listeners.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (Listeners[i].Handle != InvalidListenerHandle)
+                {
+                    Listeners[i].Callback.Invoke();
+                }
+            }
+            if (--InvokeDepth == 0 && HasRemovedListeners)
+            {
+                std::erase_if(Listeners, [](const Listener& Other) { return Other.Handle == InvalidListenerHandle; });
+                HasRemovedListeners = false;
+            }
+        }
+
+    private:
+        template<class TPredicate>
+        void RemoveIf(TPredicate&& Predicate)
+        {
+            if (InvokeDepth == 0)
+            {
+                std::erase_if(Listeners, Predicate);
+                return;
+            }
+            for (Listener& listener : Listeners)
             {
-                Listener.Invoke();
+                if (listener.Handle != InvalidListenerHandle && Predicate(listener))
+                {
+                    listener.Handle = InvalidListenerHandle;
+                    HasRemovedListeners = true;
+                }
             }
         }
     };
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+namespace Events
+{
+    /**
+     * @brief Identifies a listener added to an event, unique within that event.
+     */
+    typedef uint32_t ListenerHandle;
+
+    constexpr ListenerHandle InvalidListenerHandle = 0;
+} // Events
@@ -1,19 +1,28 @@
 #pragma once
-#include <functional>
-#include <combaseapi.h>
+#include <cstddef>
+#include <cstring>
 
 namespace Events
 {
     /**
      * @brief Class representing callback to an event.
+     * Stores an object pointer and its method in place, so it never allocates.
+     * Two Actions are equal if they are bound to the same method of the same object.
      * @tparam T Argument type callback will be called with.
      */
     template<typename T>
     class TAction
     {
     private:
-        GUID Id;
-        std::function<void(T)> Callback;
+        /*enough for pointers to methods of classes with multiple inheritance*/
+        static constexpr size_t MethodStorageSize = 2 * sizeof(void*);
+
+        typedef void (*Thunk)(void* Owner, const std::byte* Method, T Argument);
+
+    private:
+        void* Owner;
+        Thunk Call;
+        alignas(void*) std::byte Method[MethodStorageSize] = {};
 
     public:
         TAction() = delete;
@@ -25,10 +34,20 @@ namespace Events
          * @param Method A Method to call.
          */
         template<class U>
-        TAction(U* Owner, void (U::* Method)(T)) : // NOLINT(*-pro-type-member-init)
-            Callback([Owner, Method](T Arg) { (Owner->*Method)(Arg); })
+        TAction(U* Owner, void (U::* Method)(T)) :
+            Owner(Owner), Call(&CallMethod<U>)
+        {
+            static_assert(sizeof(Method) <= MethodStorageSize, "Method pointer doesn't fit into TAction.");
+            std::memcpy(this->Method, &Method, sizeof(Method));
+        }
+
+    private:
+        template<class U>
+        static void CallMethod(void* const Owner, const std::byte* const Method, T Argument)
         {
-            (void) CoCreateGuid(&Id); // ID initialized here.
+            void (U::* method)(T);
+            std::memcpy(&method, Method, sizeof(method));
+            (static_cast<U*>(Owner)->*method)(Argument);
         }
 
     public:
@@ -36,9 +55,9 @@ namespace Events
          * @brief Calls method associated with this Action.
          * @param Argument Argument method will be called with.
          */
-        void Invoke(T Argument)
+        void Invoke(T Argument) const
         {
-            Callback(Argument);
+            Call(Owner, Method, Argument);
         }
 
     public:
@@ -49,7 +68,7 @@ namespace Events
          */
         bool operator==(const TAction<T>& Other) const
         {
-            return Id == Other.Id;
+            return Owner == Other.Owner && Call == Other.Call && std::memcmp(Method, Other.Method, sizeof(Method)) == 0;
         }
     };
 } // Events
@@ -1,21 +1,34 @@
 #pragma once
-#include <functional>
+#include <algorithm>
 #include <vector>
 
+#include "ListenerHandle.h"
 #include "TAction.h"
 
 namespace Events
 {
     /**
      * @brief Event Actions can subscribe to.
+     * Listeners may be added or removed by other listeners while the event is being invoked.
+     * Removed listeners are not called anymore, added ones are first called on the next Invoke.
      * @tparam T Argument type listeners will be called with.
      */
     template<typename T>
     class TEvent
     {
+    private:
+        struct Listener
+        {
+            TAction<T> Callback;
+            ListenerHandle Handle;
+        };
 
     private:
-        std::vector<TAction<T>> Listeners;
+        std::vector<Listener> Listeners;
+        ListenerHandle LastHandle = InvalidListenerHandle;
+        /*number of Invoke calls in progress, removal only marks listeners while it's not zero*/
+        uint32_t InvokeDepth = 0;
+        bool HasRemovedListeners = false;
 
     public:
         /**
@@ -30,10 +43,12 @@ namespace Events
         /**
          * @brief Adds a new listener to this Event.
          * @param Listener A listener to add.
+         * @return Handle that can be used to remove the listener.
          */
-        void AddListener(const TAction<T>& Listener)
+        ListenerHandle AddListener(const TAction<T>& Listener)
         {
-            Listeners.push_back(Listener);
+            Listeners.push_back({Listener, ++LastHandle});
+            return LastHandle;
         }
 
         /**
@@ -42,7 +57,16 @@ namespace Events
          */
         void RemoveListener(const TAction<T>& Listener)
         {
-            std::erase(Listeners, Listener);
+            RemoveIf([&Listener](const TEvent::Listener& Other) { return Other.Callback == Listener; });
+        }
+
+        /**
+         * @brief Removes listener from this event.
+         * @param Handle Handle returned by AddListener.
+         */
+        void RemoveListener(const ListenerHandle Handle)
+        {
+            RemoveIf([Handle](const TEvent::Listener& Other) { return Other.Handle == Handle; });
         }
 
         /**
@@ -72,7 +96,7 @@ namespace Events
          */
         void RemoveAllListeners()
         {
-            Listeners.clear();
+            RemoveIf([](const TEvent::Listener&) { return true; });
         }
 
         /**
@@ -81,9 +105,38 @@ namespace Events
          */
         void Invoke(T Argument)
         {
-            for (TAction<T>& Listener : Listeners)
+            ++InvokeDepth;
+            const size_t count = Listeners.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (Listeners[i].Handle != InvalidListenerHandle)
+                {
+                    Listeners[i].Callback.Invoke(Argument);
+                }
+            }
+            if (--InvokeDepth == 0 && HasRemovedListeners)
+            {
+                std::erase_if(Listeners, [](const Listener& Other) { return Other.Handle == InvalidListenerHandle; });
+                HasRemovedListeners = false;
+            }
+        }
+
+    private:
+        template<class TPredicate>
+        void RemoveIf(TPredicate&& Predicate)
+        {
+            if (InvokeDepth == 0)
+            {
+                std::erase_if(Listeners, Predicate);
+                return;
+            }
+            for (Listener& listener : Listeners)
             {
-                Listener.Invoke(Argument);
+                if (listener.Handle != InvalidListenerHandle && Predicate(listener))
+                {
+                    listener.Handle = InvalidListenerHandle;
+                    HasRemovedListeners = true;
+                }
             }
         }
     };
@@ -1,11 +1,11 @@
 #include "FloorMaterial.h"
 
 #include "Engine/Components/BloodSystem/BloodManager.h"
+#include "Engine/EngineObjects/Simulation.h"
 #include "Engine/Textures/TextureManager.h"
 #include "Serialization/SerializationUtility.h"
 #include "Shaders/ShaderManager.h"
 #include "Shaders/ShaderSourceFiles.h"
-#include "GLFW/glfw3.h"
 
 namespace Materials
 {
@@ -99,7 +99,7 @@ namespace Materials
 
         BloodNormal0.Bind();
         BloodNormal1.Bind();
-        Shaders::Shader::SetUniform(TimeLocation, static_cast<float>(glfwGetTime()));
+        Shaders::Shader::SetUniform(TimeLocation, static_cast<float>(Engine::Simulation::GetTime()));
 
         glActiveTexture(GL_TEXTURE0 + BloodMaskLocation);
         glBindTexture(GL_TEXTURE_2D, bloodManager->GetMaskId());
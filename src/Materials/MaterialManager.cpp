@@ -5,6 +5,7 @@
 #include "RefractiveMaterial.h"
 #include "SkyboxMaterial.h"
 #include "WaterMaterial.h"
+#include "Engine/EngineObjects/AssetHotReload.h"
 #include "Serialization/SerializationFilesUtility.h"
 #include "Utility/AssertionsUtility.h"
 
@@ -22,6 +23,34 @@ namespace Materials
         return material;
     }
 
+    bool MaterialManager::ReloadMaterial(const std::string& Path, const rapidjson::Value& Json)
+    {
+        const auto iterator = GetMaterials().find(Path);
+        if (iterator == GetMaterials().end() || iterator->second == nullptr || !Json.IsObject())
+        {
+            return false;
+        }
+        const auto type = Json.FindMember("type");
+        if (type == Json.MemberEnd() || !type->value.IsString() ||
+            iterator->second->GetType() != type->value.GetString())
+        {
+            return false;
+        }
+        iterator->second->Deserialize(Json);
+        return true;
+    }
+
+    std::vector<std::string> MaterialManager::GetMaterialPaths()
+    {
+        std::vector<std::string> paths;
+        paths.reserve(GetMaterials().size());
+        for (const auto& pair : GetMaterials())
+        {
+            paths.push_back(pair.first);
+        }
+        return paths;
+    }
+
     bool MaterialManager::DeleteMaterial(const std::string& Path)
     {
         if (const auto iterator = GetMaterials().find(Path); iterator != GetMaterials().end())
@@ -97,6 +126,7 @@ namespace Materials
         rapidjson::MemoryPoolAllocator<> allocator;
         rapidjson::Value json = Material->Serialize(allocator);
         Serialization::WriteJsonFile(Path.c_str(), json);
+        Engine::AssetHotReload::OnAssetSaved(Path);
     }
 
     void MaterialManager::Initialize()
@@ -2,8 +2,10 @@
 #include <algorithm>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Serialization/SerializationFilesUtility.h"
+#include "Utility/AssertionsUtility.h"
 
 namespace Materials
 {
@@ -204,6 +206,30 @@ namespace Materials
          */
         static Material* GetMaterial(const std::string& Path);
 
+        /**
+         * @brief Sets properties of a loaded material from new content of its file.
+         * The material object is kept, so renderers using it see the new values right away.
+         * @param Path Filepath of a material file.
+         * @param Json Parsed material file.
+         * @return False if the material isn't loaded or the file describes a material of another type.
+         */
+        static bool ReloadMaterial(const std::string& Path, const rapidjson::Value& Json);
+
+        /**
+         * @brief Returns filepaths of all loaded materials.
+         */
+        [[nodiscard]] static std::vector<std::string> GetMaterialPaths();
+
+        /**
+         * @brief Checks if material is loaded.
+         * @param Path Filepath of a material file.
+         * @return True if material is loaded, false otherwise.
+         */
+        [[nodiscard]] static bool IsValid(const std::string& Path)
+        {
+            return GetMaterials().contains(Path);
+        }
+
         /**
          * @brief Deletes material object.
          * @param Path Filepath of a material file.
@@ -19,7 +19,7 @@ namespace Materials
 
     public:
         MaterialProperty(const char* const Name, const Shaders::Shader& Owner) :
-            Location(glGetUniformLocation(Owner.GetId(), Name))
+            Location(Owner.GetUniformLocation(Name))
         {
             if constexpr (std::is_arithmetic_v<T>)
             {
@@ -32,7 +32,7 @@ namespace Materials
         }
 
         MaterialProperty(const char* const Name, const Shaders::Shader& Owner, const T& value) :
-            Location(glGetUniformLocation(Owner.GetId(), Name)), Value(value)
+            Location(Owner.GetUniformLocation(Name)), Value(value)
         {
         }
 
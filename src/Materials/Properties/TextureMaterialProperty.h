@@ -16,12 +16,12 @@ namespace Materials
 
     public:
         TextureMaterialProperty(const char* const Name, const Shaders::Shader& Owner) :
-            Location(glGetUniformLocation(Owner.GetId(), Name)), TextureId(0), Handle(0)
+            Location(Owner.GetUniformLocation(Name)), TextureId(0), Handle(0)
         {
         }
 
         TextureMaterialProperty(const char* const Name, const Shaders::Shader& Owner, const Engine::Texture Value) :
-            Location(glGetUniformLocation(Owner.GetId(), Name)), TextureId(Value.GetId()),
+            Location(Owner.GetUniformLocation(Name)), TextureId(Value.GetId()),
             Handle(Value.GetHandleReadonly())
         {
         }
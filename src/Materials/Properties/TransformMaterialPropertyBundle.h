@@ -14,10 +14,10 @@ namespace Materials
 
     public:
         explicit TransformMaterialPropertyBundle(const Shaders::Shader& Owner) :
-            CameraPosition(glGetUniformLocation(Owner.GetId(), "CameraPosition")),
-            ViewMatrix(glGetUniformLocation(Owner.GetId(), "ViewMatrix")),
-            ProjectionMatrix(glGetUniformLocation(Owner.GetId(), "ProjectionMatrix")),
-            ObjectToWorldMatrix(glGetUniformLocation(Owner.GetId(), "ObjectToWorldMatrix"))
+            CameraPosition(Owner.GetUniformLocation("CameraPosition")),
+            ViewMatrix(Owner.GetUniformLocation("ViewMatrix")),
+            ProjectionMatrix(Owner.GetUniformLocation("ProjectionMatrix")),
+            ObjectToWorldMatrix(Owner.GetUniformLocation("ObjectToWorldMatrix"))
         {
         }
 
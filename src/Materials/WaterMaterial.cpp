@@ -1,5 +1,4 @@
 #include "WaterMaterial.h"
-#include "GLFW/glfw3.h"
 #include "Serialization/SerializationUtility.h"
 #include "Shaders/ShaderManager.h"
 #include "Shaders/ShaderSourceFiles.h"
@@ -8,6 +7,7 @@
 #include <filesystem>
 
 #include "Engine/EngineObjects/LightManager.h"
+#include "Engine/EngineObjects/Simulation.h"
 
 namespace Materials
 {
@@ -81,7 +81,7 @@ namespace Materials
         NormalMap0.Bind();
         NormalMap1.Bind();
 
-        Shaders::Shader::SetUniform(TimeLocation, static_cast<float>(glfwGetTime()));
+        Shaders::Shader::SetUniform(TimeLocation, static_cast<float>(Engine::Simulation::GetTime()));
     }
 
     void WaterMaterial::UseDirectionalShadows() const
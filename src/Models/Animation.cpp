@@ -1,11 +1,28 @@
 #include "Bone.h"
 #include "Animation.h"
+#include <format>
+#include <fstream>
+#include "AnimationCompressor.h"
 #include "Utility/AssimpGLMHelpers.h"
+#include "Utility/BinaryStreamUtilities.h"
+#include "Utility/FileException.h"
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
+#include <glm/gtx/matrix_decompose.hpp>
 
 namespace Models
 {
+    namespace
+    {
+        /*smallest possible size of every record of a compressed file, an empty name still stores its length*/
+        constexpr uint64_t MinimumNodeSize = sizeof(uint32_t) + sizeof(glm::mat4) + sizeof(int);
+        constexpr uint64_t MinimumBoneInfoSize = sizeof(uint32_t) + sizeof(int) + sizeof(glm::mat4);
+        constexpr uint64_t MinimumCompressedBoneSize = sizeof(uint32_t) + sizeof(int) + 2 * sizeof(float) +
+                                                       4 * sizeof(glm::vec3) + 6 * sizeof(uint32_t);
+        /*deeper hierarchies are treated as corrupted instead of exhausting the stack*/
+        constexpr int MaxHierarchyDepth = 256;
+    }
+
     Animation::Animation(const std::string& animationPath, ModelAnimated* model)
     {
         Assimp::Importer importer;
@@ -18,8 +35,67 @@ namespace Models
         globalTransformation = globalTransformation.Inverse();
         ReadHierarchyData(m_RootNode, scene->mRootNode);
         ReadMissingBones(animation, *model);
+        FlattenHierarchy(m_RootNode, -1);
         Path = animationPath;
     }
+
+    Animation::Animation(const std::string& compressedPath)
+    {
+        std::ifstream stream(compressedPath, std::ios::binary);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        Utility::ReadBinary(stream, magic);
+        Utility::ReadBinary(stream, version);
+        if (!stream || magic != AnimationCompressor::FileMagic || version != AnimationCompressor::FileVersion)
+        {
+            throw Utility::FileException(std::format("Failed to read compressed animation from {}.", compressedPath));
+        }
+
+        float ticksPerSecond;
+        Utility::ReadBinary(stream, m_Duration);
+        Utility::ReadBinary(stream, ticksPerSecond);
+        m_TicksPerSecond = static_cast<int>(ticksPerSecond);
+        ReadHierarchyData(m_RootNode, stream, 0);
+
+        // Counts come from the file, they're checked against its size before anything is allocated for them.
+        uint32_t boneInfoCount = 0;
+        Utility::ReadBinary(stream, boneInfoCount);
+        if (Utility::CheckRemaining(stream, boneInfoCount, MinimumBoneInfoSize))
+        {
+            for (uint32_t i = 0; i < boneInfoCount && stream; ++i)
+            {
+                std::string name;
+                BoneInfo info;
+                Utility::ReadBinary(stream, name);
+                Utility::ReadBinary(stream, info.id);
+                Utility::ReadBinary(stream, info.offset);
+                m_BoneInfoMap[name] = info;
+            }
+        }
+
+        uint32_t boneCount = 0;
+        Utility::ReadBinary(stream, boneCount);
+        if (Utility::CheckRemaining(stream, boneCount, MinimumCompressedBoneSize))
+        {
+            m_CompressedBones.resize(boneCount);
+            for (CompressedBone& bone : m_CompressedBones)
+            {
+                if (!bone.Read(stream))
+                {
+                    stream.setstate(std::ios::failbit);
+                    break;
+                }
+            }
+        }
+        if (!stream || !(m_Duration > 0.0f))
+        {
+            throw Utility::FileException(std::format("Failed to read compressed animation from {}.", compressedPath));
+        }
+
+        FlattenHierarchy(m_RootNode, -1);
+        Path = compressedPath;
+    }
+
     Bone* Animation::FindBone(const std::string& name)
     {
         auto iter = std::find_if(m_Bones.begin(), m_Bones.end(),
@@ -30,6 +106,45 @@ namespace Models
             return &(*iter);
     }
 
+    int Animation::FindBoneIndex(const std::string& name) const
+    {
+        for (int i = 0; i < m_Bones.size(); ++i)
+        {
+            if (m_Bones[i].GetBoneName() == name)
+                return i;
+        }
+        for (int i = 0; i < m_CompressedBones.size(); ++i)
+        {
+            if (m_CompressedBones[i].GetBoneName() == name)
+                return i;
+        }
+        return -1;
+    }
+
+    size_t Animation::GetMemoryUsage() const
+    {
+        size_t result = 0;
+        for (const Bone& bone : m_Bones)
+        {
+            result += bone.GetMemoryUsage();
+        }
+        for (const CompressedBone& bone : m_CompressedBones)
+        {
+            result += bone.GetMemoryUsage();
+        }
+        return result;
+    }
+
+    int Animation::FindNodeIndex(const std::string& name) const
+    {
+        for (int i = 0; i < m_Nodes.size(); ++i)
+        {
+            if (m_Nodes[i].name == name)
+                return i;
+        }
+        return -1;
+    }
+
     void Animation::ReadMissingBones(const aiAnimation* animation, ModelAnimated& model)
     {
         int size = animation->mNumChannels;
@@ -71,7 +186,47 @@ namespace Models
         }
     }
 
+    void Animation::ReadHierarchyData(AssimpNodeData& dest, std::istream& src, int depth)
+    {
+        Utility::ReadBinary(src, dest.name);
+        Utility::ReadBinary(src, dest.transformation);
+        Utility::ReadBinary(src, dest.childrenCount);
+        if (dest.childrenCount < 0 || depth >= MaxHierarchyDepth)
+        {
+            src.setstate(std::ios::failbit);
+        }
 
+        const bool valid = Utility::CheckRemaining(src, dest.childrenCount, MinimumNodeSize);
+        dest.children.resize(valid ? dest.childrenCount : 0);
+        for (AssimpNodeData& child : dest.children)
+        {
+            ReadHierarchyData(child, src, depth + 1);
+        }
+    }
 
+    void Animation::FlattenHierarchy(const AssimpNodeData& node, int parent)
+    {
+        AnimationNode flat;
+        flat.name = node.name;
+        flat.parent = parent;
+        flat.bone = FindBoneIndex(node.name);
+        flat.boneId = -1;
+        flat.offset = glm::mat4(1.0f);
+        if (const auto iterator = m_BoneInfoMap.find(node.name); iterator != m_BoneInfoMap.end())
+        {
+            flat.boneId = iterator->second.id;
+            flat.offset = iterator->second.offset;
+        }
 
-} 
+        glm::vec3 skew;
+        glm::vec4 perspective;
+        glm::decompose(node.transformation, flat.bindPose.scale, flat.bindPose.orientation, flat.bindPose.position,
+                       skew, perspective);
+
+        const int index = static_cast<int>(m_Nodes.size());
+        m_Nodes.push_back(flat);
+
+        for (int i = 0; i < node.childrenCount; i++)
+            FlattenHierarchy(node.children[i], index);
+    }
+}
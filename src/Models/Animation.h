@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cassert>
 #include <glm/glm.hpp>
 #include "Bone.h"
+#include "CompressedBone.h"
 #include "ModelAnimated.h"
 #include <map>
 #include <assimp/scene.h>
@@ -15,37 +17,117 @@ namespace Models
         std::vector<AssimpNodeData> children;
     };
 
+    /**
+     * @brief Node of the hierarchy flattened so that every parent precedes its children.
+     */
+    struct AnimationNode
+    {
+        std::string name;
+        /*index of the parent in the flattened hierarchy, -1 for the root*/
+        int parent;
+        /*index in m_Bones, -1 if this node is not animated by this clip*/
+        int bone;
+        /*index in finalBoneMatrices, -1 if this node does not deform any vertex*/
+        int boneId;
+        glm::mat4 offset;
+        /*decomposed node transformation, used when the node has no keys*/
+        BonePose bindPose;
+    };
+
     class Animation
     {
     private:
         float m_Duration;
         int m_TicksPerSecond;
         std::vector<Bone> m_Bones;
+        /*used instead of m_Bones when the clip was loaded from a compressed file*/
+        std::vector<CompressedBone> m_CompressedBones;
         AssimpNodeData m_RootNode;
         std::map<std::string, BoneInfo> m_BoneInfoMap;
+        std::vector<AnimationNode> m_Nodes;
         std::string Path;
 
     public:
         Animation() = default;
         Animation(const std::string& animationPath, ModelAnimated* model);
 
+        /**
+         * @brief Loads a clip written by AnimationCompressor. Bone ids and offsets are stored in the file.
+         * @param compressedPath Path to the .anim file.
+         */
+        explicit Animation(const std::string& compressedPath);
+
         ~Animation() = default;
 
         Bone* FindBone(const std::string& name);
 
-        inline float GetTicksPerSecond() { return m_TicksPerSecond; }
+        /**
+         * @brief Finds index of a bone in this clip.
+         * @param name Name of the bone.
+         * @return Index of the bone or -1 if this clip has no keys for it.
+         */
+        int FindBoneIndex(const std::string& name) const;
+
+        /**
+         * @brief Returns keys of a bone of an uncompressed clip. Compressed clips have no Bones, use SampleBone.
+         * @param index Index of the bone in this clip.
+         */
+        inline const Bone& GetBone(int index) const
+        {
+            assert(!IsCompressed() && index >= 0 && index < m_Bones.size());
+            return m_Bones[index];
+        }
+
+        inline int GetBoneCount() const
+        {
+            return static_cast<int>(IsCompressed() ? m_CompressedBones.size() : m_Bones.size());
+        }
+
+        inline bool IsCompressed() const { return !m_CompressedBones.empty(); }
+
+        /**
+         * @brief Samples a bone regardless of whether this clip is compressed.
+         * @param index Index of the bone in this clip.
+         * @param animationTime Time in ticks.
+         * @return Local pose of the bone.
+         */
+        inline BonePose SampleBone(int index, float animationTime) const
+        {
+            return IsCompressed() ? m_CompressedBones[index].Sample(animationTime) : m_Bones[index].Sample(animationTime);
+        }
+
+        /**
+         * @brief Returns number of bytes used by keys of this clip.
+         */
+        size_t GetMemoryUsage() const;
+
+        /**
+         * @brief Returns node hierarchy flattened in parent before child order.
+         */
+        inline const std::vector<AnimationNode>& GetNodes() const { return m_Nodes; }
+
+        /**
+         * @brief Finds index of a node in the flattened hierarchy.
+         * @param name Name of the node.
+         * @return Index of the node or -1 if not found.
+         */
+        int FindNodeIndex(const std::string& name) const;
+
+        inline float GetTicksPerSecond() const { return m_TicksPerSecond; }
 
-        inline float GetDuration() { return m_Duration; }
+        inline float GetDuration() const { return m_Duration; }
 
-        inline const AssimpNodeData& GetRootNode() { return m_RootNode; }
+        inline const AssimpNodeData& GetRootNode() const { return m_RootNode; }
 
-        inline const std::map<std::string, BoneInfo>& GetBoneIDMap() { return m_BoneInfoMap; }
+        inline const std::map<std::string, BoneInfo>& GetBoneIDMap() const { return m_BoneInfoMap; }
 
         [[nodiscard]] std::string GetPath() const { return Path; }
 
     private:
         void ReadMissingBones(const aiAnimation* animation, ModelAnimated& model);
         void ReadHierarchyData(AssimpNodeData& dest, const aiNode* src);
+        void ReadHierarchyData(AssimpNodeData& dest, std::istream& src, int depth);
+        void FlattenHierarchy(const AssimpNodeData& node, int parent);
 
 
 
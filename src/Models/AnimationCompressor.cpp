@@ -0,0 +1,195 @@
+#include "AnimationCompressor.h"
+#include <cmath>
+#include <fstream>
+#include <spdlog/spdlog.h>
+#include "Animation.h"
+#include "Utility/BinaryStreamUtilities.h"
+
+namespace Models
+{
+    namespace
+    {
+        float PositionError(const glm::vec3& a, const glm::vec3& b)
+        {
+            return glm::distance(a, b);
+        }
+
+        float RotationError(const glm::quat& a, const glm::quat& b)
+        {
+            return 2.0f * std::acos(glm::min(1.0f, std::abs(glm::dot(glm::normalize(a), glm::normalize(b)))));
+        }
+
+        glm::quat Nlerp(const glm::quat& from, const glm::quat& to, float weight)
+        {
+            const glm::quat target = glm::dot(from, to) < 0.0f ? -to : to;
+            return glm::normalize(from * (1.0f - weight) + target * weight);
+        }
+
+        /*greedily extends a segment from the last kept key for as long as
+        every skipped key can be reconstructed within tolerance*/
+        template<typename TKey, typename TGetter, typename TInterpolate, typename TError>
+        std::vector<TKey> RemoveRedundantKeys(const std::vector<TKey>& keys, float tolerance, TGetter getter,
+                                              TInterpolate interpolate, TError error)
+        {
+            bool constant = true;
+            for (size_t i = 1; i < keys.size() && constant; ++i)
+            {
+                constant = error(getter(keys[0]), getter(keys[i])) <= tolerance;
+            }
+            if (constant)
+            {
+                return keys.empty() ? keys : std::vector<TKey>{keys[0]};
+            }
+
+            std::vector<TKey> result;
+            result.push_back(keys[0]);
+            size_t anchor = 0;
+            for (size_t candidate = 2; candidate < keys.size(); ++candidate)
+            {
+                const float length = keys[candidate].timeStamp - keys[anchor].timeStamp;
+                bool redundant = length > 0.0f;
+                for (size_t i = anchor + 1; i < candidate && redundant; ++i)
+                {
+                    const float weight = (keys[i].timeStamp - keys[anchor].timeStamp) / length;
+                    const auto reconstructed = interpolate(getter(keys[anchor]), getter(keys[candidate]), weight);
+                    redundant = error(reconstructed, getter(keys[i])) <= tolerance;
+                }
+                if (!redundant)
+                {
+                    anchor = candidate - 1;
+                    result.push_back(keys[anchor]);
+                }
+            }
+            result.push_back(keys.back());
+            return result;
+        }
+
+        template<typename TKey, typename TGetter, typename TError>
+        void CollapseConstantTrack(std::vector<TKey>& keys, float tolerance, TGetter getter, TError error)
+        {
+            for (size_t i = 1; i < keys.size(); ++i)
+            {
+                if (error(getter(keys[0]), getter(keys[i])) > tolerance)
+                    return;
+            }
+            if (!keys.empty())
+                keys.resize(1);
+        }
+
+        void WriteNode(std::ostream& stream, const AssimpNodeData& node)
+        {
+            Utility::WriteBinary(stream, node.name);
+            Utility::WriteBinary(stream, node.transformation);
+            Utility::WriteBinary(stream, node.childrenCount);
+            for (const AssimpNodeData& child : node.children)
+            {
+                WriteNode(stream, child);
+            }
+        }
+    }
+
+    std::vector<CompressedBone> AnimationCompressor::CompressBones(const Animation& Animation,
+                                                                   const AnimationCompressionSettings& Settings)
+    {
+        const auto getPosition = [](const KeyPosition& key) { return key.position; };
+        const auto getRotation = [](const KeyRotation& key) { return key.orientation; };
+        const auto getScale = [](const KeyScale& key) { return key.scale; };
+        const auto mix = [](const glm::vec3& a, const glm::vec3& b, float weight) { return glm::mix(a, b, weight); };
+
+        const float duration = Animation.GetDuration();
+        float sampleInterval = 0.0f;
+        int sampleCount = 0;
+        if (Settings.sampleRate > 0.0f && duration > 0.0f)
+        {
+            const float desiredInterval = Animation.GetTicksPerSecond() / Settings.sampleRate;
+            sampleCount = glm::max(2, static_cast<int>(std::ceil(duration / desiredInterval)) + 1);
+            sampleInterval = duration / static_cast<float>(sampleCount - 1);
+        }
+
+        std::vector<CompressedBone> result;
+        if (Animation.IsCompressed())
+        {
+            return result;
+        }
+        result.reserve(Animation.GetBoneCount());
+        for (int i = 0; i < Animation.GetBoneCount(); ++i)
+        {
+            const Bone& bone = Animation.GetBone(i);
+            std::vector<KeyPosition> positions;
+            std::vector<KeyRotation> rotations;
+            std::vector<KeyScale> scales;
+
+            if (sampleCount > 0)
+            {
+                for (int sample = 0; sample < sampleCount; ++sample)
+                {
+                    const float time = sample * sampleInterval;
+                    const BonePose pose = bone.Sample(time);
+                    positions.push_back({pose.position, time});
+                    rotations.push_back({pose.orientation, time});
+                    scales.push_back({pose.scale, time});
+                }
+                CollapseConstantTrack(positions, Settings.positionTolerance, getPosition, PositionError);
+                CollapseConstantTrack(rotations, Settings.rotationTolerance, getRotation, RotationError);
+                CollapseConstantTrack(scales, Settings.scaleTolerance, getScale, PositionError);
+            }
+            else
+            {
+                positions = RemoveRedundantKeys(bone.GetPositionKeys(), Settings.positionTolerance, getPosition, mix,
+                                                PositionError);
+                rotations = RemoveRedundantKeys(bone.GetRotationKeys(), Settings.rotationTolerance, getRotation, Nlerp,
+                                                RotationError);
+                scales = RemoveRedundantKeys(bone.GetScaleKeys(), Settings.scaleTolerance, getScale, mix,
+                                             PositionError);
+            }
+
+            result.emplace_back(bone.GetBoneName(), bone.GetBoneID(), duration, sampleInterval, positions, rotations,
+                                scales);
+        }
+        return result;
+    }
+
+    bool AnimationCompressor::CompressToFile(const Animation& Animation, const std::string& OutputPath,
+                                             const AnimationCompressionSettings& Settings)
+    {
+        if (Animation.IsCompressed())
+        {
+            spdlog::warn("Animation {0} is already compressed.", Animation.GetPath());
+            return false;
+        }
+
+        const std::vector<CompressedBone> bones = CompressBones(Animation, Settings);
+
+        std::ofstream stream(OutputPath, std::ios::binary);
+        if (!stream)
+        {
+            spdlog::error("Failed to open {0} for writing.", OutputPath);
+            return false;
+        }
+
+        Utility::WriteBinary(stream, FileMagic);
+        Utility::WriteBinary(stream, FileVersion);
+        Utility::WriteBinary(stream, Animation.GetDuration());
+        Utility::WriteBinary(stream, Animation.GetTicksPerSecond());
+        WriteNode(stream, Animation.GetRootNode());
+        Utility::WriteBinary(stream, static_cast<uint32_t>(Animation.GetBoneIDMap().size()));
+        for (const auto& [name, info] : Animation.GetBoneIDMap())
+        {
+            Utility::WriteBinary(stream, name);
+            Utility::WriteBinary(stream, info.id);
+            Utility::WriteBinary(stream, info.offset);
+        }
+        Utility::WriteBinary(stream, static_cast<uint32_t>(bones.size()));
+
+        size_t compressedSize = 0;
+        for (const CompressedBone& bone : bones)
+        {
+            bone.Write(stream);
+            compressedSize += bone.GetMemoryUsage();
+        }
+
+        spdlog::info("Compressed animation {0} to {1}: {2} -> {3} bytes of keys.", Animation.GetPath(), OutputPath,
+                     Animation.GetMemoryUsage(), compressedSize);
+        return static_cast<bool>(stream);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CompressedBone.h"
+
+namespace Models
+{
+    class Animation;
+
+    struct AnimationCompressionSettings
+    {
+        /*maximum distance between original and reconstructed position*/
+        float positionTolerance = 0.0005f;
+        /*maximum angle in radians between original and reconstructed rotation*/
+        float rotationTolerance = 0.001f;
+        /*maximum distance between original and reconstructed scale*/
+        float scaleTolerance = 0.0005f;
+        /*samples per second, 0 keeps source key times and removes redundant keys instead*/
+        float sampleRate = 0.0f;
+    };
+
+    /**
+     * @brief Converts imported clips into compact .anim files loaded by ModelManager::GetAnimation.
+     */
+    class AnimationCompressor final
+    {
+    public:
+        static constexpr uint32_t FileMagic = 0x4D4E4154; // "TANM"
+        /*version 2 stores bone ids and offsets, so loading doesn't need the source model*/
+        static constexpr uint32_t FileVersion = 2;
+        static constexpr const char* FileExtension = ".anim";
+
+    private:
+        AnimationCompressor() = default;
+
+    public:
+        /**
+         * @brief Reduces and quantizes keys of every bone of an animation.
+         * @param Animation Uncompressed animation.
+         * @param Settings Compression tolerances.
+         * @return Compressed bones in the same order as bones of the animation.
+         */
+        static std::vector<CompressedBone> CompressBones(const Animation& Animation,
+                                                         const AnimationCompressionSettings& Settings);
+
+        /**
+         * @brief Compresses an animation and writes it to a file.
+         * @param Animation Uncompressed animation.
+         * @param OutputPath Destination .anim file.
+         * @param Settings Compression tolerances.
+         * @return True if file was written, false otherwise.
+         */
+        static bool CompressToFile(const Animation& Animation, const std::string& OutputPath,
+                                   const AnimationCompressionSettings& Settings = AnimationCompressionSettings());
+    };
+}
@@ -1,63 +1,447 @@
 #include "Animator.h"
+#include <cmath>
 #include <spdlog/spdlog.h>
 #include <glm/glm.hpp>
-#include <glm/gtx/string_cast.hpp> // Required for glm::to_string()
+#include <glm/gtx/quaternion.hpp>
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    glm::quat Nlerp(const glm::quat& from, glm::quat to, const float weight)
+    {
+        if (glm::dot(from, to) < 0.0f)
+            to = -to;
+        return glm::normalize(from * (1.0f - weight) + to * weight);
+    }
+
+    Models::BonePose Blend(const Models::BonePose& from, const Models::BonePose& to, const float weight)
+    {
+        Models::BonePose result;
+        result.position = glm::mix(from.position, to.position, weight);
+        result.orientation = Nlerp(from.orientation, to.orientation, weight);
+        result.scale = glm::mix(from.scale, to.scale, weight);
+        return result;
+    }
+
+    Models::BonePose AddDifference(const Models::BonePose& base, const Models::BonePose& pose,
+                                   const Models::BonePose& reference, const float weight)
+    {
+        const glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+        const glm::quat difference = pose.orientation * glm::inverse(reference.orientation);
+
+        Models::BonePose result;
+        result.position = base.position + (pose.position - reference.position) * weight;
+        result.orientation = glm::normalize(Nlerp(identity, difference, weight) * base.orientation);
+        result.scale = base.scale * glm::mix(glm::vec3(1.0f), pose.scale / reference.scale, weight);
+        return result;
+    }
+
+    glm::mat4 ToMatrix(const Models::BonePose& pose)
+    {
+        // Equivalent of translate * rotate * scale without the intermediate matrix products.
+        glm::mat4 result = glm::toMat4(pose.orientation);
+        result[0] *= pose.scale.x;
+        result[1] *= pose.scale.y;
+        result[2] *= pose.scale.z;
+        result[3] = glm::vec4(pose.position, 1.0f);
+        return result;
+    }
+}
+
 namespace Models
 {
     Animator::Animator(Animation* Animation)
     {
         m_CurrentTime = 0.0;
         m_CurrentAnimation = Animation;
+        if (Animation)
+        {
+            SetSkeleton(Animation);
+            m_CurrentBinding = BindClip(Animation);
+        }
+    }
 
-        size_t boneCount = Animation->GetBoneIDMap().size();
-        m_FinalBoneMatrices.resize(boneCount, glm::mat4(1.0f));
+    void Animator::UpdateAnimation(float dt)
+    {
+        ZoneScoped;
+        if (!m_Skeleton || (!m_CurrentAnimation && !m_UseBlendTree))
+        {
+            return;
+        }
 
+        AdvancePlayback(dt);
 
-        m_FinalBoneMatrices.assign(boneCount, glm::mat4(1.0f));
+        if (m_UpdateInterval <= 1)
+        {
+            EvaluatePose();
+            CalculateBoneTransforms(m_Pose);
+            m_HasDisplayPose = false;
+            return;
+        }
 
+        ++m_FramesSinceEvaluation;
+        if (!m_HasDisplayPose)
+        {
+            EvaluatePose();
+            m_LodFromPose = m_Pose;
+            m_FramesSinceEvaluation = 0;
+            m_HasDisplayPose = true;
+        }
+        else if (m_FramesSinceEvaluation >= m_UpdateInterval)
+        {
+            m_LodFromPose = m_DisplayPose;
+            EvaluatePose();
+            m_FramesSinceEvaluation = 0;
+        }
+
+        // Interpolating towards the latest evaluated pose trails the animation by one interval but keeps motion smooth.
+        const float weight = glm::min(static_cast<float>(m_FramesSinceEvaluation + 1) / m_UpdateInterval, 1.0f);
+        for (int i = 0; i < m_Pose.size(); ++i)
+        {
+            m_DisplayPose[i] = weight >= 1.0f ? m_Pose[i] : Blend(m_LodFromPose[i], m_Pose[i], weight);
+        }
+        CalculateBoneTransforms(m_DisplayPose);
     }
-    void Animator::UpdateAnimation(float dt)
+
+    void Animator::AdvanceTime(float dt)
+    {
+        AdvancePlayback(dt);
+
+        // Pose is stale after being skipped, next update starts from a freshly evaluated one.
+        m_HasDisplayPose = false;
+    }
+
+    void Animator::AdvancePlayback(float dt)
     {
         m_DeltaTime = dt;
-        if (m_CurrentAnimation)
+        if (m_UseBlendTree)
+        {
+            m_BlendTree.Advance(dt);
+        }
+        else if (m_CurrentAnimation)
+        {
+            m_CurrentTime = AdvanceClipTime(m_CurrentAnimation, m_CurrentTime, dt);
+        }
+
+        if (IsCrossFading())
         {
-            m_CurrentTime += m_CurrentAnimation->GetTicksPerSecond() * dt;
-            m_CurrentTime = fmod(m_CurrentTime, m_CurrentAnimation->GetDuration());
-            CalculateBoneTransform(&m_CurrentAnimation->GetRootNode(), glm::mat4(1.0f));
+            m_FadeElapsed += dt;
+            if (m_PreviousAnimation)
+            {
+                m_PreviousTime = AdvanceClipTime(m_PreviousAnimation, m_PreviousTime, dt);
+            }
+            if (!IsCrossFading())
+            {
+                m_PreviousAnimation = nullptr;
+            }
+        }
+
+        for (AnimationLayer& layer : m_Layers)
+        {
+            layer.time = AdvanceClipTime(layer.animation, layer.time, dt);
         }
     }
+
     void Animator::PlayAnimation(Animation* pAnimation)
     {
         m_CurrentAnimation = pAnimation;
         m_CurrentTime = 0.0f;
+        m_UseBlendTree = false;
+        m_PreviousAnimation = nullptr;
+        m_FadeDuration = 0.0f;
+        m_FadeElapsed = 0.0f;
+        if (!m_Skeleton && pAnimation)
+        {
+            SetSkeleton(pAnimation);
+        }
+        m_CurrentBinding = pAnimation ? BindClip(pAnimation) : -1;
     }
-    void Animator::CalculateBoneTransform(const AssimpNodeData* node, glm::mat4 parentTransform)
+
+    void Animator::CrossFade(Animation* pAnimation, float duration)
     {
-        std::string nodeName = node->name;
-        glm::mat4 nodeTransform = node->transformation;
+        if (!m_Skeleton || pAnimation == nullptr)
+        {
+            PlayAnimation(pAnimation);
+            return;
+        }
+        if (pAnimation == m_CurrentAnimation && !m_UseBlendTree)
+        {
+            return;
+        }
 
-        Bone* Bone = m_CurrentAnimation->FindBone(nodeName);
+        BeginFade(duration);
+        m_CurrentAnimation = pAnimation;
+        m_CurrentTime = 0.0f;
+        m_UseBlendTree = false;
+        m_CurrentBinding = BindClip(pAnimation);
+    }
 
-        if (Bone)
+    void Animator::PlayBlendTree(const BlendTree& tree, float duration)
+    {
+        if (!m_Skeleton && !tree.GetMotions().empty())
         {
-            Bone->Update(m_CurrentTime);
-            nodeTransform = Bone->GetLocalTransform();
+            SetSkeleton(tree.GetMotions()[0].animation);
         }
 
+        BeginFade(duration);
+        m_BlendTree = tree;
+        m_UseBlendTree = true;
+        m_CurrentAnimation = nullptr;
+        m_CurrentBinding = -1;
+        m_MotionBindings.clear();
+        for (const BlendTree::Motion& motion : m_BlendTree.GetMotions())
+        {
+            m_MotionBindings.push_back(BindClip(motion.animation));
+        }
+    }
 
-        glm::mat4 globalTransformation = parentTransform * nodeTransform;
+    AnimationLayerId Animator::AddLayer(Animation* animation, AnimationLayerMode mode, float weight,
+                                        const BoneMask& mask)
+    {
+        if (!m_Skeleton)
+        {
+            SetSkeleton(animation);
+        }
 
-        auto boneInfoMap = m_CurrentAnimation->GetBoneIDMap();
-        if (boneInfoMap.find(nodeName) != boneInfoMap.end())
+        AnimationLayer layer;
+        layer.id = m_NextLayerId++;
+        layer.animation = animation;
+        layer.binding = BindClip(animation);
+        layer.mode = mode;
+        layer.weight = weight;
+        layer.mask = mask;
+        if (mode == AnimationLayerMode::Additive)
         {
-            int index = boneInfoMap[nodeName].id;
-            glm::mat4 offset = boneInfoMap[nodeName].offset;
-            m_FinalBoneMatrices[index] = offset * globalTransformation;
+            layer.referencePose.resize(m_Skeleton->GetNodes().size());
+            SampleAnimation(animation, layer.binding, 0.0f, layer.referencePose);
         }
+        m_Layers.push_back(std::move(layer));
+        return m_Layers.back().id;
+    }
 
-        for (int i = 0; i < node->childrenCount; i++)
-            CalculateBoneTransform(&node->children[i], globalTransformation);
+    void Animator::RemoveLayer(AnimationLayerId id)
+    {
+        std::erase_if(m_Layers, [id](const AnimationLayer& layer) { return layer.id == id; });
     }
-}
 
+    void Animator::SetLayerWeight(AnimationLayerId id, float weight)
+    {
+        if (AnimationLayer* layer = FindLayer(id))
+        {
+            layer->weight = weight;
+        }
+    }
+
+    const AnimationLayer* Animator::GetLayer(AnimationLayerId id) const
+    {
+        for (const AnimationLayer& layer : m_Layers)
+        {
+            if (layer.id == id)
+            {
+                return &layer;
+            }
+        }
+        return nullptr;
+    }
+
+    AnimationLayer* Animator::FindLayer(AnimationLayerId id)
+    {
+        // Layers are few, a linear search keeps them in evaluation order without an index.
+        for (AnimationLayer& layer : m_Layers)
+        {
+            if (layer.id == id)
+            {
+                return &layer;
+            }
+        }
+        return nullptr;
+    }
+
+    void Animator::SetSkeleton(const Animation* skeleton)
+    {
+        m_Skeleton = skeleton;
+        m_Bindings.clear();
+
+        const size_t nodeCount = skeleton->GetNodes().size();
+        m_Pose.assign(nodeCount, BonePose());
+        m_ScratchPose.assign(nodeCount, BonePose());
+        m_FadePose.assign(nodeCount, BonePose());
+        m_LodFromPose.assign(nodeCount, BonePose());
+        m_DisplayPose.assign(nodeCount, BonePose());
+        m_GlobalTransforms.assign(nodeCount, glm::mat4(1.0f));
+        m_HasDisplayPose = false;
+
+        const std::vector<AnimationNode>& nodes = skeleton->GetNodes();
+        m_NodeHeights.assign(nodeCount, 0);
+        for (int i = static_cast<int>(nodeCount) - 1; i > 0; --i)
+        {
+            const int parent = nodes[i].parent;
+            m_NodeHeights[parent] = glm::max(m_NodeHeights[parent], m_NodeHeights[i] + 1);
+        }
+
+        size_t boneCount = skeleton->GetBoneIDMap().size();
+        m_FinalBoneMatrices.assign(boneCount, glm::mat4(1.0f));
+    }
+
+    int Animator::BindClip(const Animation* animation)
+    {
+        for (int i = 0; i < m_Bindings.size(); ++i)
+        {
+            if (m_Bindings[i].animation == animation)
+            {
+                return i;
+            }
+        }
+
+        const std::vector<AnimationNode>& nodes = m_Skeleton->GetNodes();
+        ClipBinding binding{animation, std::vector<int>(nodes.size())};
+        for (int i = 0; i < nodes.size(); ++i)
+        {
+            binding.bones[i] = animation == m_Skeleton ? nodes[i].bone : animation->FindBoneIndex(nodes[i].name);
+        }
+        m_Bindings.push_back(std::move(binding));
+        return static_cast<int>(m_Bindings.size()) - 1;
+    }
+
+    void Animator::BeginFade(float duration)
+    {
+        m_FadeElapsed = 0.0f;
+        m_FadeDuration = duration;
+        if (duration <= 0.0f)
+        {
+            m_PreviousAnimation = nullptr;
+            return;
+        }
+
+        // Keep the outgoing clip playing when possible, otherwise fade from the last evaluated pose.
+        if (m_CurrentAnimation && !m_UseBlendTree && m_PreviousAnimation == nullptr)
+        {
+            m_PreviousAnimation = m_CurrentAnimation;
+            m_PreviousBinding = m_CurrentBinding;
+            m_PreviousTime = m_CurrentTime;
+            m_FadeFromSnapshot = false;
+        }
+        else
+        {
+            m_FadePose = m_Pose;
+            m_PreviousAnimation = nullptr;
+            m_FadeFromSnapshot = true;
+        }
+    }
+
+    float Animator::AdvanceClipTime(Animation* animation, float time, float dt)
+    {
+        time += animation->GetTicksPerSecond() * dt;
+        return fmod(time, animation->GetDuration());
+    }
+
+    void Animator::EvaluatePose()
+    {
+        if (m_UseBlendTree)
+        {
+            EvaluateBlendTree(m_Pose);
+        }
+        else
+        {
+            SampleAnimation(m_CurrentAnimation, m_CurrentBinding, m_CurrentTime, m_Pose);
+        }
+
+        if (IsCrossFading())
+        {
+            const float weight = glm::clamp(m_FadeElapsed / m_FadeDuration, 0.0f, 1.0f);
+            if (!m_FadeFromSnapshot)
+            {
+                SampleAnimation(m_PreviousAnimation, m_PreviousBinding, m_PreviousTime, m_FadePose);
+            }
+            for (int i = 0; i < m_Pose.size(); ++i)
+            {
+                m_Pose[i] = Blend(m_FadePose[i], m_Pose[i], weight);
+            }
+        }
+
+        for (const AnimationLayer& layer : m_Layers)
+        {
+            if (layer.weight > 0.0f)
+            {
+                ApplyLayer(layer);
+            }
+        }
+    }
+
+    void Animator::SampleAnimation(const Animation* animation, int binding, float time, std::vector<BonePose>& pose)
+    {
+        ZoneScoped;
+        // Clips are bound when they start playing, so evaluation never searches or allocates.
+        const ClipBinding& clipBinding = m_Bindings[binding];
+        const std::vector<AnimationNode>& nodes = m_Skeleton->GetNodes();
+        for (int i = 0; i < nodes.size(); ++i)
+        {
+            const int bone = clipBinding.bones[i];
+            const bool pruned = m_NodeHeights[i] < m_LeafBonePruning;
+            pose[i] = bone >= 0 && !pruned ? animation->SampleBone(bone, time) : nodes[i].bindPose;
+        }
+    }
+
+    void Animator::EvaluateBlendTree(std::vector<BonePose>& pose)
+    {
+        int first, second;
+        float weight;
+        if (!m_BlendTree.GetBlend(first, second, weight))
+        {
+            return;
+        }
+
+        Animation* firstAnimation = m_BlendTree.GetMotions()[first].animation;
+        const float normalizedTime = m_BlendTree.GetNormalizedTime();
+        SampleAnimation(firstAnimation, m_MotionBindings[first], normalizedTime * firstAnimation->GetDuration(), pose);
+        if (first == second || weight <= 0.0f)
+        {
+            return;
+        }
+
+        Animation* secondAnimation = m_BlendTree.GetMotions()[second].animation;
+        SampleAnimation(secondAnimation, m_MotionBindings[second], normalizedTime * secondAnimation->GetDuration(),
+                        m_ScratchPose);
+        for (int i = 0; i < pose.size(); ++i)
+        {
+            pose[i] = Blend(pose[i], m_ScratchPose[i], weight);
+        }
+    }
 
+    void Animator::ApplyLayer(const AnimationLayer& layer)
+    {
+        SampleAnimation(layer.animation, layer.binding, layer.time, m_ScratchPose);
+        for (int i = 0; i < m_Pose.size(); ++i)
+        {
+            const float weight = layer.weight * layer.mask.GetWeight(i);
+            if (weight <= 0.0f)
+            {
+                continue;
+            }
+            if (layer.mode == AnimationLayerMode::Additive)
+            {
+                m_Pose[i] = AddDifference(m_Pose[i], m_ScratchPose[i], layer.referencePose[i], weight);
+            }
+            else
+            {
+                m_Pose[i] = Blend(m_Pose[i], m_ScratchPose[i], weight);
+            }
+        }
+    }
+
+    void Animator::CalculateBoneTransforms(const std::vector<BonePose>& pose)
+    {
+        const std::vector<AnimationNode>& nodes = m_Skeleton->GetNodes();
+        for (int i = 0; i < nodes.size(); ++i)
+        {
+            const AnimationNode& node = nodes[i];
+            const glm::mat4 nodeTransform = ToMatrix(pose[i]);
+            m_GlobalTransforms[i] = node.parent >= 0 ? m_GlobalTransforms[node.parent] * nodeTransform : nodeTransform;
+
+            if (node.boneId >= 0 && node.boneId < m_FinalBoneMatrices.size())
+            {
+                m_FinalBoneMatrices[node.boneId] = node.offset * m_GlobalTransforms[i];
+            }
+        }
+    }
+}
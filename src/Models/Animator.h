@@ -1,26 +1,192 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include "glad/glad.h"
 #include <glm/glm.hpp>
 #include "Models/Animation.h"
+#include "Models/BlendTree.h"
+#include "Models/BoneMask.h"
 
 namespace Models
 {
+    enum class AnimationLayerMode
+    {
+        /*replaces the pose below by the layer's clip*/
+        Override,
+        /*adds difference between the clip and its first frame on top of the pose below*/
+        Additive
+    };
+
+    /**
+     * @brief Identifies a layer of an Animator, stays valid when other layers are removed.
+     */
+    typedef uint32_t AnimationLayerId;
+
+    constexpr AnimationLayerId InvalidAnimationLayerId = 0;
+
+    struct AnimationLayer
+    {
+        AnimationLayerId id = InvalidAnimationLayerId;
+        Animation* animation = nullptr;
+        /*index of the clip's binding in the animator*/
+        int binding = -1;
+        AnimationLayerMode mode = AnimationLayerMode::Override;
+        float weight = 1.0f;
+        float time = 0.0f;
+        BoneMask mask;
+        /*pose of the first frame, additive layers are applied relative to it*/
+        std::vector<BonePose> referencePose;
+    };
+
 	class Animator
 	{
+    private:
+        /*maps nodes of the skeleton to bones of a clip, built once per clip when it starts playing*/
+        struct ClipBinding
+        {
+            const Animation* animation;
+            std::vector<int> bones;
+        };
+
     private:
         std::vector<glm::mat4> m_FinalBoneMatrices;
-        Animation* m_CurrentAnimation;
-        float m_CurrentTime;
-        float m_DeltaTime;	
+        Animation* m_CurrentAnimation = nullptr;
+        int m_CurrentBinding = -1;
+        float m_CurrentTime = 0.0f;
+        float m_DeltaTime = 0.0f;
+
+        /*animation providing node hierarchy, all played clips are expected to share it*/
+        const Animation* m_Skeleton = nullptr;
+        std::vector<ClipBinding> m_Bindings;
+
+        BlendTree m_BlendTree;
+        /*binding of every motion of the blend tree*/
+        std::vector<int> m_MotionBindings;
+        bool m_UseBlendTree = false;
+
+        Animation* m_PreviousAnimation = nullptr;
+        int m_PreviousBinding = -1;
+        float m_PreviousTime = 0.0f;
+        bool m_FadeFromSnapshot = false;
+        float m_FadeDuration = 0.0f;
+        float m_FadeElapsed = 0.0f;
+
+        std::vector<AnimationLayer> m_Layers;
+        AnimationLayerId m_NextLayerId = 1;
+
+        /*level of detail, poses are evaluated every m_UpdateInterval frames and interpolated in between*/
+        int m_UpdateInterval = 1;
+        int m_FramesSinceEvaluation = 0;
+        bool m_HasDisplayPose = false;
+        int m_LeafBonePruning = 0;
+        /*distance from a node to its deepest descendant, 0 for leaves*/
+        std::vector<int> m_NodeHeights;
+
+        std::vector<BonePose> m_Pose;
+        std::vector<BonePose> m_ScratchPose;
+        std::vector<BonePose> m_FadePose;
+        std::vector<BonePose> m_LodFromPose;
+        std::vector<BonePose> m_DisplayPose;
+        std::vector<glm::mat4> m_GlobalTransforms;
+
     public:
         Animator() = default;
         Animator(Animation* Animation);
         ~Animator() = default;
+
+        /**
+         * @brief Advances playback and evaluates bone matrices.
+         * @param dt Time since last frame in seconds.
+         */
         void UpdateAnimation(float dt);
+
+        /**
+         * @brief Advances playback without evaluating the pose. Used for animators that are not visible.
+         * @param dt Time since last frame in seconds.
+         */
+        void AdvanceTime(float dt);
+
+        /**
+         * @brief Sets how often the pose is evaluated. Frames in between interpolate between evaluated poses.
+         * @param frames Number of frames between evaluations, 1 evaluates every frame.
+         */
+        void SetUpdateInterval(int frames) { m_UpdateInterval = frames > 1 ? frames : 1; }
+
+        [[nodiscard]] int GetUpdateInterval() const { return m_UpdateInterval; }
+
+        /**
+         * @brief Stops sampling keys for bones close to the ends of the hierarchy, they are kept in bind pose instead.
+         * @param levels Number of levels counted from leaves to be pruned, 0 disables pruning.
+         */
+        void SetLeafBonePruning(int levels) { m_LeafBonePruning = levels; }
+
+        /**
+         * @brief Switches to a clip immediately.
+         * @param pAnimation Clip to be played.
+         */
         void PlayAnimation(Animation* pAnimation);
-        void CalculateBoneTransform(const AssimpNodeData* node, glm::mat4 parentTransform);
-        std::vector<glm::mat4> GetFinalBoneMatrices() const { return m_FinalBoneMatrices; }
+
+        /**
+         * @brief Switches to a clip, blending from the current pose over a given time.
+         * @param pAnimation Clip to be played.
+         * @param duration Duration of the transition in seconds.
+         */
+        void CrossFade(Animation* pAnimation, float duration);
+
+        /**
+         * @brief Plays a blend tree as the base layer. The tree is copied, use GetBlendTree() to drive it.
+         * @param tree Blend tree to be played.
+         * @param duration Duration of the transition in seconds.
+         */
+        void PlayBlendTree(const BlendTree& tree, float duration = 0.0f);
+
+        [[nodiscard]] BlendTree* GetBlendTree() { return m_UseBlendTree ? &m_BlendTree : nullptr; }
+
+        /**
+         * @brief Adds a layer evaluated on top of the base clip.
+         * @param animation Clip played by the layer.
+         * @param mode How the layer is combined with layers below.
+         * @param weight Weight of the layer.
+         * @param mask Nodes affected by the layer.
+         * @return Id of the layer, layers are evaluated in order of adding.
+         */
+        AnimationLayerId AddLayer(Animation* animation, AnimationLayerMode mode, float weight = 1.0f,
+                                  const BoneMask& mask = BoneMask());
+
+        /**
+         * @brief Removes a layer, ids of other layers stay valid. Removing an unknown id has no effect.
+         * @param id Id returned by AddLayer.
+         */
+        void RemoveLayer(AnimationLayerId id);
+
+        void SetLayerWeight(AnimationLayerId id, float weight);
+
+        /**
+         * @brief Returns a layer or nullptr if it was removed.
+         * @param id Id returned by AddLayer.
+         */
+        [[nodiscard]] const AnimationLayer* GetLayer(AnimationLayerId id) const;
+
+        [[nodiscard]] int GetLayerCount() const { return static_cast<int>(m_Layers.size()); }
+
+        [[nodiscard]] Animation* GetCurrentAnimation() const { return m_CurrentAnimation; }
+
+        [[nodiscard]] bool IsCrossFading() const { return m_FadeElapsed < m_FadeDuration; }
+
+        [[nodiscard]] const std::vector<glm::mat4>& GetFinalBoneMatrices() const { return m_FinalBoneMatrices; }
+
+    private:
+        void SetSkeleton(const Animation* skeleton);
+        int BindClip(const Animation* animation);
+        AnimationLayer* FindLayer(AnimationLayerId id);
+        void BeginFade(float duration);
+        void AdvancePlayback(float dt);
+        static float AdvanceClipTime(Animation* animation, float time, float dt);
+        void EvaluatePose();
+        void SampleAnimation(const Animation* animation, int binding, float time, std::vector<BonePose>& pose);
+        void EvaluateBlendTree(std::vector<BonePose>& pose);
+        void ApplyLayer(const AnimationLayer& layer);
+        void CalculateBoneTransforms(const std::vector<BonePose>& pose);
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,66 @@
+#include "BlendTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include "Animation.h"
+
+namespace Models
+{
+    void BlendTree::AddMotion(Animation* animation, float threshold)
+    {
+        const auto position = std::ranges::upper_bound(m_Motions, threshold, {}, &Motion::threshold);
+        m_Motions.insert(position, Motion{animation, threshold});
+    }
+
+    void BlendTree::Advance(float dt)
+    {
+        int first, second;
+        float weight;
+        if (!GetBlend(first, second, weight))
+            return;
+
+        const float duration = glm::mix(GetDurationSeconds(m_Motions[first].animation),
+                                        GetDurationSeconds(m_Motions[second].animation), weight);
+        if (duration <= 0.0f)
+            return;
+
+        m_NormalizedTime += dt / duration;
+        m_NormalizedTime -= std::floor(m_NormalizedTime);
+    }
+
+    bool BlendTree::GetBlend(int& first, int& second, float& weight) const
+    {
+        if (m_Motions.empty())
+            return false;
+
+        const int last = static_cast<int>(m_Motions.size()) - 1;
+        if (m_Parameter <= m_Motions[0].threshold)
+        {
+            first = second = 0;
+            weight = 0.0f;
+            return true;
+        }
+        if (m_Parameter >= m_Motions[last].threshold)
+        {
+            first = second = last;
+            weight = 0.0f;
+            return true;
+        }
+
+        second = 1;
+        while (m_Motions[second].threshold < m_Parameter)
+            ++second;
+        first = second - 1;
+
+        const float range = m_Motions[second].threshold - m_Motions[first].threshold;
+        weight = range > 0.0f ? (m_Parameter - m_Motions[first].threshold) / range : 0.0f;
+        return true;
+    }
+
+    float BlendTree::GetDurationSeconds(Animation* animation)
+    {
+        const float ticksPerSecond = animation->GetTicksPerSecond();
+        return ticksPerSecond > 0.0f ? animation->GetDuration() / ticksPerSecond : animation->GetDuration();
+    }
+}
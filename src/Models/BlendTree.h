@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+namespace Models
+{
+    class Animation;
+
+    /**
+     * @brief One dimensional blend tree. Blends two neighbouring motions selected by a parameter,
+     * e.g. idle, walk and run selected by movement speed.
+     */
+    class BlendTree
+    {
+    public:
+        struct Motion
+        {
+            Animation* animation;
+            float threshold;
+        };
+
+    private:
+        std::vector<Motion> m_Motions;
+        float m_Parameter = 0.0f;
+        float m_NormalizedTime = 0.0f;
+
+    public:
+        BlendTree() = default;
+
+    public:
+        /**
+         * @brief Adds a new motion. Motions are kept sorted by threshold.
+         * @param animation Clip to be played.
+         * @param threshold Parameter value at which this motion has full weight.
+         */
+        void AddMotion(Animation* animation, float threshold);
+
+        [[nodiscard]] const std::vector<Motion>& GetMotions() const { return m_Motions; }
+
+        [[nodiscard]] float GetParameter() const { return m_Parameter; }
+
+        void SetParameter(float parameter) { m_Parameter = parameter; }
+
+        /**
+         * @brief Returns playback position shared by all motions, in range [0, 1).
+         */
+        [[nodiscard]] float GetNormalizedTime() const { return m_NormalizedTime; }
+
+        void SetNormalizedTime(float normalizedTime) { m_NormalizedTime = normalizedTime; }
+
+        /**
+         * @brief Advances playback. Motions are kept in phase, so the cycle length is blended as well.
+         * @param dt Time since last frame in seconds.
+         */
+        void Advance(float dt);
+
+        /**
+         * @brief Finds motions to be blended for the current parameter.
+         * @param first Index of the motion with weight (1 - weight).
+         * @param second Index of the motion with weight (weight).
+         * @param weight Blend factor between first and second motion.
+         * @return False if tree has no motions.
+         */
+        bool GetBlend(int& first, int& second, float& weight) const;
+
+    private:
+        static float GetDurationSeconds(Animation* animation);
+    };
+}
@@ -1,4 +1,5 @@
 #include "Bone.h"
+#include <algorithm>
 #include "Utility/AssimpGLMHelpers.h"
 
 namespace Models
@@ -45,46 +46,53 @@ namespace Models
     tranformations*/
     void Bone::Update(float animationTime)
     {
-        glm::mat4 translation = InterpolatePosition(animationTime);
-        glm::mat4 rotation = InterpolateRotation(animationTime);
-        glm::mat4 scale = InterpolateScaling(animationTime);
+        const BonePose pose = Sample(animationTime);
+        glm::mat4 translation = glm::translate(glm::mat4(1.0f), pose.position);
+        glm::mat4 rotation = glm::toMat4(pose.orientation);
+        glm::mat4 scale = glm::scale(glm::mat4(1.0f), pose.scale);
         m_LocalTransform = translation * rotation * scale;
     }
 
+    BonePose Bone::Sample(float animationTime) const
+    {
+        BonePose pose;
+        pose.position = InterpolatePosition(animationTime);
+        pose.orientation = InterpolateRotation(animationTime);
+        pose.scale = InterpolateScaling(animationTime);
+        return pose;
+    }
+
+    size_t Bone::GetMemoryUsage() const
+    {
+        return sizeof(Bone) + m_Name.capacity() + m_Positions.size() * sizeof(KeyPosition) +
+               m_Rotations.size() * sizeof(KeyRotation) + m_Scales.size() * sizeof(KeyScale);
+    }
+
     /* Gets the current index on mKeyPositions to interpolate to based on
     the current animation time*/
-    int Bone::GetPositionIndex(float animationTime)
+    int Bone::GetPositionIndex(float animationTime) const
     {
-        for (int index = 0; index < m_NumPositions - 1; ++index)
-        {
-            if (animationTime < m_Positions[index + 1].timeStamp)
-                return index;
-        }
-        assert(0);
+        const auto next = std::upper_bound(m_Positions.begin() + 1, m_Positions.end() - 1, animationTime,
+                                           [](float time, const KeyPosition& key) { return time < key.timeStamp; });
+        return static_cast<int>(next - m_Positions.begin()) - 1;
     }
 
     /* Gets the current index on mKeyRotations to interpolate to based on the
     current animation time*/
-    int Bone::GetRotationIndex(float animationTime)
+    int Bone::GetRotationIndex(float animationTime) const
     {
-        for (int index = 0; index < m_NumRotations - 1; ++index)
-        {
-            if (animationTime < m_Rotations[index + 1].timeStamp)
-                return index;
-        }
-        assert(0);
+        const auto next = std::upper_bound(m_Rotations.begin() + 1, m_Rotations.end() - 1, animationTime,
+                                           [](float time, const KeyRotation& key) { return time < key.timeStamp; });
+        return static_cast<int>(next - m_Rotations.begin()) - 1;
     }
 
     /* Gets the current index on mKeyScalings to interpolate to based on the
     current animation time */
-    int Bone::GetScaleIndex(float animationTime)
+    int Bone::GetScaleIndex(float animationTime) const
     {
-        for (int index = 0; index < m_NumScalings - 1; ++index)
-        {
-            if (animationTime < m_Scales[index + 1].timeStamp)
-                return index;
-        }
-        assert(0);
+        const auto next = std::upper_bound(m_Scales.begin() + 1, m_Scales.end() - 1, animationTime,
+                                           [](float time, const KeyScale& key) { return time < key.timeStamp; });
+        return static_cast<int>(next - m_Scales.begin()) - 1;
     }
 
     /* Gets normalized value for Lerp & Slerp*/
@@ -94,33 +102,29 @@ namespace Models
         float midWayLength = animationTime - lastTimeStamp;
         float framesDiff = nextTimeStamp - lastTimeStamp;
         scaleFactor = midWayLength / framesDiff;
-        return scaleFactor;
+        return glm::clamp(scaleFactor, 0.0f, 1.0f);
     }
 
     /*figures out which position keys to interpolate b/w and performs the interpolation
-    and returns the translation matrix*/
-    glm::mat4 Bone::InterpolatePosition(float animationTime)
+    and returns the translation*/
+    glm::vec3 Bone::InterpolatePosition(float animationTime) const
     {
         if (1 == m_NumPositions)
-            return glm::translate(glm::mat4(1.0f), m_Positions[0].position);
+            return m_Positions[0].position;
 
         int p0Index = GetPositionIndex(animationTime);
         int p1Index = p0Index + 1;
         float scaleFactor =
                 GetScaleFactor(m_Positions[p0Index].timeStamp, m_Positions[p1Index].timeStamp, animationTime);
-        glm::vec3 finalPosition = glm::mix(m_Positions[p0Index].position, m_Positions[p1Index].position, scaleFactor);
-        return glm::translate(glm::mat4(1.0f), finalPosition);
+        return glm::mix(m_Positions[p0Index].position, m_Positions[p1Index].position, scaleFactor);
     }
 
     /*figures out which rotations keys to interpolate b/w and performs the interpolation
-    and returns the rotation matrix*/
-    glm::mat4 Bone::InterpolateRotation(float animationTime)
+    and returns the rotation*/
+    glm::quat Bone::InterpolateRotation(float animationTime) const
     {
         if (1 == m_NumRotations)
-        {
-            auto rotation = glm::normalize(m_Rotations[0].orientation);
-            return glm::toMat4(rotation);
-        }
+            return glm::normalize(m_Rotations[0].orientation);
 
         int p0Index = GetRotationIndex(animationTime);
         int p1Index = p0Index + 1;
@@ -128,23 +132,19 @@ namespace Models
                 GetScaleFactor(m_Rotations[p0Index].timeStamp, m_Rotations[p1Index].timeStamp, animationTime);
         glm::quat finalRotation =
                 glm::slerp(m_Rotations[p0Index].orientation, m_Rotations[p1Index].orientation, scaleFactor);
-        finalRotation = glm::normalize(finalRotation);
-        return glm::toMat4(finalRotation);
+        return glm::normalize(finalRotation);
     }
 
     /*figures out which scaling keys to interpolate b/w and performs the interpolation
-    and returns the scale matrix*/
-    glm::mat4 Bone::InterpolateScaling(float animationTime)
+    and returns the scale*/
+    glm::vec3 Bone::InterpolateScaling(float animationTime) const
     {
-        {
-            if (1 == m_NumScalings)
-                return glm::scale(glm::mat4(1.0f), m_Scales[0].scale);
-
-            int p0Index = GetScaleIndex(animationTime);
-            int p1Index = p0Index + 1;
-            float scaleFactor = GetScaleFactor(m_Scales[p0Index].timeStamp, m_Scales[p1Index].timeStamp, animationTime);
-            glm::vec3 finalScale = glm::mix(m_Scales[p0Index].scale, m_Scales[p1Index].scale, scaleFactor);
-            return glm::scale(glm::mat4(1.0f), finalScale);
-        }
+        if (1 == m_NumScalings)
+            return m_Scales[0].scale;
+
+        int p0Index = GetScaleIndex(animationTime);
+        int p1Index = p0Index + 1;
+        float scaleFactor = GetScaleFactor(m_Scales[p0Index].timeStamp, m_Scales[p1Index].timeStamp, animationTime);
+        return glm::mix(m_Scales[p0Index].scale, m_Scales[p1Index].scale, scaleFactor);
     }
-} 
+}
@@ -23,6 +23,16 @@ namespace Models
         float timeStamp;
     };
 
+    /**
+     * @brief Local translation, rotation and scale of a single bone. Used as an intermediate when blending clips.
+     */
+    struct BonePose
+    {
+        glm::vec3 position = glm::vec3(0.0f);
+        glm::quat orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        glm::vec3 scale = glm::vec3(1.0f);
+    };
+
     class Bone
     {
     private:
@@ -42,19 +52,35 @@ namespace Models
         ~Bone() = default;
         void Update(float animationTime);
 
+        /**
+         * @brief Interpolates keys at a given time without touching the cached local transform.
+         * @param animationTime Time in ticks.
+         * @return Local pose of this bone.
+         */
+        BonePose Sample(float animationTime) const;
+
         glm::mat4 GetLocalTransform() const { return m_LocalTransform; }
         std::string GetBoneName() const { return m_Name; }
-        int GetBoneID() { return m_ID; }
+        int GetBoneID() const { return m_ID; }
+
+        const std::vector<KeyPosition>& GetPositionKeys() const { return m_Positions; }
+        const std::vector<KeyRotation>& GetRotationKeys() const { return m_Rotations; }
+        const std::vector<KeyScale>& GetScaleKeys() const { return m_Scales; }
+
+        /**
+         * @brief Returns number of bytes used by this bone's keys.
+         */
+        size_t GetMemoryUsage() const;
 
-        int GetPositionIndex(float animationTime);
-        int GetRotationIndex(float animationTime);
-        int GetScaleIndex(float animationTime);
+        int GetPositionIndex(float animationTime) const;
+        int GetRotationIndex(float animationTime) const;
+        int GetScaleIndex(float animationTime) const;
 
     private:
-        float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime);
-        glm::mat4 InterpolatePosition(float animationTime);
-        glm::mat4 InterpolateRotation(float animationTime);
-        glm::mat4 InterpolateScaling(float animationTime);
+        static float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime);
+        glm::vec3 InterpolatePosition(float animationTime) const;
+        glm::quat InterpolateRotation(float animationTime) const;
+        glm::vec3 InterpolateScaling(float animationTime) const;
 
 
     };
@@ -0,0 +1,26 @@
+#include "BoneMask.h"
+
+#include <algorithm>
+#include "Animation.h"
+
+namespace Models
+{
+    BoneMask::BoneMask(const Animation& skeleton, const std::vector<std::string>& roots, float weight)
+    {
+        const std::vector<AnimationNode>& nodes = skeleton.GetNodes();
+        m_Weights.resize(nodes.size(), 0.0f);
+
+        // Parents always precede their children, so a single pass propagates weights down the hierarchy.
+        for (int i = 0; i < nodes.size(); ++i)
+        {
+            if (std::ranges::find(roots, nodes[i].name) != roots.end())
+            {
+                m_Weights[i] = weight;
+            }
+            else if (nodes[i].parent >= 0)
+            {
+                m_Weights[i] = m_Weights[nodes[i].parent];
+            }
+        }
+    }
+}
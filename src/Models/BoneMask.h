@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Models
+{
+    class Animation;
+
+    /**
+     * @brief Per node weights restricting which part of a skeleton an animation layer affects.
+     */
+    class BoneMask
+    {
+    private:
+        std::vector<float> m_Weights;
+
+    public:
+        /**
+         * @brief Creates a mask affecting every node.
+         */
+        BoneMask() = default;
+
+        /**
+         * @brief Creates a mask affecting given nodes and all their descendants.
+         * @param skeleton Animation which flattened hierarchy is used as a skeleton.
+         * @param roots Names of nodes to be included with their children.
+         * @param weight Weight assigned to included nodes.
+         */
+        BoneMask(const Animation& skeleton, const std::vector<std::string>& roots, float weight = 1.0f);
+
+    public:
+        /**
+         * @brief Returns weight of a node in the flattened hierarchy.
+         * @param node Index of the node.
+         */
+        [[nodiscard]] float GetWeight(int node) const { return m_Weights.empty() ? 1.0f : m_Weights[node]; }
+
+        /**
+         * @brief Returns true if this mask affects every node with full weight.
+         */
+        [[nodiscard]] bool IsEmpty() const { return m_Weights.empty(); }
+    };
+}
@@ -0,0 +1,261 @@
+#include "CompressedBone.h"
+#include <algorithm>
+#include <cmath>
+#include "Utility/BinaryStreamUtilities.h"
+
+namespace Models
+{
+    namespace
+    {
+        constexpr float QuantizedVectorMax = 65535.0f;
+        constexpr float QuantizedTimeMax = 65535.0f;
+        constexpr float QuantizedComponentMax = 32767.0f;
+        /*no component other than the largest one can exceed 1/sqrt(2)*/
+        constexpr float ComponentRange = 0.70710678f;
+
+        uint16_t QuantizeTime(float time, float duration)
+        {
+            if (duration <= 0.0f)
+                return 0;
+            return static_cast<uint16_t>(std::lround(glm::clamp(time / duration, 0.0f, 1.0f) * QuantizedTimeMax));
+        }
+
+        QuantizedVector QuantizeVector(const glm::vec3& value, const glm::vec3& min, const glm::vec3& extent)
+        {
+            QuantizedVector result;
+            uint16_t* components[3] = {&result.x, &result.y, &result.z};
+            for (int i = 0; i < 3; ++i)
+            {
+                const float normalized = extent[i] > 0.0f ? glm::clamp((value[i] - min[i]) / extent[i], 0.0f, 1.0f) : 0.0f;
+                *components[i] = static_cast<uint16_t>(std::lround(normalized * QuantizedVectorMax));
+            }
+            return result;
+        }
+
+        glm::vec3 DequantizeVector(const QuantizedVector& value, const glm::vec3& min, const glm::vec3& extent)
+        {
+            return min + glm::vec3(value.x, value.y, value.z) * (extent / QuantizedVectorMax);
+        }
+
+        template<typename TKey, typename TGetter>
+        void CalculateRange(const std::vector<TKey>& keys, TGetter getter, glm::vec3& min, glm::vec3& extent)
+        {
+            glm::vec3 max(0.0f);
+            min = max = keys.empty() ? glm::vec3(0.0f) : getter(keys[0]);
+            for (const TKey& key : keys)
+            {
+                min = glm::min(min, getter(key));
+                max = glm::max(max, getter(key));
+            }
+            extent = max - min;
+        }
+
+        glm::quat Nlerp(const glm::quat& from, const glm::quat& to, float weight)
+        {
+            const glm::quat target = glm::dot(from, to) < 0.0f ? -to : to;
+            return glm::normalize(from * (1.0f - weight) + target * weight);
+        }
+    }
+
+    CompressedBone::CompressedBone(const std::string& name, int ID, float duration, float sampleInterval,
+                                   const std::vector<KeyPosition>& positions, const std::vector<KeyRotation>& rotations,
+                                   const std::vector<KeyScale>& scales) :
+        m_Name(name), m_ID(ID), m_Duration(duration), m_SampleInterval(sampleInterval)
+    {
+        CalculateRange(positions, [](const KeyPosition& key) { return key.position; }, m_PositionMin,
+                       m_PositionExtent);
+        CalculateRange(scales, [](const KeyScale& key) { return key.scale; }, m_ScaleMin, m_ScaleExtent);
+
+        const bool storeTimes = sampleInterval <= 0.0f;
+        for (const KeyPosition& key : positions)
+        {
+            m_Positions.push_back(QuantizeVector(key.position, m_PositionMin, m_PositionExtent));
+            if (storeTimes)
+                m_PositionTimes.push_back(QuantizeTime(key.timeStamp, duration));
+        }
+        for (const KeyRotation& key : rotations)
+        {
+            m_Rotations.push_back(QuantizeRotation(key.orientation));
+            if (storeTimes)
+                m_RotationTimes.push_back(QuantizeTime(key.timeStamp, duration));
+        }
+        for (const KeyScale& key : scales)
+        {
+            m_Scales.push_back(QuantizeVector(key.scale, m_ScaleMin, m_ScaleExtent));
+            if (storeTimes)
+                m_ScaleTimes.push_back(QuantizeTime(key.timeStamp, duration));
+        }
+    }
+
+    BonePose CompressedBone::Sample(float animationTime) const
+    {
+        BonePose pose;
+        float scaleFactor;
+
+        if (m_Positions.size() == 1)
+        {
+            pose.position = DequantizeVector(m_Positions[0], m_PositionMin, m_PositionExtent);
+        }
+        else if (!m_Positions.empty())
+        {
+            const int index = GetKeyIndex(m_PositionTimes, m_Positions.size(), animationTime, scaleFactor);
+            pose.position = glm::mix(DequantizeVector(m_Positions[index], m_PositionMin, m_PositionExtent),
+                                     DequantizeVector(m_Positions[index + 1], m_PositionMin, m_PositionExtent),
+                                     scaleFactor);
+        }
+
+        if (m_Rotations.size() == 1)
+        {
+            pose.orientation = DequantizeRotation(m_Rotations[0]);
+        }
+        else if (!m_Rotations.empty())
+        {
+            const int index = GetKeyIndex(m_RotationTimes, m_Rotations.size(), animationTime, scaleFactor);
+            pose.orientation = Nlerp(DequantizeRotation(m_Rotations[index]), DequantizeRotation(m_Rotations[index + 1]),
+                                     scaleFactor);
+        }
+
+        if (m_Scales.size() == 1)
+        {
+            pose.scale = DequantizeVector(m_Scales[0], m_ScaleMin, m_ScaleExtent);
+        }
+        else if (!m_Scales.empty())
+        {
+            const int index = GetKeyIndex(m_ScaleTimes, m_Scales.size(), animationTime, scaleFactor);
+            pose.scale = glm::mix(DequantizeVector(m_Scales[index], m_ScaleMin, m_ScaleExtent),
+                                  DequantizeVector(m_Scales[index + 1], m_ScaleMin, m_ScaleExtent), scaleFactor);
+        }
+
+        return pose;
+    }
+
+    int CompressedBone::GetKeyIndex(const std::vector<uint16_t>& times, size_t keyCount, float animationTime,
+                                    float& scaleFactor) const
+    {
+        const int lastSegment = static_cast<int>(keyCount) - 2;
+        if (m_SampleInterval > 0.0f)
+        {
+            const float position = glm::max(animationTime, 0.0f) / m_SampleInterval;
+            const int index = glm::min(static_cast<int>(position), lastSegment);
+            scaleFactor = glm::clamp(position - static_cast<float>(index), 0.0f, 1.0f);
+            return index;
+        }
+
+        const float time = glm::clamp(animationTime / m_Duration, 0.0f, 1.0f) * QuantizedTimeMax;
+        const auto next = std::upper_bound(times.begin() + 1, times.end() - 1, time,
+                                           [](float value, uint16_t key) { return value < key; });
+        const int index = static_cast<int>(next - times.begin()) - 1;
+        const float lastTime = times[index];
+        const float nextTime = times[index + 1];
+        scaleFactor = nextTime > lastTime ? glm::clamp((time - lastTime) / (nextTime - lastTime), 0.0f, 1.0f) : 1.0f;
+        return index;
+    }
+
+    size_t CompressedBone::GetMemoryUsage() const
+    {
+        return sizeof(CompressedBone) + m_Name.capacity() +
+               (m_PositionTimes.size() + m_RotationTimes.size() + m_ScaleTimes.size()) * sizeof(uint16_t) +
+               m_Positions.size() * sizeof(QuantizedVector) + m_Rotations.size() * sizeof(QuantizedRotation) +
+               m_Scales.size() * sizeof(QuantizedVector);
+    }
+
+    void CompressedBone::Write(std::ostream& stream) const
+    {
+        Utility::WriteBinary(stream, m_Name);
+        Utility::WriteBinary(stream, m_ID);
+        Utility::WriteBinary(stream, m_Duration);
+        Utility::WriteBinary(stream, m_SampleInterval);
+        Utility::WriteBinary(stream, m_PositionMin);
+        Utility::WriteBinary(stream, m_PositionExtent);
+        Utility::WriteBinary(stream, m_ScaleMin);
+        Utility::WriteBinary(stream, m_ScaleExtent);
+        Utility::WriteBinary(stream, m_PositionTimes);
+        Utility::WriteBinary(stream, m_Positions);
+        Utility::WriteBinary(stream, m_RotationTimes);
+        Utility::WriteBinary(stream, m_Rotations);
+        Utility::WriteBinary(stream, m_ScaleTimes);
+        Utility::WriteBinary(stream, m_Scales);
+    }
+
+    bool CompressedBone::Read(std::istream& stream)
+    {
+        Utility::ReadBinary(stream, m_Name);
+        Utility::ReadBinary(stream, m_ID);
+        Utility::ReadBinary(stream, m_Duration);
+        Utility::ReadBinary(stream, m_SampleInterval);
+        Utility::ReadBinary(stream, m_PositionMin);
+        Utility::ReadBinary(stream, m_PositionExtent);
+        Utility::ReadBinary(stream, m_ScaleMin);
+        Utility::ReadBinary(stream, m_ScaleExtent);
+        Utility::ReadBinary(stream, m_PositionTimes);
+        Utility::ReadBinary(stream, m_Positions);
+        Utility::ReadBinary(stream, m_RotationTimes);
+        Utility::ReadBinary(stream, m_Rotations);
+        Utility::ReadBinary(stream, m_ScaleTimes);
+        Utility::ReadBinary(stream, m_Scales);
+        if (!stream)
+        {
+            return false;
+        }
+
+        // Keys without a sample interval are found by their times, every key needs one.
+        if (m_SampleInterval > 0.0f)
+        {
+            return true;
+        }
+        const bool hasAllTimes = m_PositionTimes.size() == m_Positions.size() &&
+                                 m_RotationTimes.size() == m_Rotations.size() && m_ScaleTimes.size() == m_Scales.size();
+        const bool hasMultipleKeys = m_Positions.size() > 1 || m_Rotations.size() > 1 || m_Scales.size() > 1;
+        return hasAllTimes && (!hasMultipleKeys || m_Duration > 0.0f);
+    }
+
+    QuantizedRotation CompressedBone::QuantizeRotation(const glm::quat& rotation)
+    {
+        const glm::quat normalized = glm::normalize(rotation);
+        int largest = 0;
+        for (int i = 1; i < 4; ++i)
+        {
+            if (std::abs(normalized[i]) > std::abs(normalized[largest]))
+                largest = i;
+        }
+
+        /*q and -q are the same rotation, flip so that the dropped component is positive*/
+        const float sign = normalized[largest] < 0.0f ? -1.0f : 1.0f;
+        uint64_t bits = static_cast<uint64_t>(largest);
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == largest)
+                continue;
+            const float component = glm::clamp(normalized[i] * sign / ComponentRange, -1.0f, 1.0f);
+            bits = bits << 15 | static_cast<uint64_t>(std::lround((component * 0.5f + 0.5f) * QuantizedComponentMax));
+        }
+
+        QuantizedRotation result;
+        result.data[0] = static_cast<uint16_t>(bits >> 32);
+        result.data[1] = static_cast<uint16_t>(bits >> 16);
+        result.data[2] = static_cast<uint16_t>(bits);
+        return result;
+    }
+
+    glm::quat CompressedBone::DequantizeRotation(const QuantizedRotation& rotation)
+    {
+        const uint64_t bits = static_cast<uint64_t>(rotation.data[0]) << 32 |
+                              static_cast<uint64_t>(rotation.data[1]) << 16 | rotation.data[2];
+        const int largest = static_cast<int>(bits >> 45 & 3);
+
+        glm::quat result;
+        float sum = 0.0f;
+        int shift = 30;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == largest)
+                continue;
+            const float quantized = static_cast<float>(bits >> shift & 0x7FFF);
+            result[i] = (quantized / QuantizedComponentMax * 2.0f - 1.0f) * ComponentRange;
+            sum += result[i] * result[i];
+            shift -= 15;
+        }
+        result[largest] = std::sqrt(glm::max(0.0f, 1.0f - sum));
+        return result;
+    }
+}
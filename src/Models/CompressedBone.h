@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Bone.h"
+
+namespace Models
+{
+    /*vector quantized to 16 bits per component within the range of its track*/
+    struct QuantizedVector
+    {
+        uint16_t x;
+        uint16_t y;
+        uint16_t z;
+    };
+
+    /*smallest three encoding: index of the dropped component in the top 2 bits,
+    then remaining three components with 15 bits each*/
+    struct QuantizedRotation
+    {
+        uint16_t data[3];
+    };
+
+    /**
+     * @brief Read-only counterpart of Bone with reduced and quantized keys.
+     * Key times are stored as 16 bit fractions of the clip duration, or omitted entirely when the clip
+     * was resampled at a fixed rate, in which case key lookup is a single division.
+     */
+    class CompressedBone
+    {
+    private:
+        std::string m_Name;
+        int m_ID = -1;
+        float m_Duration = 0.0f;
+        /*distance between keys in ticks, 0 if key times are stored explicitly*/
+        float m_SampleInterval = 0.0f;
+
+        std::vector<uint16_t> m_PositionTimes;
+        std::vector<QuantizedVector> m_Positions;
+        glm::vec3 m_PositionMin = glm::vec3(0.0f);
+        glm::vec3 m_PositionExtent = glm::vec3(0.0f);
+
+        std::vector<uint16_t> m_RotationTimes;
+        std::vector<QuantizedRotation> m_Rotations;
+
+        std::vector<uint16_t> m_ScaleTimes;
+        std::vector<QuantizedVector> m_Scales;
+        glm::vec3 m_ScaleMin = glm::vec3(0.0f);
+        glm::vec3 m_ScaleExtent = glm::vec3(0.0f);
+
+    public:
+        CompressedBone() = default;
+
+        /**
+         * @brief Quantizes already reduced keys.
+         * @param name Name of the bone.
+         * @param ID Index of the bone in final bone matrices.
+         * @param duration Duration of the clip in ticks.
+         * @param sampleInterval Distance between keys in ticks if keys are uniformly sampled, 0 otherwise.
+         */
+        CompressedBone(const std::string& name, int ID, float duration, float sampleInterval,
+                       const std::vector<KeyPosition>& positions, const std::vector<KeyRotation>& rotations,
+                       const std::vector<KeyScale>& scales);
+
+        ~CompressedBone() = default;
+
+        /**
+         * @brief Decodes pose at a given time.
+         * @param animationTime Time in ticks.
+         * @return Local pose of this bone.
+         */
+        BonePose Sample(float animationTime) const;
+
+        [[nodiscard]] const std::string& GetBoneName() const { return m_Name; }
+        [[nodiscard]] int GetBoneID() const { return m_ID; }
+
+        /**
+         * @brief Returns number of bytes used by this bone's keys.
+         */
+        [[nodiscard]] size_t GetMemoryUsage() const;
+
+        void Write(std::ostream& stream) const;
+
+        /**
+         * @brief Reads a bone written by Write.
+         * @return False if the stream failed or its keys can't be sampled.
+         */
+        bool Read(std::istream& stream);
+
+        static QuantizedRotation QuantizeRotation(const glm::quat& rotation);
+        static glm::quat DequantizeRotation(const QuantizedRotation& rotation);
+
+    private:
+        int GetKeyIndex(const std::vector<uint16_t>& times, size_t keyCount, float animationTime,
+                        float& scaleFactor) const;
+    };
+}
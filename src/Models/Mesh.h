@@ -8,6 +8,16 @@
 
 namespace Models
 {
+    /**
+     * @brief Mesh read from a file, not uploaded to the GPU yet.
+     */
+    struct MeshData
+    {
+        std::vector<Vertex> Vertices;
+        std::vector<unsigned int> Indices;
+        std::string Name;
+    };
+
     /**
      * @brief Collection of vertices accessible to the GPU.
      */
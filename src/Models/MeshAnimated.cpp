@@ -1,14 +1,22 @@
 #include "MeshAnimated.h"
 
 #include "glad/glad.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Engine/Rendering/GraphicsContext.h"
 
 namespace Models
 {
     MeshAnimated::MeshAnimated(const std::vector<VertexAnimated>& VerticesData,
                                const std::vector<unsigned int>& VertexIndices,
                                const std::string& Name) :
-        VerticesData(VerticesData), VertexIndices(VertexIndices), AABBox(CreateAABBox(VerticesData)), Name(Name)
+        VerticesData(VerticesData), VertexIndices(VertexIndices), AABBox(CreateAABBox(VerticesData)),
+        VertexArray(0), VertexBuffer(0), ElementBuffer(0), Name(Name)
     {
+        if (!Engine::GraphicsContext::IsAvailable())
+        {
+            /*without a context only the vertices are kept, colliders and bounds still use them*/
+            return;
+        }
         glGenVertexArrays(1, &VertexArray);
         glGenBuffers(1, &ElementBuffer);
         glGenBuffers(1, &VertexBuffer);
@@ -17,9 +25,11 @@ namespace Models
         glBindBuffer(GL_ARRAY_BUFFER, VertexBuffer);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ElementBuffer);
+        TELEMETRY_COUNT(BytesUploaded, VertexIndices.size() * sizeof(unsigned int));
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, VertexIndices.size() * sizeof(unsigned int), &VertexIndices[0],
                      GL_STATIC_DRAW);
 
+        TELEMETRY_COUNT(BytesUploaded, VerticesData.size() * sizeof(VertexAnimated));
         glBufferData(GL_ARRAY_BUFFER, VerticesData.size() * sizeof(VertexAnimated), &VerticesData[0], GL_STATIC_DRAW);
 
         // Vertex::Position
@@ -57,12 +67,17 @@ namespace Models
     void MeshAnimated::Draw() const
     {
         glBindVertexArray(VertexArray);
+        TELEMETRY_COUNT(DrawCalls, 1);
         glDrawElements(GL_TRIANGLES, VertexIndices.size(), GL_UNSIGNED_INT, 0);
         glBindVertexArray(0);
     }
 
     MeshAnimated::~MeshAnimated()
     {
+        if (!Engine::GraphicsContext::IsAvailable())
+        {
+            return;
+        }
         glDeleteBuffers(1, &VertexBuffer);
         glDeleteBuffers(1, &ElementBuffer);
         glDeleteVertexArrays(1, &VertexArray);
@@ -7,9 +7,26 @@
 
 namespace Models
 {
-    Model::Model(const char* FilePath)
+    Model::Model(const char* FilePath) :
+        Model(FilePath, Read(FilePath))
+    {
+    }
+
+    Model::Model(const char* FilePath, const std::vector<MeshData>& Data)
     {
         Path = std::string(FilePath);
+        Meshes.reserve(Data.size());
+        for (const MeshData& mesh : Data)
+        {
+            Meshes.push_back(std::make_unique<Mesh>(mesh.Vertices, mesh.Indices, mesh.Name));
+        }
+    }
+
+    Model::~Model() = default;
+
+    std::vector<MeshData> Model::Read(const char* FilePath)
+    {
+        std::vector<MeshData> data;
         Assimp::Importer importer = Assimp::Importer();
 
         const aiScene* scene = importer.ReadFile(FilePath,
@@ -18,29 +35,28 @@ namespace Models
         if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE ||
             !scene->mRootNode)
         {
-            return;
+            return data;
         }
 
-        ProcessNode(scene->mRootNode, scene);
+        ProcessNode(scene->mRootNode, scene, data);
+        return data;
     }
 
-    Model::~Model() = default;
-
-    void Model::ProcessNode(const aiNode* const Node, const aiScene* Scene)
+    void Model::ProcessNode(const aiNode* const Node, const aiScene* Scene, std::vector<MeshData>& Data)
     {
         for (unsigned int i = 0; i < Node->mNumMeshes; ++i)
         {
             aiMesh* mesh = Scene->mMeshes[Node->mMeshes[i]];
-            Meshes.push_back(ProcessMesh(mesh));
+            Data.push_back(ProcessMesh(mesh));
         }
 
         for (unsigned int i = 0; i < Node->mNumChildren; ++i)
         {
-            ProcessNode(Node->mChildren[i], Scene);
+            ProcessNode(Node->mChildren[i], Scene, Data);
         }
     }
 
-    std::unique_ptr<Mesh> Model::ProcessMesh(aiMesh* Mesh)
+    MeshData Model::ProcessMesh(aiMesh* Mesh)
     {
         std::vector<Vertex> vertices;
         vertices.reserve(Mesh->mNumVertices);
@@ -70,6 +86,6 @@ namespace Models
                 indices.push_back(face.mIndices[j]);
         }
 
-        return std::make_unique<class Mesh>(vertices, indices, std::string(Mesh->mName.C_Str()));
+        return MeshData{std::move(vertices), std::move(indices), std::string(Mesh->mName.C_Str())};
     }
 } // Models
@@ -25,10 +25,24 @@ namespace Models
          */
         explicit Model(const char* FilePath);
 
+        /**
+         * @brief Constructs a new model from meshes read in advance.
+         * @param FilePath Path to the model file.
+         * @param Data Meshes returned by Read.
+         */
+        Model(const char* FilePath, const std::vector<MeshData>& Data);
+
     public:
         virtual ~Model();
 
     public:
+        /**
+         * @brief Reads meshes from a model file. Doesn't use OpenGL, so it can be called from any thread.
+         * @param FilePath Path to a model file.
+         * @return Meshes of the model, empty if the file couldn't be read.
+         */
+        [[nodiscard]] static std::vector<MeshData> Read(const char* FilePath);
+
         /**
          * @brief Returns number of meshes contained by this model.
          */
@@ -73,8 +87,8 @@ namespace Models
         }
 
     private:
-        void ProcessNode(const aiNode* Node, const aiScene* Scene);
+        static void ProcessNode(const aiNode* Node, const aiScene* Scene, std::vector<MeshData>& Data);
 
-        static std::unique_ptr<Mesh> ProcessMesh(aiMesh* Mesh);
+        static MeshData ProcessMesh(aiMesh* Mesh);
     };
 } // Models
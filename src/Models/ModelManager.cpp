@@ -3,6 +3,8 @@
 #include "Model.h"
 #include "ModelAnimated.h"
 #include "Animation.h"
+#include "AnimationCompressor.h"
+#include <filesystem>
 
 
 namespace Models
@@ -26,6 +28,21 @@ namespace Models
         return newModel;
     }
 
+    Model* ModelManager::AddModel(const char* const Path, const std::vector<MeshData>& Data)
+    {
+        const std::string path = Path;
+
+        if (const auto iterator = Models.find(path); iterator != Models.end())
+        {
+            return iterator->second;
+        }
+
+        Model* newModel = new Model(Path, Data);
+
+        Models.emplace(path, newModel);
+        return newModel;
+    }
+
     ModelAnimated* ModelManager::GetAnimatedModel(const char* Path)
     {
         const std::string path = Path;
@@ -51,7 +68,9 @@ namespace Models
             return iterator->second;
         }
 
-        Animation* newModel = new Animation(Path, GetAnimatedModel(Path));
+        Animation* newModel = std::filesystem::path(path).extension() == AnimationCompressor::FileExtension
+                                      ? new Animation(path)
+                                      : new Animation(Path, GetAnimatedModel(Path));
 
         Animations.emplace(path, newModel);
         return newModel;
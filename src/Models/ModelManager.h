@@ -1,9 +1,11 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Models
 {
+    struct MeshData;
     class Model;
     class ModelAnimated;
     class Animation;
@@ -26,6 +28,14 @@ namespace Models
          */
         static Model* GetModel(const char* Path);
 
+        /**
+         * @brief Creates a model from meshes read in advance, used by asset streaming.
+         * @param Path Model's file, later GetModel calls with this path return the model.
+         * @param Data Meshes read with Model::Read.
+         * @return Created model, or the existing one if the path is already loaded.
+         */
+        static Model* AddModel(const char* Path, const std::vector<MeshData>& Data);
+
         static ModelAnimated* GetAnimatedModel(const char* Path);
         static Animation* GetAnimation(const char* Path);
 
@@ -50,7 +50,7 @@ namespace Scene
         ZoneScoped;
 
         Scene = new class Engine::Scene();
-        Engine::SceneManager::LoadScene("./res/scenes/Gameplay.lvl", Scene);
+        Engine::SceneManager::ActivateScene("./res/scenes/Gameplay.lvl", Scene);
         // TODO: remove when no longer needed
         
 
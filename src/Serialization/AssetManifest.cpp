@@ -0,0 +1,278 @@
+#include "AssetManifest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
+#include <unordered_set>
+
+#include "SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+    /*assets engine code requests by path when objects are created, they can't be found in scene data
+      so they have to be kept in sync with the code*/
+    constexpr const char* CodeReferencedTextures[] = {"res/textures/BloodSplatter/BloodTest.dds"};
+#if EDITOR
+    constexpr const char* CodeReferencedMaterials[] = {"res/materials/Editor/Gizmo.mat"};
+#endif
+
+    void FindAssets(const rapidjson::Value& Value, std::string_view Type, Serialization::AssetManifest& Manifest)
+    {
+        if (Value.IsArray())
+        {
+            for (const rapidjson::Value& element : Value.GetArray())
+            {
+                FindAssets(element, Type, Manifest);
+            }
+            return;
+        }
+        if (!Value.IsObject())
+        {
+            return;
+        }
+
+        if (const auto typeIterator = Value.FindMember("type");
+            typeIterator != Value.MemberEnd() && typeIterator->value.IsString())
+        {
+            Type = typeIterator->value.GetString();
+        }
+
+        /*shaders are serialized as objects with their source files*/
+        const auto vertexIterator = Value.FindMember("vertex");
+        const auto geometryIterator = Value.FindMember("geometry");
+        const auto fragmentIterator = Value.FindMember("fragment");
+        if (vertexIterator != Value.MemberEnd() && vertexIterator->value.IsString() &&
+            geometryIterator != Value.MemberEnd() && geometryIterator->value.IsString() &&
+            fragmentIterator != Value.MemberEnd() && fragmentIterator->value.IsString())
+        {
+            Manifest.Shaders.emplace_back(vertexIterator->value.GetString(), geometryIterator->value.GetString(),
+                                          fragmentIterator->value.GetString());
+            return;
+        }
+
+        for (const auto& member : Value.GetObject())
+        {
+            if (!member.value.IsString())
+            {
+                FindAssets(member.value, Type, Manifest);
+                continue;
+            }
+
+            const std::string_view name = member.name.GetString();
+            const std::string_view string(member.value.GetString(), member.value.GetStringLength());
+            if (string.ends_with(".dds") || string.ends_with(".hdr"))
+            {
+                Manifest.Textures.emplace_back(string);
+            }
+            else if (string.ends_with(".mat"))
+            {
+                Manifest.Materials.emplace_back(string);
+            }
+            else if (string.ends_with(".prefab"))
+            {
+                Manifest.Prefabs.emplace_back(string);
+            }
+            else if (string.ends_with(".comp"))
+            {
+                Manifest.ComputeShaders.emplace_back(string);
+            }
+            else if (name == "Model" || name == "Settings.Model")
+            {
+                (Type == "AnimatedModelRenderer" ? Manifest.AnimatedModels : Manifest.Models).emplace_back(string);
+            }
+            else if (name == "Animation")
+            {
+                Manifest.Animations.emplace_back(string);
+            }
+        }
+    }
+
+    /**
+     * @brief Searches materials and prefabs for assets until no new file is found.
+     */
+    void FindDependencies(Serialization::AssetManifest& Manifest)
+    {
+        std::unordered_set<std::string> visited;
+        size_t materialIndex = 0;
+        size_t prefabIndex = 0;
+        while (materialIndex < Manifest.Materials.size() || prefabIndex < Manifest.Prefabs.size())
+        {
+            const bool isMaterial = materialIndex < Manifest.Materials.size();
+            /*vectors may grow while the file is searched*/
+            const std::string path = isMaterial ? Manifest.Materials[materialIndex++] : Manifest.Prefabs[prefabIndex++];
+            if (!visited.insert(path).second)
+            {
+                continue;
+            }
+            if (!std::filesystem::exists(path))
+            {
+                spdlog::warn("Asset {0} referenced by a scene doesn't exist.", path);
+                continue;
+            }
+
+            rapidjson::Document document;
+            Serialization::ReadJsonFile(path.c_str(), document);
+            FindAssets(document, "", Manifest);
+        }
+    }
+
+    void RemoveDuplicates(std::vector<std::string>& Paths)
+    {
+        std::ranges::sort(Paths);
+        Paths.erase(std::ranges::unique(Paths).begin(), Paths.end());
+    }
+
+    void RemoveDuplicates(std::vector<Shaders::ShaderSourceFiles>& Shaders)
+    {
+        std::unordered_set<Shaders::ShaderSourceFiles> found;
+        std::erase_if(Shaders, [&found](const Shaders::ShaderSourceFiles& Files)
+        {
+            return !found.insert(Files).second;
+        });
+    }
+
+    rapidjson::Value SerializePaths(const std::vector<std::string>& Paths,
+                                    rapidjson::Document::AllocatorType& Allocator)
+    {
+        rapidjson::Value array(rapidjson::kArrayType);
+        array.Reserve(static_cast<rapidjson::SizeType>(Paths.size()), Allocator);
+        for (const std::string& path : Paths)
+        {
+            array.PushBack(rapidjson::Value(path.c_str(), Allocator), Allocator);
+        }
+        return array;
+    }
+
+    void DeserializePaths(const rapidjson::Value& Object, const char* Name, std::vector<std::string>& Paths)
+    {
+        const auto iterator = Object.FindMember(Name);
+        if (iterator == Object.MemberEnd() || !iterator->value.IsArray())
+        {
+            return;
+        }
+        Paths.reserve(iterator->value.Size());
+        for (const rapidjson::Value& path : iterator->value.GetArray())
+        {
+            if (path.IsString())
+            {
+                Paths.emplace_back(path.GetString(), path.GetStringLength());
+            }
+        }
+    }
+}
+
+namespace Serialization
+{
+    std::string GetManifestPath(const std::string& ScenePath)
+    {
+        return ScenePath + ".manifest";
+    }
+
+    AssetManifest BuildManifest(const rapidjson::Value& SceneData)
+    {
+        ZoneScoped;
+        AssetManifest manifest;
+        FindAssets(SceneData, "", manifest);
+        manifest.Textures.insert(manifest.Textures.end(), std::begin(CodeReferencedTextures),
+                                 std::end(CodeReferencedTextures));
+#if EDITOR
+        manifest.Materials.insert(manifest.Materials.end(), std::begin(CodeReferencedMaterials),
+                                  std::end(CodeReferencedMaterials));
+#endif
+        FindDependencies(manifest);
+
+        RemoveDuplicates(manifest.Textures);
+        RemoveDuplicates(manifest.Models);
+        RemoveDuplicates(manifest.AnimatedModels);
+        RemoveDuplicates(manifest.Animations);
+        RemoveDuplicates(manifest.Materials);
+        RemoveDuplicates(manifest.Shaders);
+        RemoveDuplicates(manifest.ComputeShaders);
+        RemoveDuplicates(manifest.Prefabs);
+        return manifest;
+    }
+
+    size_t BuildManifests(const char* const Directory)
+    {
+        size_t built = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(Directory))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".lvl")
+            {
+                continue;
+            }
+            const std::string scenePath = entry.path().string();
+            rapidjson::Document scene;
+            ReadJsonFile(scenePath.c_str(), scene);
+            const AssetManifest manifest = BuildManifest(scene);
+            WriteManifest(GetManifestPath(scenePath).c_str(), manifest);
+            spdlog::info("Built manifest of {0} with {1} assets.", scenePath, manifest.GetSize());
+            ++built;
+        }
+        return built;
+    }
+
+    void WriteManifest(const char* const Path, const AssetManifest& Manifest)
+    {
+        rapidjson::Document document(rapidjson::kObjectType);
+        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+        document.AddMember("Textures", SerializePaths(Manifest.Textures, allocator), allocator);
+        document.AddMember("Models", SerializePaths(Manifest.Models, allocator), allocator);
+        document.AddMember("AnimatedModels", SerializePaths(Manifest.AnimatedModels, allocator), allocator);
+        document.AddMember("Animations", SerializePaths(Manifest.Animations, allocator), allocator);
+        document.AddMember("Materials", SerializePaths(Manifest.Materials, allocator), allocator);
+
+        rapidjson::Value shaders(rapidjson::kArrayType);
+        for (const Shaders::ShaderSourceFiles& files : Manifest.Shaders)
+        {
+            rapidjson::Value object(rapidjson::kObjectType);
+            object.AddMember("vertex", rapidjson::Value(files.VertexShader.c_str(), allocator), allocator);
+            object.AddMember("geometry", rapidjson::Value(files.GeometryShader.c_str(), allocator), allocator);
+            object.AddMember("fragment", rapidjson::Value(files.FragmentShader.c_str(), allocator), allocator);
+            shaders.PushBack(object, allocator);
+        }
+        document.AddMember("Shaders", shaders, allocator);
+
+        document.AddMember("ComputeShaders", SerializePaths(Manifest.ComputeShaders, allocator), allocator);
+        document.AddMember("Prefabs", SerializePaths(Manifest.Prefabs, allocator), allocator);
+        WriteJsonFile(Path, document);
+    }
+
+    bool ReadManifest(const std::string& ScenePath, AssetManifest& Manifest)
+    {
+        const std::string manifestPath = GetManifestPath(ScenePath);
+        std::error_code error;
+        const auto manifestTime = std::filesystem::last_write_time(manifestPath, error);
+        if (error)
+        {
+            return false;
+        }
+        const auto sceneTime = std::filesystem::last_write_time(ScenePath, error);
+        if (!error && manifestTime < sceneTime)
+        {
+            spdlog::warn("Manifest of {0} is older than the scene, rebuild it with --build-manifests.", ScenePath);
+            return false;
+        }
+
+        rapidjson::Document document;
+        ReadJsonFile(manifestPath.c_str(), document);
+        DeserializePaths(document, "Textures", Manifest.Textures);
+        DeserializePaths(document, "Models", Manifest.Models);
+        DeserializePaths(document, "AnimatedModels", Manifest.AnimatedModels);
+        DeserializePaths(document, "Animations", Manifest.Animations);
+        DeserializePaths(document, "Materials", Manifest.Materials);
+        if (const auto iterator = document.FindMember("Shaders");
+            iterator != document.MemberEnd() && iterator->value.IsArray())
+        {
+            /*the walk recognizes shader objects the same way in the manifest as in a scene*/
+            AssetManifest shaders;
+            FindAssets(iterator->value, "", shaders);
+            Manifest.Shaders = std::move(shaders.Shaders);
+        }
+        DeserializePaths(document, "ComputeShaders", Manifest.ComputeShaders);
+        DeserializePaths(document, "Prefabs", Manifest.Prefabs);
+        return true;
+    }
+} // Serialization
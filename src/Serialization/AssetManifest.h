@@ -0,0 +1,79 @@
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+#include "Shaders/ShaderSourceFiles.h"
+
+namespace Serialization
+{
+    enum class AssetType : uint8_t
+    {
+        Texture,
+        Model,
+        AnimatedModel,
+        Animation,
+        Material,
+        Shader,
+        ComputeShader,
+        Prefab,
+        Count
+    };
+
+    constexpr std::array<const char*, static_cast<size_t>(AssetType::Count)> AssetTypeNames = {
+        "textures", "models", "animated models", "animations", "materials", "shaders", "compute shaders", "prefabs"
+    };
+
+    /**
+     * @brief Every asset a level uses, including assets of its materials and prefabs.
+     */
+    struct AssetManifest
+    {
+        std::vector<std::string> Textures;
+        std::vector<std::string> Models;
+        std::vector<std::string> AnimatedModels;
+        std::vector<std::string> Animations;
+        std::vector<std::string> Materials;
+        std::vector<Shaders::ShaderSourceFiles> Shaders;
+        std::vector<std::string> ComputeShaders;
+        std::vector<std::string> Prefabs;
+
+        [[nodiscard]] size_t GetSize() const
+        {
+            return Textures.size() + Models.size() + AnimatedModels.size() + Animations.size() + Materials.size() +
+                   Shaders.size() + ComputeShaders.size() + Prefabs.size();
+        }
+    };
+
+    /**
+     * @brief Returns path of the manifest of a scene file.
+     * @param ScenePath Path of the scene file.
+     */
+    [[nodiscard]] std::string GetManifestPath(const std::string& ScenePath);
+
+    /**
+     * @brief Collects assets referenced by scene data, following materials and prefabs to their own assets.
+     * Assets requested by engine code rather than data are added as well.
+     * @param SceneData Data of a scene.
+     * @return Manifest without duplicates.
+     */
+    [[nodiscard]] AssetManifest BuildManifest(const rapidjson::Value& SceneData);
+
+    /**
+     * @brief Builds and writes the manifest of every scene (.lvl) file in a directory and its subdirectories.
+     * @param Directory Directory to search.
+     * @return Number of written manifests.
+     */
+    size_t BuildManifests(const char* Directory);
+
+    void WriteManifest(const char* Path, const AssetManifest& Manifest);
+
+    /**
+     * @brief Reads the manifest of a scene, unless it's missing or older than the scene file.
+     * @param ScenePath Path of the scene file.
+     * @param Manifest Manifest to read data to.
+     * @return True if the manifest was read.
+     */
+    bool ReadManifest(const std::string& ScenePath, AssetManifest& Manifest);
+} // Serialization
@@ -0,0 +1,761 @@
+#include "CookedFilesUtility.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+
+#include "Engine/EngineObjects/Scene/Scene.h"
+#include "GuidHasher.h"
+#include "Reflection.h"
+#include "SerializationFilesUtility.h"
+#include "spdlog/spdlog.h"
+#include "tracy/Tracy.hpp"
+#include "Utility/MappedFile.h"
+
+namespace
+{
+    using Serialization::CookedFile;
+
+    constexpr uint32_t CookedMagic = 0x444B4F43; // "COKD"
+    /*increment whenever the layout below changes, files of other versions are ignored*/
+    constexpr uint32_t CookedVersion = 2;
+
+    /*
+     * Layout of a cooked file:
+     * CookedHeader
+     * StringRecord[StringCount]
+     * TypeRecord[TypeCount]       - type name and layout hash of its reflection, 0 for types without one
+     * ObjectRecord[ObjectCount]   - in order of the json file, every entity is followed by its transform,
+     *                               scene files start with the scene root
+     * uint32[IndexCount]          - references of objects in order of their reflection, lists preceded by size;
+     *                               for entities name, prefab, tag count, tags, component count and components
+     * char[StringDataSize]        - all distinct strings, not terminated
+     * uint8[BlockDataSize]        - reflected fields of objects and scene settings, in the layout of WriteBinary
+     */
+    struct CookedHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t IsScene;
+        uint32_t StringCount;
+        uint32_t TypeCount;
+        uint32_t ObjectCount;
+        uint32_t IndexCount;
+        uint32_t StringDataSize;
+        uint32_t BlockDataSize;
+        /*scene settings, None for prefabs*/
+        uint32_t Ui;
+        uint32_t GameMode;
+        uint32_t Player;
+        uint32_t SettingsOffset;
+        uint32_t SettingsSize;
+    };
+
+    /**
+     * @brief Converts a scene or prefab json file to the cooked layout.
+     * All objects are collected first, so references can be stored as indices of objects after them as well.
+     */
+    class CookedWriter
+    {
+    private:
+        const char* Path;
+        /*whether fields missing in json take values of a default object of their type instead of failing*/
+        bool UseDefaults;
+        CookedHeader Header = {};
+        std::unordered_map<std::string_view, uint32_t> StringIndices;
+        std::vector<CookedFile::StringRecord> Strings;
+        std::string StringData;
+        std::unordered_map<std::string_view, uint32_t> TypeIndices;
+        std::vector<CookedFile::TypeRecord> Types;
+        std::vector<const Serialization::ClassReflection*> Reflections;
+        /*default objects of types, only created if UseDefaults is set*/
+        std::vector<std::unique_ptr<Serialization::SerializedObject>> Defaults;
+        std::vector<CookedFile::ObjectRecord> Objects;
+        std::vector<const rapidjson::Value*> Sources;
+        std::unordered_map<Utility::Guid, uint32_t, Serialization::GuidHasher> ObjectIndices;
+        std::vector<uint32_t> Indices;
+        std::vector<uint8_t> Blocks;
+
+    public:
+        CookedWriter(const char* Path, const bool UseDefaults) :
+            Path(Path), UseDefaults(UseDefaults)
+        {
+        }
+
+    public:
+        bool WriteScene(const rapidjson::Value& Document)
+        {
+            const auto root = Document.FindMember("Root");
+            const auto objects = Document.FindMember("Objects");
+            if (root == Document.MemberEnd() || objects == Document.MemberEnd() || !objects->value.IsArray())
+            {
+                spdlog::warn("{0} is neither a scene nor a prefab, it's left uncooked.", Path);
+                return false;
+            }
+
+            Header.IsScene = 1;
+            if (!AddObject(root->value))
+            {
+                return false;
+            }
+            for (const rapidjson::Value& object : objects->value.GetArray())
+            {
+                if (!AddObject(object))
+                {
+                    return false;
+                }
+            }
+            if (!WriteObjects())
+            {
+                return false;
+            }
+
+            Header.Ui = InternMember(Document, "UI");
+            Header.GameMode = InternMember(Document, "GameMode");
+            Header.Player = InternMember(Document, "Player");
+            Header.SettingsOffset = static_cast<uint32_t>(Blocks.size());
+            if (!ConvertToBinary(Document, Engine::Scene::GetStaticReflection(), Blocks))
+            {
+                spdlog::warn("Settings of scene {0} are incomplete, it's left uncooked.", Path);
+                return false;
+            }
+            Header.SettingsSize = static_cast<uint32_t>(Blocks.size()) - Header.SettingsOffset;
+            return true;
+        }
+
+        bool WritePrefab(const rapidjson::Value& Document)
+        {
+            const auto prefab = Document.FindMember("Prefab");
+            if (prefab == Document.MemberEnd() || !prefab->value.IsArray())
+            {
+                spdlog::warn("{0} is neither a scene nor a prefab, it's left uncooked.", Path);
+                return false;
+            }
+
+            Header.Ui = CookedFile::None;
+            Header.GameMode = CookedFile::None;
+            Header.Player = CookedFile::None;
+            for (const rapidjson::Value& object : prefab->value.GetArray())
+            {
+                if (!AddObject(object))
+                {
+                    return false;
+                }
+            }
+            return WriteObjects();
+        }
+
+        [[nodiscard]] std::vector<uint8_t> Save()
+        {
+            Header.Magic = CookedMagic;
+            Header.Version = CookedVersion;
+            Header.StringCount = static_cast<uint32_t>(Strings.size());
+            Header.TypeCount = static_cast<uint32_t>(Types.size());
+            Header.ObjectCount = static_cast<uint32_t>(Objects.size());
+            Header.IndexCount = static_cast<uint32_t>(Indices.size());
+            Header.StringDataSize = static_cast<uint32_t>(StringData.size());
+            Header.BlockDataSize = static_cast<uint32_t>(Blocks.size());
+            std::vector<uint8_t> data;
+            data.reserve(sizeof(Header) + Strings.size() * sizeof(CookedFile::StringRecord) +
+                         Types.size() * sizeof(CookedFile::TypeRecord) +
+                         Objects.size() * sizeof(CookedFile::ObjectRecord) + Indices.size() * sizeof(uint32_t) +
+                         StringData.size() + Blocks.size());
+            AppendArray(data, &Header, 1);
+            AppendArray(data, Strings.data(), Strings.size());
+            AppendArray(data, Types.data(), Types.size());
+            AppendArray(data, Objects.data(), Objects.size());
+            AppendArray(data, Indices.data(), Indices.size());
+            AppendArray(data, StringData.data(), StringData.size());
+            AppendArray(data, Blocks.data(), Blocks.size());
+            return data;
+        }
+
+    private:
+        bool AddObject(const rapidjson::Value& Json)
+        {
+            if (!Json.IsObject())
+            {
+                spdlog::warn("{0} contains a value that isn't an object, it's left uncooked.", Path);
+                return false;
+            }
+            const auto type = Json.FindMember("type");
+            if (type == Json.MemberEnd() || !type->value.IsString())
+            {
+                spdlog::warn("{0} contains an object without a type, it's left uncooked.", Path);
+                return false;
+            }
+            if (type->value.GetString() != Engine::Entity::TypeName)
+            {
+                return AddRecord(Json, type->value, CookedFile::ObjectKind::Component);
+            }
+
+            /*transforms are members of their entities, they're stored right after them*/
+            const auto transform = Json.FindMember("transform");
+            if (transform == Json.MemberEnd() || !transform->value.IsObject())
+            {
+                spdlog::warn("{0} contains an entity without a transform, it's left uncooked.", Path);
+                return false;
+            }
+            const auto transformType = transform->value.FindMember("type");
+            if (transformType == transform->value.MemberEnd() || !transformType->value.IsString())
+            {
+                spdlog::warn("{0} contains a transform without a type, it's left uncooked.", Path);
+                return false;
+            }
+            return AddRecord(Json, type->value, CookedFile::ObjectKind::Entity) &&
+                   AddRecord(transform->value, transformType->value, CookedFile::ObjectKind::EntityTransform);
+        }
+
+        bool AddRecord(const rapidjson::Value& Json, const rapidjson::Value& TypeName,
+                       const CookedFile::ObjectKind Kind)
+        {
+            const uint32_t type = AddType(TypeName);
+            if (type == CookedFile::None)
+            {
+                return false;
+            }
+            CookedFile::ObjectRecord record = {};
+            record.Type = type;
+            record.Kind = Kind;
+            record.Owner = CookedFile::None;
+            Serialization::Deserialize(Json, "id", record.Id);
+            if (!record.Id.IsNull())
+            {
+                ObjectIndices.emplace(record.Id, static_cast<uint32_t>(Objects.size()));
+            }
+            Objects.push_back(record);
+            Sources.push_back(&Json);
+            return true;
+        }
+
+        uint32_t AddType(const rapidjson::Value& TypeName)
+        {
+            const std::string_view name(TypeName.GetString(), TypeName.GetStringLength());
+            if (const auto iterator = TypeIndices.find(name); iterator != TypeIndices.end())
+            {
+                return iterator->second;
+            }
+            const auto* builder = Serialization::SerializedObjectFactory::FindBuilder(std::string(name));
+            if (builder == nullptr)
+            {
+                spdlog::warn("{0} contains an object of unknown type {1}, it's left uncooked.", Path, name);
+                return CookedFile::None;
+            }
+            const Serialization::ClassReflection* reflection = builder->GetReflection();
+            const auto index = static_cast<uint32_t>(Types.size());
+            const uint32_t layoutHash = reflection != nullptr ? reflection->GetLayoutHash() : 0;
+            Types.push_back(CookedFile::TypeRecord{Intern(name), layoutHash});
+            Reflections.push_back(reflection);
+            Defaults.emplace_back(UseDefaults && reflection != nullptr ? builder->Build() : nullptr);
+            /*views point into the source document, which outlives the writer*/
+            TypeIndices.emplace(name, index);
+            return index;
+        }
+
+        bool WriteObjects()
+        {
+            for (size_t i = 0; i < Objects.size(); ++i)
+            {
+                CookedFile::ObjectRecord& record = Objects[i];
+                const rapidjson::Value& json = *Sources[i];
+                record.FirstIndex = static_cast<uint32_t>(Indices.size());
+                if (record.Kind == CookedFile::ObjectKind::Entity)
+                {
+                    WriteEntity(json);
+                    continue;
+                }
+
+                if (record.Kind == CookedFile::ObjectKind::EntityTransform)
+                {
+                    record.Owner = static_cast<uint32_t>(i - 1);
+                }
+                else if (const auto owner = json.FindMember("owner"); owner != json.MemberEnd())
+                {
+                    record.Owner = FindObject(owner->value, CookedFile::ObjectKind::Entity);
+                }
+
+                const Serialization::ClassReflection* reflection = Reflections[record.Type];
+                if (reflection == nullptr)
+                {
+                    continue;
+                }
+                record.BlockOffset = static_cast<uint32_t>(Blocks.size());
+                const Serialization::SerializedObject* defaults = Defaults[record.Type].get();
+                if (!ConvertToBinary(json, *reflection, Blocks,
+                                     defaults != nullptr ? defaults->GetReflectedFields() : nullptr))
+                {
+                    spdlog::warn("{0} contains an object of type {1} with missing or mistyped fields, it's left "
+                                 "uncooked.", Path, GetString(Types[record.Type].Name));
+                    return false;
+                }
+                record.BlockSize = static_cast<uint32_t>(Blocks.size()) - record.BlockOffset;
+                WriteReferences(json, *reflection);
+            }
+            return true;
+        }
+
+        void WriteReferences(const rapidjson::Value& Json, const Serialization::ClassReflection& Reflection)
+        {
+            for (const Serialization::FieldInfo& reference : Reflection.GetReferences())
+            {
+                const auto member = Json.FindMember(rapidjson::StringRef(reference.Name, reference.NameLength));
+                if (!reference.IsList)
+                {
+                    /*a missing reference is cleared, like ReadReferences does*/
+                    Indices.push_back(member != Json.MemberEnd() ? FindObject(member->value) : CookedFile::None);
+                    continue;
+                }
+
+                const size_t size = Indices.size();
+                Indices.push_back(0);
+                if (member != Json.MemberEnd() && member->value.IsArray())
+                {
+                    for (const rapidjson::Value& id : member->value.GetArray())
+                    {
+                        if (const uint32_t index = FindObject(id); index != CookedFile::None)
+                        {
+                            Indices.push_back(index);
+                        }
+                    }
+                }
+                Indices[size] = static_cast<uint32_t>(Indices.size() - size - 1);
+            }
+        }
+
+        void WriteEntity(const rapidjson::Value& Json)
+        {
+            Indices.push_back(InternMember(Json, "name"));
+            Indices.push_back(InternMember(Json, "prefab"));
+
+            size_t size = Indices.size();
+            Indices.push_back(0);
+            if (const auto tags = Json.FindMember("tags"); tags != Json.MemberEnd() && tags->value.IsArray())
+            {
+                for (const rapidjson::Value& tag : tags->value.GetArray())
+                {
+                    if (tag.IsString())
+                    {
+                        Indices.push_back(Intern(std::string_view(tag.GetString(), tag.GetStringLength())));
+                    }
+                }
+            }
+            Indices[size] = static_cast<uint32_t>(Indices.size() - size - 1);
+
+            size = Indices.size();
+            Indices.push_back(0);
+            if (const auto components = Json.FindMember("components");
+                components != Json.MemberEnd() && components->value.IsArray())
+            {
+                for (const rapidjson::Value& id : components->value.GetArray())
+                {
+                    if (const uint32_t index = FindObject(id, CookedFile::ObjectKind::Component);
+                        index != CookedFile::None)
+                    {
+                        Indices.push_back(index);
+                    }
+                }
+            }
+            Indices[size] = static_cast<uint32_t>(Indices.size() - size - 1);
+        }
+
+        /**
+         * @brief Returns index of an object by its id, None if no object has it.
+         */
+        [[nodiscard]] uint32_t FindObject(const rapidjson::Value& Id) const
+        {
+            Utility::Guid guid;
+            Serialization::Deserialize(Id, guid);
+            const auto iterator = ObjectIndices.find(guid);
+            return iterator != ObjectIndices.end() ? iterator->second : CookedFile::None;
+        }
+
+        /**
+         * @brief Returns index of an object of a kind by its id, None if no object of the kind has it.
+         */
+        [[nodiscard]] uint32_t FindObject(const rapidjson::Value& Id, const CookedFile::ObjectKind Kind) const
+        {
+            const uint32_t index = FindObject(Id);
+            return index != CookedFile::None && Objects[index].Kind == Kind ? index : CookedFile::None;
+        }
+
+        uint32_t InternMember(const rapidjson::Value& Object, const char* const Name)
+        {
+            const auto member = Object.FindMember(Name);
+            if (member == Object.MemberEnd() || !member->value.IsString())
+            {
+                return CookedFile::None;
+            }
+            return Intern(std::string_view(member->value.GetString(), member->value.GetStringLength()));
+        }
+
+        uint32_t Intern(const std::string_view String)
+        {
+            const auto iterator = StringIndices.find(String);
+            if (iterator != StringIndices.end())
+            {
+                return iterator->second;
+            }
+            const auto index = static_cast<uint32_t>(Strings.size());
+            Strings.push_back(CookedFile::StringRecord{static_cast<uint32_t>(StringData.size()),
+                                                       static_cast<uint32_t>(String.size())});
+            StringData.append(String);
+            /*views point into the source document, which outlives the writer*/
+            StringIndices.emplace(String, index);
+            return index;
+        }
+
+        [[nodiscard]] std::string_view GetString(const uint32_t Index) const
+        {
+            return std::string_view(StringData).substr(Strings[Index].Offset, Strings[Index].Length);
+        }
+
+        template<typename T>
+        static void AppendArray(std::vector<uint8_t>& Data, const T* Values, const size_t Count)
+        {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(Values);
+            Data.insert(Data.end(), bytes, bytes + Count * sizeof(T));
+        }
+    };
+
+    /**
+     * @brief Copies an array of records out of a mapping or buffer, where they may be unaligned.
+     * @param Offset Position of the array, it's advanced past it.
+     * @return False if the data is too short.
+     */
+    template<typename T>
+    bool ReadArray(const std::span<const uint8_t> Data, size_t& Offset, const uint32_t Count, std::vector<T>& Target)
+    {
+        const size_t size = static_cast<size_t>(Count) * sizeof(T);
+        if (Offset + size > Data.size())
+        {
+            return false;
+        }
+        Target.resize(Count);
+        std::memcpy(Target.data(), Data.data() + Offset, size);
+        Offset += size;
+        return true;
+    }
+}
+
+namespace Serialization
+{
+    CookedFile::CookedFile() = default;
+
+    CookedFile::CookedFile(CookedFile&& Other) noexcept = default;
+
+    CookedFile& CookedFile::operator=(CookedFile&& Other) noexcept = default;
+
+    CookedFile::~CookedFile() = default;
+
+    bool CookedFile::Read(const char* const CookedPath)
+    {
+        ZoneScoped;
+        *this = CookedFile();
+        auto file = std::make_unique<Utility::MappedFile>(CookedPath);
+        if (!file->IsOpen() || !Parse(std::span(file->GetData(), file->GetSize()), CookedPath))
+        {
+            return false;
+        }
+        File = std::move(file);
+        return true;
+    }
+
+    bool CookedFile::Read(std::vector<uint8_t>&& Data, const char* const Name)
+    {
+        ZoneScoped;
+        *this = CookedFile();
+        if (!Parse(Data, Name))
+        {
+            return false;
+        }
+        /*moving the vector keeps its storage, so parsed pointers stay valid*/
+        Memory = std::move(Data);
+        return true;
+    }
+
+    bool CookedFile::Parse(const std::span<const uint8_t> Data, const char* const Name)
+    {
+        if (Data.size() < sizeof(CookedHeader))
+        {
+            return false;
+        }
+
+        CookedHeader header;
+        std::memcpy(&header, Data.data(), sizeof(header));
+        if (header.Magic != CookedMagic || header.Version != CookedVersion)
+        {
+            return false;
+        }
+
+        size_t offset = sizeof(CookedHeader);
+        std::vector<TypeRecord> types;
+        if (!ReadArray(Data, offset, header.StringCount, Strings) ||
+            !ReadArray(Data, offset, header.TypeCount, types) ||
+            !ReadArray(Data, offset, header.ObjectCount, Objects) ||
+            !ReadArray(Data, offset, header.IndexCount, Indices) ||
+            offset + header.StringDataSize + header.BlockDataSize > Data.size())
+        {
+            return false;
+        }
+        StringData = reinterpret_cast<const char*>(Data.data() + offset);
+        BlockData = Data.data() + offset + header.StringDataSize;
+
+        for (const StringRecord& string : Strings)
+        {
+            if (static_cast<size_t>(string.Offset) + string.Length > header.StringDataSize)
+            {
+                return false;
+            }
+        }
+        /*types are looked up by name once per file, objects refer to them by index*/
+        Types.reserve(types.size());
+        for (const TypeRecord& type : types)
+        {
+            if (type.Name >= Strings.size())
+            {
+                return false;
+            }
+            const std::string name(GetString(type.Name));
+            const auto* builder = SerializedObjectFactory::FindBuilder(name);
+            const ClassReflection* reflection = builder != nullptr ? builder->GetReflection() : nullptr;
+            if (builder == nullptr || (reflection != nullptr ? reflection->GetLayoutHash() : 0) != type.LayoutHash)
+            {
+                spdlog::warn("Cooked file {0} has outdated type {1}, cook it again.", Name, name);
+                return false;
+            }
+            Types.push_back(ResolvedType{builder, reflection});
+        }
+
+        const auto isString = [this](const uint32_t Index)
+        {
+            return Index == None || Index < Strings.size();
+        };
+        if (!isString(header.Ui) || !isString(header.GameMode) || !isString(header.Player) ||
+            static_cast<size_t>(header.SettingsOffset) + header.SettingsSize > header.BlockDataSize ||
+            (header.IsScene != 0 && (Objects.empty() || Objects[0].Kind != ObjectKind::Entity)) ||
+            !Validate(header.BlockDataSize))
+        {
+            spdlog::warn("Cooked file {0} is corrupted.", Name);
+            return false;
+        }
+        IsSceneFlag = header.IsScene != 0;
+        Settings = SceneSettings{header.Ui, header.GameMode, header.Player,
+                                 std::span(BlockData + header.SettingsOffset, header.SettingsSize)};
+        return true;
+    }
+
+    bool CookedFile::Validate(const uint32_t BlockDataSize) const
+    {
+        const uint32_t count = GetObjectCount();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const ObjectRecord& record = Objects[i];
+            if (record.Type >= Types.size() || record.Kind > ObjectKind::EntityTransform ||
+                static_cast<size_t>(record.BlockOffset) + record.BlockSize > BlockDataSize ||
+                (record.Owner != None && (record.Owner >= count || Objects[record.Owner].Kind != ObjectKind::Entity)))
+            {
+                return false;
+            }
+            /*entities and their transforms are created together*/
+            if ((record.Kind == ObjectKind::Entity && (i + 1 >= count ||
+                                                       Objects[i + 1].Kind != ObjectKind::EntityTransform)) ||
+                (record.Kind == ObjectKind::EntityTransform && (i == 0 || Objects[i - 1].Kind != ObjectKind::Entity)))
+            {
+                return false;
+            }
+
+            size_t next = record.FirstIndex;
+            const auto take = [this, &next](uint32_t& Value)
+            {
+                if (next >= Indices.size())
+                {
+                    return false;
+                }
+                Value = Indices[next++];
+                return true;
+            };
+            uint32_t value;
+            uint32_t size;
+            if (record.Kind == ObjectKind::Entity)
+            {
+                for (uint32_t j = 0; j < 2; ++j)
+                {
+                    if (!take(value) || (value != None && value >= Strings.size()))
+                    {
+                        return false;
+                    }
+                }
+                if (!take(size))
+                {
+                    return false;
+                }
+                for (uint32_t j = 0; j < size; ++j)
+                {
+                    if (!take(value) || value >= Strings.size())
+                    {
+                        return false;
+                    }
+                }
+                if (!take(size))
+                {
+                    return false;
+                }
+                for (uint32_t j = 0; j < size; ++j)
+                {
+                    if (!take(value) || value >= count || Objects[value].Kind != ObjectKind::Component)
+                    {
+                        return false;
+                    }
+                }
+                continue;
+            }
+
+            const ClassReflection* reflection = Types[record.Type].Reflection;
+            if (reflection == nullptr)
+            {
+                continue;
+            }
+            for (const FieldInfo& reference : reflection->GetReferences())
+            {
+                size = 1;
+                if (reference.IsList && !take(size))
+                {
+                    return false;
+                }
+                for (uint32_t j = 0; j < size; ++j)
+                {
+                    if (!take(value) || (value != None && value >= count))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    bool CookedFile::ReadValues(const uint32_t Index, SerializedObject* const Object) const
+    {
+        const ObjectRecord& record = Objects[Index];
+        Object->SetId(record.Id);
+        const ClassReflection* reflection = Types[record.Type].Reflection;
+        if (reflection == nullptr || record.Kind == ObjectKind::Entity)
+        {
+            return true;
+        }
+        std::span<const uint8_t> block(BlockData + record.BlockOffset, record.BlockSize);
+        return ReadBinary(block, Object->GetReflectedFields(), *reflection);
+    }
+
+    void CookedFile::ResolveReferences(const uint32_t Index, const std::span<SerializedObject* const> Created) const
+    {
+        const ObjectRecord& record = Objects[Index];
+        const ClassReflection* reflection = Types[record.Type].Reflection;
+        if (reflection == nullptr || record.Kind == ObjectKind::Entity)
+        {
+            return;
+        }
+        void* const fields = Created[Index]->GetReflectedFields();
+        const uint32_t* index = Indices.data() + record.FirstIndex;
+        for (const FieldInfo& reference : reflection->GetReferences())
+        {
+            const uint32_t size = reference.IsList ? *index++ : 1;
+            for (uint32_t i = 0; i < size; ++i, ++index)
+            {
+                reference.SetReference(reference.Get(fields), *index != None ? Created[*index] : nullptr);
+            }
+        }
+    }
+
+    CookedFile::EntityData CookedFile::GetEntity(const uint32_t Index) const
+    {
+        const uint32_t* data = Indices.data() + Objects[Index].FirstIndex;
+        const uint32_t tagCount = data[2];
+        const uint32_t componentCount = data[3 + tagCount];
+        return EntityData{data[0], data[1], std::span(data + 3, tagCount),
+                          std::span(data + 4 + tagCount, componentCount)};
+    }
+
+    std::string GetCookedPath(const std::string& SourcePath)
+    {
+        return SourcePath + ".cooked";
+    }
+
+    bool CookJsonFile(const char* const SourcePath, const char* const CookedPath)
+    {
+        ZoneScoped;
+        rapidjson::Document document;
+        ReadJsonFile(SourcePath, document);
+
+        CookedWriter writer(SourcePath, false);
+        const bool isPrefab = document.IsObject() && document.HasMember("Prefab");
+        if (!document.IsObject() || !(isPrefab ? writer.WritePrefab(document) : writer.WriteScene(document)))
+        {
+            /*a cooked file of an older version of the json file isn't loaded either way, it's removed regardless*/
+            std::error_code error;
+            std::filesystem::remove(CookedPath, error);
+            return false;
+        }
+
+        std::ofstream stream(CookedPath, std::ios::binary);
+        if (!stream)
+        {
+            spdlog::error("Failed to write cooked file {0}.", CookedPath);
+            return false;
+        }
+        const std::vector<uint8_t> data = writer.Save();
+        stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return true;
+    }
+
+    bool CookJson(const rapidjson::Value& Document, const char* const Name, CookedFile& Target)
+    {
+        ZoneScoped;
+        CookedWriter writer(Name, true);
+        const bool isPrefab = Document.IsObject() && Document.HasMember("Prefab");
+        if (!Document.IsObject() || !(isPrefab ? writer.WritePrefab(Document) : writer.WriteScene(Document)))
+        {
+            return false;
+        }
+        return Target.Read(writer.Save(), Name);
+    }
+
+    size_t CookDirectory(const char* const Directory)
+    {
+        size_t cooked = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(Directory))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+            const std::filesystem::path& path = entry.path();
+            if (path.extension() != ".lvl" && path.extension() != ".prefab")
+            {
+                continue;
+            }
+            const std::string source = path.string();
+            if (CookJsonFile(source.c_str(), GetCookedPath(source).c_str()))
+            {
+                spdlog::info("Cooked {0}.", source);
+                ++cooked;
+            }
+        }
+        return cooked;
+    }
+
+    bool ReadCookedFile(const std::string& SourcePath, CookedFile& Target)
+    {
+        const std::string cookedPath = GetCookedPath(SourcePath);
+        std::error_code error;
+        const auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+        if (error)
+        {
+            return false;
+        }
+        const auto sourceTime = std::filesystem::last_write_time(SourcePath, error);
+        return (error || cookedTime >= sourceTime) && Target.Read(cookedPath.c_str());
+    }
+} // Serialization
@@ -0,0 +1,260 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SerializedObjectFactory.h"
+#include "Utility/GuidUtility.h"
+
+namespace Utility
+{
+    class MappedFile;
+}
+
+namespace Serialization
+{
+    /**
+     * @brief Scene or prefab in the binary cooked format, read through a memory mapping or cooked in memory.
+     * Every object is stored as a block of its reflected fields in the layout of WriteBinary and objects refer
+     * to each other by their position in the file, so loading them requires no parsing and no lookups by name or id.
+     * Types are resolved and layouts of their fields validated once, when the file is read.
+     */
+    class CookedFile final
+    {
+    public:
+        /*marks a missing reference, owner or string*/
+        static constexpr uint32_t None = UINT32_MAX;
+
+        enum class ObjectKind : uint32_t
+        {
+            Component,
+            Entity,
+            /*transform of the entity stored right before it*/
+            EntityTransform
+        };
+
+        /**
+         * @brief Data of an entity that isn't reflected, strings are indices for GetString.
+         */
+        struct EntityData
+        {
+            uint32_t Name;
+            uint32_t Prefab;
+            std::span<const uint32_t> Tags;
+            /*object indices, in order of the entity's components*/
+            std::span<const uint32_t> Components;
+        };
+
+        /**
+         * @brief Settings of a cooked scene, types of the ui, game mode and player are indices for GetString.
+         */
+        struct SceneSettings
+        {
+            uint32_t Ui;
+            uint32_t GameMode;
+            uint32_t Player;
+            /*fields of Scene::GetStaticReflection, read with ReadBinary*/
+            std::span<const uint8_t> Fields;
+        };
+
+        /*records below are stored in the file as they are*/
+        struct StringRecord
+        {
+            uint32_t Offset;
+            uint32_t Length;
+        };
+
+        struct TypeRecord
+        {
+            uint32_t Name;
+            uint32_t LayoutHash;
+        };
+
+        struct ObjectRecord
+        {
+            uint32_t Type;
+            ObjectKind Kind;
+            /*entity of a component*/
+            uint32_t Owner;
+            uint32_t BlockOffset;
+            uint32_t BlockSize;
+            /*first index of references of this object, or of the data of an entity, in Indices*/
+            uint32_t FirstIndex;
+            Utility::Guid Id;
+        };
+
+    private:
+        struct ResolvedType
+        {
+            const SerializedObjectFactory::ISerializedObjectBuilder* Builder;
+            /*nullptr for classes without reflected fields*/
+            const ClassReflection* Reflection;
+        };
+
+    private:
+        std::unique_ptr<Utility::MappedFile> File;
+        /*data of files cooked in memory, see CookJson*/
+        std::vector<uint8_t> Memory;
+        bool IsSceneFlag = false;
+        std::vector<StringRecord> Strings;
+        std::vector<ResolvedType> Types;
+        std::vector<ObjectRecord> Objects;
+        /*references are object indices, lists are preceded by their size, see GetEntity for entities*/
+        std::vector<uint32_t> Indices;
+        const char* StringData = nullptr;
+        const uint8_t* BlockData = nullptr;
+        SceneSettings Settings = {None, None, None, {}};
+
+    public:
+        CookedFile();
+
+        CookedFile(CookedFile&& Other) noexcept;
+
+        CookedFile& operator=(CookedFile&& Other) noexcept;
+
+        ~CookedFile();
+
+    public:
+        /**
+         * @brief Maps a file written by CookJsonFile and validates it.
+         * @param CookedPath File to read.
+         * @return False if the file doesn't exist, has an unsupported version, is corrupted or was cooked
+         * with different types or fields than the running build has.
+         */
+        bool Read(const char* CookedPath);
+
+        /**
+         * @brief Takes data in the layout of a cooked file and validates it.
+         * @param Data Cooked data, kept by the file.
+         * @param Name Name of the data in warnings.
+         * @return False under the same conditions as reading a file.
+         */
+        bool Read(std::vector<uint8_t>&& Data, const char* Name);
+
+        [[nodiscard]] bool IsOpen() const
+        {
+            return File != nullptr || !Memory.empty();
+        }
+
+        /**
+         * @brief Checks whether the file is a scene, its first object is the scene root then.
+         */
+        [[nodiscard]] bool IsScene() const
+        {
+            return IsSceneFlag;
+        }
+
+        [[nodiscard]] uint32_t GetObjectCount() const
+        {
+            return static_cast<uint32_t>(Objects.size());
+        }
+
+        [[nodiscard]] ObjectKind GetKind(const uint32_t Index) const
+        {
+            return Objects[Index].Kind;
+        }
+
+        /**
+         * @brief Returns entity of a component, None if it has none.
+         */
+        [[nodiscard]] uint32_t GetOwner(const uint32_t Index) const
+        {
+            return Objects[Index].Owner;
+        }
+
+        [[nodiscard]] std::string_view GetString(const uint32_t Index) const
+        {
+            return std::string_view(StringData + Strings[Index].Offset, Strings[Index].Length);
+        }
+
+        [[nodiscard]] const SceneSettings& GetSceneSettings() const
+        {
+            return Settings;
+        }
+
+        /**
+         * @brief Creates an object of the type stored at an index. Transforms of entities aren't built.
+         */
+        [[nodiscard]] SerializedObject* Build(const uint32_t Index) const
+        {
+            return Types[Objects[Index].Type].Builder->Build();
+        }
+
+        /**
+         * @brief Sets id and reflected fields of an object. Can run on any thread.
+         * @param Index Index of the object in the file.
+         * @param Object Object created for the index.
+         * @return False if the field block is corrupted, fields may be partially read then.
+         */
+        bool ReadValues(uint32_t Index, SerializedObject* Object) const;
+
+        /**
+         * @brief Sets reflected references of an object.
+         * @param Index Index of the object in the file.
+         * @param Created Objects created for the file, in order of the file.
+         */
+        void ResolveReferences(uint32_t Index, std::span<SerializedObject* const> Created) const;
+
+        /**
+         * @brief Returns name, prefab, tags and components of an entity.
+         * @param Index Index of an object of the Entity kind.
+         */
+        [[nodiscard]] EntityData GetEntity(uint32_t Index) const;
+
+    private:
+        /**
+         * @brief Reads records of cooked data and resolves its types, strings and blocks are referenced in place.
+         */
+        bool Parse(std::span<const uint8_t> Data, const char* Name);
+
+        /**
+         * @brief Checks that objects refer only to records, indices and blocks present in the file.
+         */
+        [[nodiscard]] bool Validate(uint32_t BlockDataSize) const;
+    };
+
+    /**
+     * @brief Returns path of the cooked version of a json file.
+     * @param SourcePath Path of the json file.
+     */
+    [[nodiscard]] std::string GetCookedPath(const std::string& SourcePath);
+
+    /**
+     * @brief Converts a scene or prefab file to the binary cooked format, see CookedFile.
+     * Field blocks are converted from json directly, no objects are created.
+     * @param SourcePath File to read json from.
+     * @param CookedPath File to write cooked data to.
+     * @return False if the file wasn't written, e.g. because an object misses fields or has an unknown type.
+     * The json file is loaded instead then.
+     */
+    bool CookJsonFile(const char* SourcePath, const char* CookedPath);
+
+    /**
+     * @brief Converts a parsed scene or prefab to the binary cooked format in memory.
+     * Unlike CookJsonFile, fields missing in json take values of a default object of their type, like they do
+     * when json is deserialized.
+     * @param Document Content of a scene or prefab file.
+     * @param Name Name of the content in warnings.
+     * @param Target File to read the cooked data to.
+     * @return False if an object has an unknown type or mistyped fields.
+     */
+    bool CookJson(const rapidjson::Value& Document, const char* Name, CookedFile& Target);
+
+    /**
+     * @brief Cooks every scene (.lvl) and prefab (.prefab) file in a directory and its subdirectories.
+     * @param Directory Directory to search.
+     * @return Number of cooked files.
+     */
+    size_t CookDirectory(const char* Directory);
+
+    /**
+     * @brief Reads the cooked version of a json file if it exists and is not older than the json file.
+     * @param SourcePath Path of the json file.
+     * @param Target File to read to.
+     * @return False if the json file has to be read instead.
+     */
+    bool ReadCookedFile(const std::string& SourcePath, CookedFile& Target);
+} // Serialization
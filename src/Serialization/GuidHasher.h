@@ -1,19 +1,26 @@
 #pragma once
-#pragma comment(lib, "Rpcrt4.lib")
-#include <windows.h>
-#include <rpc.h>
+#include <cstdint>
+#include <cstring>
+
+#include "Utility/GuidUtility.h"
 
 namespace Serialization
 {
     /**
      * @brief Used to generate hashes from Guid.
+     * Generated Guids are random already, the halves are only mixed so that hand written ones spread as well.
      */
     struct GuidHasher
     {
-        size_t operator()(const GUID& Guid) const
+        size_t operator()(const Utility::Guid& Guid) const
         {
-            RPC_STATUS status;
-            return UuidHash(&const_cast<GUID&>(Guid), &status);
+            uint64_t halves[2];
+            std::memcpy(halves, &Guid, sizeof(halves));
+            uint64_t hash = halves[0] ^ (halves[1] * 0x9E3779B97F4A7C15ull);
+            hash ^= hash >> 32;
+            hash *= 0xD6E8FEB86659FD93ull;
+            hash ^= hash >> 32;
+            return static_cast<size_t>(hash);
         }
     };
 } // Serialization
@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "GuidHasher.h"
+
+namespace Serialization
+{
+    class SerializedObject;
+
+    /**
+     * @brief Maps ids of deserialized objects to the objects, used to resolve references.
+     * Open addressing with linear probing in a single array, so lookups touch one or two cache lines.
+     */
+    class ReferenceTable final
+    {
+    private:
+        struct Slot
+        {
+            Utility::Guid Id;
+            /*nullptr marks an empty slot*/
+            SerializedObject* Object = nullptr;
+        };
+
+    private:
+        std::vector<Slot> Slots;
+        size_t Count = 0;
+
+    public:
+        ReferenceTable() = default;
+
+        /**
+         * @brief Constructs a table able to hold given number of objects without growing.
+         */
+        explicit ReferenceTable(const size_t Capacity)
+        {
+            Reserve(Capacity);
+        }
+
+    public:
+        /**
+         * @brief Makes room for given number of objects.
+         */
+        void Reserve(const size_t Capacity)
+        {
+            /*keeps load factor at most 0.5*/
+            size_t slotCount = 16;
+            while (slotCount < Capacity * 2)
+            {
+                slotCount *= 2;
+            }
+            if (slotCount > Slots.size())
+            {
+                Rehash(slotCount);
+            }
+        }
+
+        /**
+         * @brief Adds an object. Does nothing if an object with the same id was added before.
+         * @param Id Id the object was serialized with.
+         * @param Object Deserialized object.
+         */
+        void Add(const Utility::Guid& Id, SerializedObject* const Object)
+        {
+            if ((Count + 1) * 2 > Slots.size())
+            {
+                Rehash(Slots.empty() ? 16 : Slots.size() * 2);
+            }
+            Slot& slot = FindSlot(Id);
+            if (slot.Object == nullptr)
+            {
+                slot = Slot{Id, Object};
+                ++Count;
+            }
+        }
+
+        /**
+         * @brief Adds all objects of another table, used to combine tables filled on different threads.
+         * @param Other Table to copy objects from.
+         */
+        void Merge(const ReferenceTable& Other)
+        {
+            Reserve(Count + Other.Count);
+            for (const Slot& slot : Other.Slots)
+            {
+                if (slot.Object != nullptr)
+                {
+                    Add(slot.Id, slot.Object);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns object added with given id or nullptr if there is none.
+         */
+        [[nodiscard]] SerializedObject* Find(const Utility::Guid& Id) const
+        {
+            if (Slots.empty())
+            {
+                return nullptr;
+            }
+            return const_cast<ReferenceTable*>(this)->FindSlot(Id).Object;
+        }
+
+        [[nodiscard]] size_t GetSize() const
+        {
+            return Count;
+        }
+
+    private:
+        Slot& FindSlot(const Utility::Guid& Id)
+        {
+            const size_t mask = Slots.size() - 1;
+            for (size_t i = GuidHasher()(Id) & mask;; i = (i + 1) & mask)
+            {
+                if (Slots[i].Object == nullptr || Slots[i].Id == Id)
+                {
+                    return Slots[i];
+                }
+            }
+        }
+
+        void Rehash(const size_t SlotCount)
+        {
+            std::vector<Slot> old(SlotCount);
+            old.swap(Slots);
+            for (const Slot& slot : old)
+            {
+                if (slot.Object != nullptr)
+                {
+                    FindSlot(slot.Id) = slot;
+                }
+            }
+        }
+    };
+} // Serialization
@@ -0,0 +1,524 @@
+#include "Reflection.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+namespace
+{
+    constexpr uint32_t FnvOffsetBasis = 2166136261u;
+    constexpr uint32_t FnvPrime = 16777619u;
+
+    uint32_t HashBytes(uint32_t Hash, const void* const Bytes, const size_t Size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(Bytes);
+        for (size_t i = 0; i < Size; ++i)
+        {
+            Hash = (Hash ^ bytes[i]) * FnvPrime;
+        }
+        return Hash;
+    }
+
+    /**
+     * @brief Reads float components named by single letters, all of them have to be present.
+     */
+    bool ReadComponents(const rapidjson::Value& Vector, const std::string_view Names, float* Components)
+    {
+        if (!Vector.IsObject())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < Names.size(); ++i)
+        {
+            bool found = false;
+            for (const auto& member : Vector.GetObject())
+            {
+                if (member.name.GetStringLength() == 1 && member.name.GetString()[0] == Names[i])
+                {
+                    if (!member.value.IsFloat())
+                    {
+                        return false;
+                    }
+                    Components[i] = member.value.GetFloat();
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reads a field from its json value, with the same rules as Deserialize overloads of its type.
+     * @return False if the value has a different type and the field was left unchanged, resources always succeed.
+     */
+    bool ReadField(const rapidjson::Value& Value, const rapidjson::Value& Object,
+                   const Serialization::FieldInfo& Field, void* const Data)
+    {
+        float components[4];
+        switch (Field.Type)
+        {
+        case Serialization::FieldType::Bool:
+            if (!Value.IsBool())
+            {
+                return false;
+            }
+            *static_cast<bool*>(Data) = Value.GetBool();
+            return true;
+        case Serialization::FieldType::Int:
+        case Serialization::FieldType::Enum:
+        {
+            if (!Value.IsInt())
+            {
+                return false;
+            }
+            const int value = Value.GetInt();
+            std::memcpy(Data, &value, sizeof(value));
+            return true;
+        }
+        case Serialization::FieldType::Float:
+            if (!Value.IsFloat())
+            {
+                return false;
+            }
+            *static_cast<float*>(Data) = Value.GetFloat();
+            return true;
+        case Serialization::FieldType::Vec2:
+            if (!ReadComponents(Value, "xy", components))
+            {
+                return false;
+            }
+            *static_cast<glm::vec2*>(Data) = glm::vec2(components[0], components[1]);
+            return true;
+        case Serialization::FieldType::Vec3:
+            if (!ReadComponents(Value, "xyz", components))
+            {
+                return false;
+            }
+            *static_cast<glm::vec3*>(Data) = glm::vec3(components[0], components[1], components[2]);
+            return true;
+        case Serialization::FieldType::Vec4:
+            if (!ReadComponents(Value, "xyzw", components))
+            {
+                return false;
+            }
+            *static_cast<glm::vec4*>(Data) = glm::vec4(components[0], components[1], components[2], components[3]);
+            return true;
+        case Serialization::FieldType::Quat:
+        {
+            if (!ReadComponents(Value, "xyzw", components))
+            {
+                return false;
+            }
+            auto* quat = static_cast<glm::quat*>(Data);
+            quat->x = components[0];
+            quat->y = components[1];
+            quat->z = components[2];
+            quat->w = components[3];
+            return true;
+        }
+        case Serialization::FieldType::String:
+            if (!Value.IsString())
+            {
+                return false;
+            }
+            static_cast<std::string*>(Data)->assign(Value.GetString(), Value.GetStringLength());
+            return true;
+        case Serialization::FieldType::Resource:
+            Field.Read(Object, Field.Name, Data);
+            return true;
+        case Serialization::FieldType::Reference:
+            return false;
+        }
+        return false;
+    }
+
+    bool IsPlainValue(const Serialization::FieldType Type)
+    {
+        return Type != Serialization::FieldType::String && Type != Serialization::FieldType::Resource &&
+               Type != Serialization::FieldType::Reference;
+    }
+
+    void AppendBytes(std::vector<uint8_t>& Buffer, const void* const Bytes, const size_t Size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(Bytes);
+        Buffer.insert(Buffer.end(), bytes, bytes + Size);
+    }
+
+    /**
+     * @brief Appends a field of an object in the layout of WriteBinary.
+     * @param Json Reused buffer for resources, which are stored as json.
+     */
+    void AppendField(std::vector<uint8_t>& Buffer, const Serialization::FieldInfo& Field, const void* const Data,
+                     rapidjson::MemoryPoolAllocator<>& Allocator, rapidjson::StringBuffer& Json)
+    {
+        if (IsPlainValue(Field.Type))
+        {
+            AppendBytes(Buffer, Data, Field.Size);
+            return;
+        }
+
+        std::string_view bytes;
+        if (Field.Type == Serialization::FieldType::String)
+        {
+            bytes = *static_cast<const std::string*>(Data);
+        }
+        else
+        {
+            /*resources are stored as json, they're reloaded by path*/
+            Json.Clear();
+            rapidjson::Writer<rapidjson::StringBuffer> writer(Json);
+            Field.Write(Data, Allocator).Accept(writer);
+            bytes = std::string_view(Json.GetString(), Json.GetSize());
+        }
+        const auto length = static_cast<uint32_t>(bytes.size());
+        AppendBytes(Buffer, &length, sizeof(length));
+        AppendBytes(Buffer, bytes.data(), bytes.size());
+    }
+
+    bool TakeBytes(std::span<const uint8_t>& Buffer, void* const Bytes, const size_t Size)
+    {
+        if (Buffer.size() < Size)
+        {
+            return false;
+        }
+        std::memcpy(Bytes, Buffer.data(), Size);
+        Buffer = Buffer.subspan(Size);
+        return true;
+    }
+}
+
+namespace Serialization
+{
+    ClassReflection::ClassReflection(const std::initializer_list<FieldInfo> Fields) :
+        LayoutHash(FnvOffsetBasis)
+    {
+        for (const FieldInfo& field : Fields)
+        {
+            if (field.Type == FieldType::Reference)
+            {
+                References.push_back(field);
+            }
+            else
+            {
+                this->Fields.push_back(field);
+                HasStateFlag |= field.Type != FieldType::Resource;
+            }
+            if (field.IsRuntime)
+            {
+                continue;
+            }
+            LayoutHash = HashBytes(LayoutHash, field.Name, field.NameLength);
+            LayoutHash = HashBytes(LayoutHash, &field.Type, sizeof(field.Type));
+            LayoutHash = HashBytes(LayoutHash, &field.Size, sizeof(field.Size));
+        }
+    }
+
+    void WriteFields(const void* const Data, const ClassReflection& Reflection, rapidjson::Value& Object,
+                     rapidjson::Document::AllocatorType& Allocator)
+    {
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            if (field.IsRuntime)
+            {
+                continue;
+            }
+            Object.AddMember(rapidjson::StringRef(field.Name, field.NameLength),
+                             field.Write(field.Get(Data), Allocator), Allocator);
+        }
+    }
+
+    void WriteReferences(const void* const Data, const ClassReflection& Reflection, rapidjson::Value& Object,
+                         rapidjson::Document::AllocatorType& Allocator)
+    {
+        for (const FieldInfo& reference : Reflection.GetReferences())
+        {
+            Object.AddMember(rapidjson::StringRef(reference.Name, reference.NameLength),
+                             reference.Write(reference.Get(Data), Allocator), Allocator);
+        }
+    }
+
+    rapidjson::Value WriteObject(const SerializedObject& Object, const SerializedObject* const Owner,
+                                 rapidjson::Document::AllocatorType& Allocator)
+    {
+        rapidjson::Value object(rapidjson::kObjectType);
+        object.AddMember("type", Serialize(Object.GetType(), Allocator), Allocator);
+        object.AddMember("id", Serialize(Object.GetID(), Allocator), Allocator);
+        object.AddMember("owner", Serialize(Owner, Allocator), Allocator);
+        WriteFields(Object.GetReflectedFields(), *Object.GetReflection(), object, Allocator);
+        WriteReferences(Object.GetReflectedFields(), *Object.GetReflection(), object, Allocator);
+        return object;
+    }
+
+    void ReadObjectValues(const rapidjson::Value& Json, SerializedObject& Object, ReferenceTable& ReferenceMap)
+    {
+        Utility::Guid id;
+        Deserialize(Json, "id", id);
+        Object.SetId(id);
+        ReadFields(Json, Object.GetReflectedFields(), *Object.GetReflection());
+        ReferenceMap.Add(id, &Object);
+    }
+
+    void ReadReferences(const rapidjson::Value& Json, void* const Data, const ClassReflection& Reflection,
+                        ReferenceTable& ReferenceMap)
+    {
+        for (const FieldInfo& reference : Reflection.GetReferences())
+        {
+            void* const field = reference.Get(Data);
+            const auto member = Json.FindMember(rapidjson::StringRef(reference.Name, reference.NameLength));
+            SerializedObject* object = nullptr;
+            if (!reference.IsList)
+            {
+                if (member != Json.MemberEnd())
+                {
+                    Deserialize(member->value, object, ReferenceMap);
+                }
+                reference.SetReference(field, object);
+                continue;
+            }
+
+            if (member == Json.MemberEnd() || !member->value.IsArray())
+            {
+                continue;
+            }
+            for (const rapidjson::Value& id : member->value.GetArray())
+            {
+                Deserialize(id, object, ReferenceMap);
+                reference.SetReference(field, object);
+            }
+        }
+    }
+
+    void ReadFields(const rapidjson::Value& Object, void* const Data, const ClassReflection& Reflection)
+    {
+        const std::span<const FieldInfo> fields = Reflection.GetFields();
+        if (fields.empty() || !Object.IsObject())
+        {
+            return;
+        }
+
+        /*members written by WriteFields match the field after the previous match on the first comparison*/
+        size_t next = 0;
+        for (const auto& member : Object.GetObject())
+        {
+            const char* name = member.name.GetString();
+            const uint32_t length = member.name.GetStringLength();
+            for (size_t checked = 0; checked < fields.size(); ++checked)
+            {
+                const size_t index = next + checked < fields.size() ? next + checked : next + checked - fields.size();
+                const FieldInfo& field = fields[index];
+                if (field.NameLength == length && !field.IsRuntime && std::memcmp(field.Name, name, length) == 0)
+                {
+                    ReadField(member.value, Object, field, field.Get(Data));
+                    next = index + 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    bool ConvertToBinary(const rapidjson::Value& Object, const ClassReflection& Reflection,
+                         std::vector<uint8_t>& Buffer, const void* const Defaults)
+    {
+        if (!Object.IsObject())
+        {
+            return false;
+        }
+        const uint32_t hash = Reflection.GetLayoutHash();
+        AppendBytes(Buffer, &hash, sizeof(hash));
+
+        rapidjson::MemoryPoolAllocator<> allocator;
+        rapidjson::StringBuffer json;
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            if (field.IsRuntime)
+            {
+                continue;
+            }
+            const auto member = Object.FindMember(rapidjson::StringRef(field.Name, field.NameLength));
+            if (member == Object.MemberEnd())
+            {
+                if (Defaults == nullptr)
+                {
+                    return false;
+                }
+                AppendField(Buffer, field, field.Get(Defaults), allocator, json);
+                continue;
+            }
+            if (IsPlainValue(field.Type))
+            {
+                /*large enough for every plain type, vec4 and quat are the largest*/
+                alignas(glm::vec4) uint8_t value[sizeof(glm::vec4)];
+                if (field.Size > sizeof(value) || !ReadField(member->value, Object, field, value))
+                {
+                    return false;
+                }
+                AppendBytes(Buffer, value, field.Size);
+                continue;
+            }
+
+            std::string_view bytes;
+            if (field.Type == FieldType::String)
+            {
+                if (!member->value.IsString())
+                {
+                    return false;
+                }
+                bytes = std::string_view(member->value.GetString(), member->value.GetStringLength());
+            }
+            else
+            {
+                json.Clear();
+                rapidjson::Writer<rapidjson::StringBuffer> writer(json);
+                member->value.Accept(writer);
+                bytes = std::string_view(json.GetString(), json.GetSize());
+            }
+            const auto length = static_cast<uint32_t>(bytes.size());
+            AppendBytes(Buffer, &length, sizeof(length));
+            AppendBytes(Buffer, bytes.data(), bytes.size());
+        }
+        return true;
+    }
+
+    void WriteBinary(const void* const Data, const ClassReflection& Reflection, std::vector<uint8_t>& Buffer)
+    {
+        const uint32_t hash = Reflection.GetLayoutHash();
+        AppendBytes(Buffer, &hash, sizeof(hash));
+
+        rapidjson::MemoryPoolAllocator<> allocator;
+        rapidjson::StringBuffer json;
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            if (field.IsRuntime)
+            {
+                continue;
+            }
+            AppendField(Buffer, field, field.Get(Data), allocator, json);
+        }
+    }
+
+    bool ReadBinary(std::span<const uint8_t>& Buffer, void* const Data, const ClassReflection& Reflection)
+    {
+        uint32_t hash;
+        if (!TakeBytes(Buffer, &hash, sizeof(hash)) || hash != Reflection.GetLayoutHash())
+        {
+            return false;
+        }
+
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            if (field.IsRuntime)
+            {
+                continue;
+            }
+            void* const fieldData = field.Get(Data);
+            if (IsPlainValue(field.Type))
+            {
+                if (!TakeBytes(Buffer, fieldData, field.Size))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            uint32_t length;
+            if (!TakeBytes(Buffer, &length, sizeof(length)) || Buffer.size() < length)
+            {
+                return false;
+            }
+            const auto* bytes = reinterpret_cast<const char*>(Buffer.data());
+            Buffer = Buffer.subspan(length);
+            if (field.Type == FieldType::String)
+            {
+                static_cast<std::string*>(fieldData)->assign(bytes, length);
+                continue;
+            }
+
+            rapidjson::Document document;
+            document.Parse(bytes, length);
+            if (document.HasParseError())
+            {
+                return false;
+            }
+            rapidjson::Value object(rapidjson::kObjectType);
+            object.AddMember(rapidjson::StringRef(field.Name, field.NameLength),
+                             static_cast<rapidjson::Value&>(document), document.GetAllocator());
+            field.Read(object, field.Name, fieldData);
+        }
+        return true;
+    }
+
+    void WriteState(const void* const Data, const ClassReflection& Reflection, std::vector<uint8_t>& Buffer)
+    {
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            const void* const fieldData = field.Get(Data);
+            if (IsPlainValue(field.Type))
+            {
+                AppendBytes(Buffer, fieldData, field.Size);
+            }
+            else if (field.Type == FieldType::String)
+            {
+                const auto& string = *static_cast<const std::string*>(fieldData);
+                const auto length = static_cast<uint32_t>(string.size());
+                AppendBytes(Buffer, &length, sizeof(length));
+                AppendBytes(Buffer, string.data(), string.size());
+            }
+        }
+    }
+
+    bool ReadState(std::span<const uint8_t>& Buffer, void* const Data, const ClassReflection& Reflection)
+    {
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            void* const fieldData = field.Get(Data);
+            if (IsPlainValue(field.Type))
+            {
+                if (!TakeBytes(Buffer, fieldData, field.Size))
+                {
+                    return false;
+                }
+            }
+            else if (field.Type == FieldType::String)
+            {
+                uint32_t length;
+                if (!TakeBytes(Buffer, &length, sizeof(length)) || Buffer.size() < length)
+                {
+                    return false;
+                }
+                static_cast<std::string*>(fieldData)->assign(reinterpret_cast<const char*>(Buffer.data()), length);
+                Buffer = Buffer.subspan(length);
+            }
+        }
+        return true;
+    }
+
+    void CopyFields(const void* const Source, void* const Destination, const ClassReflection& Reflection)
+    {
+        for (const FieldInfo& field : Reflection.GetFields())
+        {
+            field.Copy(field.Get(Source), field.Get(Destination));
+        }
+    }
+
+    uint64_t DiffFields(const void* const First, const void* const Second, const ClassReflection& Reflection)
+    {
+        const std::span<const FieldInfo> fields = Reflection.GetFields();
+        uint64_t mask = 0;
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            if (!fields[i].Equals(fields[i].Get(First), fields[i].Get(Second)))
+            {
+                mask |= uint64_t(1) << std::min<size_t>(i, 63);
+            }
+        }
+        return mask;
+    }
+} // Serialization
@@ -0,0 +1,389 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SerializationUtility.h"
+#include "SerializedObject.h"
+
+/**
+ * @brief Defines the reflection table of a class from a list of SERIALIZATION_FIELD.
+ * Fields are serialized in order of the list, references to other objects are listed with SERIALIZATION_REFERENCE.
+ */
+#define SERIALIZATION_REFLECTION(__CLASS__, ...)\
+    const Serialization::ClassReflection& __CLASS__::GetStaticReflection()\
+    {\
+        using ReflectedClass [[maybe_unused]] = __CLASS__;\
+        static const Serialization::ClassReflection reflection({__VA_ARGS__});\
+        return reflection;\
+    }
+
+/**
+ * @brief Defines the reflection table of a class declared with SERIALIZATION_EXPORT_REFLECTED_CLASS
+ * and its Serialize, DeserializeValuePass and DeserializeReferencesPass, which read and write only the listed fields.
+ * Classes saving anything else use SERIALIZATION_REFLECTION and write these functions with WriteObject,
+ * ReadObjectValues and ReadReferences.
+ */
+#define SERIALIZATION_FIELDS(__CLASS__, ...)\
+    SERIALIZATION_REFLECTION(__CLASS__, __VA_ARGS__)\
+    rapidjson::Value __CLASS__::Serialize(rapidjson::Document::AllocatorType& Allocator) const\
+    {\
+        return Serialization::WriteObject(*this, GetOwner(), Allocator);\
+    }\
+    void __CLASS__::DeserializeValuePass(const rapidjson::Value& Object, Serialization::ReferenceTable& ReferenceMap)\
+    {\
+        Serialization::ReadObjectValues(Object, *this, ReferenceMap);\
+    }\
+    void __CLASS__::DeserializeReferencesPass(const rapidjson::Value& Object,\
+                                              Serialization::ReferenceTable& ReferenceMap)\
+    {\
+        START_COMPONENT_DESERIALIZATION_REFERENCES_PASS\
+        Serialization::ReadReferences(Object, GetReflectedFields(), GetStaticReflection(), ReferenceMap);\
+        END_COMPONENT_DESERIALIZATION_REFERENCES_PASS\
+    }
+
+/**
+ * @brief Returns address of a field within ReflectedClass.
+ */
+#define SERIALIZATION_FIELD_ACCESS(__NAME__)\
+    [](void* Object) -> void* { return &static_cast<ReflectedClass*>(Object)->__NAME__; }
+
+/**
+ * @brief Describes a field of ReflectedClass, nested fields like Settings.SpawnRate are allowed.
+ */
+#define SERIALIZATION_FIELD(__NAME__)\
+    Serialization::MakeField<decltype(std::declval<ReflectedClass&>().__NAME__)>(#__NAME__,\
+                                                                                 SERIALIZATION_FIELD_ACCESS(__NAME__))
+
+/**
+ * @brief Describes a field that isn't saved to files, only to in-memory state like scene snapshots.
+ */
+#define SERIALIZATION_RUNTIME_FIELD(__NAME__)\
+    Serialization::MakeField<decltype(std::declval<ReflectedClass&>().__NAME__)>(#__NAME__,\
+                                                                                 SERIALIZATION_FIELD_ACCESS(__NAME__),\
+                                                                                 true)
+
+/**
+ * @brief Describes a pointer or a vector of pointers to other serialized objects.
+ * Field codecs skip references, json stores them as guids and cooked files as indices of the referenced objects.
+ */
+#define SERIALIZATION_REFERENCE(__NAME__)\
+    Serialization::MakeReference<decltype(std::declval<ReflectedClass&>().__NAME__)>(\
+            #__NAME__, SERIALIZATION_FIELD_ACCESS(__NAME__))
+
+namespace Serialization
+{
+    class SerializedObject;
+
+    enum class FieldType : uint8_t
+    {
+        Bool,
+        Int,
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Quat,
+        String,
+        Enum,
+        /*any other type, it's serialized with its Serialize and Deserialize overloads*/
+        Resource,
+        /*pointer or vector of pointers to other objects, described by SERIALIZATION_REFERENCE*/
+        Reference
+    };
+
+    /**
+     * @brief Name, type and accessor of a field of a class, with functions handling its type.
+     */
+    struct FieldInfo
+    {
+        const char* Name;
+        uint32_t NameLength;
+        FieldType Type;
+        /*returns address of the field within an object given by GetReflectedFields*/
+        void* (*Access)(void* Object);
+        uint32_t Size;
+        /*runtime fields are skipped by json and binary files*/
+        bool IsRuntime;
+        rapidjson::Value (*Write)(const void* Field, rapidjson::Document::AllocatorType& Allocator);
+        /*finds the field by name in Object, only resources are read this way*/
+        void (*Read)(const rapidjson::Value& Object, const char* Name, void* Field);
+        void (*Copy)(const void* Source, void* Destination);
+        bool (*Equals)(const void* First, const void* Second);
+        /*references only, whether the field is a vector of pointers*/
+        bool IsList;
+        /*references only, assigns a pointer or appends to a vector, nullptr and objects of other types aren't*/
+        void (*SetReference)(void* Field, SerializedObject* Object);
+        /*references only, appends the referenced objects, a pointer is appended even if it's nullptr*/
+        void (*CollectReferences)(const void* Field, std::vector<SerializedObject*>& Objects);
+
+        [[nodiscard]] void* Get(void* const Object) const
+        {
+            return Access(Object);
+        }
+
+        [[nodiscard]] const void* Get(const void* const Object) const
+        {
+            return Access(const_cast<void*>(Object));
+        }
+    };
+
+    /**
+     * @brief Fields and references of a class and a hash of their names and types, used to validate binary data.
+     */
+    class ClassReflection
+    {
+    private:
+        std::vector<FieldInfo> Fields;
+        std::vector<FieldInfo> References;
+        uint32_t LayoutHash;
+        /*whether any field is written by WriteState*/
+        bool HasStateFlag = false;
+
+    public:
+        explicit ClassReflection(std::initializer_list<FieldInfo> Fields);
+
+    public:
+        [[nodiscard]] std::span<const FieldInfo> GetFields() const
+        {
+            return Fields;
+        }
+
+        [[nodiscard]] std::span<const FieldInfo> GetReferences() const
+        {
+            return References;
+        }
+
+        [[nodiscard]] uint32_t GetLayoutHash() const
+        {
+            return LayoutHash;
+        }
+
+        [[nodiscard]] bool HasState() const
+        {
+            return HasStateFlag;
+        }
+    };
+
+    template<typename T>
+    constexpr FieldType GetFieldType()
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return FieldType::Bool;
+        else if constexpr (std::is_same_v<T, int>)
+            return FieldType::Int;
+        else if constexpr (std::is_same_v<T, float>)
+            return FieldType::Float;
+        else if constexpr (std::is_same_v<T, glm::vec2>)
+            return FieldType::Vec2;
+        else if constexpr (std::is_same_v<T, glm::vec3>)
+            return FieldType::Vec3;
+        else if constexpr (std::is_same_v<T, glm::vec4>)
+            return FieldType::Vec4;
+        else if constexpr (std::is_same_v<T, glm::quat>)
+            return FieldType::Quat;
+        else if constexpr (std::is_same_v<T, std::string>)
+            return FieldType::String;
+        else if constexpr (std::is_enum_v<T> && sizeof(T) == sizeof(int))
+            return FieldType::Enum;
+        else
+            return FieldType::Resource;
+    }
+
+    template<typename T>
+    FieldInfo MakeField(const char* const Name, void* (*const Access)(void*), const bool IsRuntime = false)
+    {
+        FieldInfo field;
+        field.Name = Name;
+        field.NameLength = static_cast<uint32_t>(std::char_traits<char>::length(Name));
+        field.Type = GetFieldType<T>();
+        field.Access = Access;
+        field.Size = static_cast<uint32_t>(sizeof(T));
+        field.IsRuntime = IsRuntime;
+        field.Write = [](const void* Field, rapidjson::Document::AllocatorType& Allocator)
+        {
+            return Serialize(*static_cast<const T*>(Field), Allocator);
+        };
+        field.Read = [](const rapidjson::Value& Object, const char* Name, void* Field)
+        {
+            Deserialize(Object, Name, *static_cast<T*>(Field));
+        };
+        field.Copy = [](const void* Source, void* Destination)
+        {
+            *static_cast<T*>(Destination) = *static_cast<const T*>(Source);
+        };
+        field.Equals = [](const void* First, const void* Second)
+        {
+            if constexpr (std::equality_comparable<T>)
+            {
+                return *static_cast<const T*>(First) == *static_cast<const T*>(Second);
+            }
+            else
+            {
+                rapidjson::MemoryPoolAllocator<> allocator;
+                return Serialize(*static_cast<const T*>(First), allocator) ==
+                       Serialize(*static_cast<const T*>(Second), allocator);
+            }
+        };
+        field.IsList = false;
+        field.SetReference = nullptr;
+        field.CollectReferences = nullptr;
+        return field;
+    }
+
+    template<typename T>
+    FieldInfo MakeReference(const char* const Name, void* (*const Access)(void*))
+    {
+        FieldInfo field;
+        field.Name = Name;
+        field.NameLength = static_cast<uint32_t>(std::char_traits<char>::length(Name));
+        field.Type = FieldType::Reference;
+        field.Access = Access;
+        field.Size = static_cast<uint32_t>(sizeof(T));
+        field.IsRuntime = false;
+        field.Write = [](const void* Field, rapidjson::Document::AllocatorType& Allocator)
+        {
+            return Serialize(*static_cast<const T*>(Field), Allocator);
+        };
+        field.Read = nullptr;
+        field.Copy = nullptr;
+        field.Equals = nullptr;
+        if constexpr (std::is_pointer_v<T>)
+        {
+            static_assert(std::is_base_of_v<SerializedObject, std::remove_pointer_t<T>>,
+                          "References have to point to serialized objects.");
+            field.IsList = false;
+            field.SetReference = [](void* Field, SerializedObject* Object)
+            {
+                *static_cast<T*>(Field) = dynamic_cast<T>(Object);
+            };
+            field.CollectReferences = [](const void* Field, std::vector<SerializedObject*>& Objects)
+            {
+                Objects.push_back(*static_cast<const T*>(Field));
+            };
+        }
+        else
+        {
+            using Pointee = std::remove_pointer_t<typename T::value_type>;
+            static_assert(std::is_pointer_v<typename T::value_type> && std::is_base_of_v<SerializedObject, Pointee>,
+                          "References have to be pointers to serialized objects.");
+            field.IsList = true;
+            field.SetReference = [](void* Field, SerializedObject* Object)
+            {
+                if (auto* const object = dynamic_cast<Pointee*>(Object))
+                {
+                    static_cast<T*>(Field)->push_back(object);
+                }
+            };
+            field.CollectReferences = [](const void* Field, std::vector<SerializedObject*>& Objects)
+            {
+                const T& references = *static_cast<const T*>(Field);
+                Objects.insert(Objects.end(), references.begin(), references.end());
+            };
+        }
+        return field;
+    }
+
+    /**
+     * @brief Adds every field to a json object.
+     * @param Data Start of the reflected object.
+     * @param Reflection Fields of the object.
+     * @param Object Json object to add fields to.
+     * @param Allocator Allocator of Object.
+     */
+    void WriteFields(const void* Data, const ClassReflection& Reflection, rapidjson::Value& Object,
+                     rapidjson::Document::AllocatorType& Allocator);
+
+    /**
+     * @brief Adds every reference to a json object as guids of the referenced objects.
+     */
+    void WriteReferences(const void* Data, const ClassReflection& Reflection, rapidjson::Value& Object,
+                         rapidjson::Document::AllocatorType& Allocator);
+
+    /**
+     * @brief Saves type, id, owner, fields and references of a reflected object to a json object.
+     * @param Object Object to save.
+     * @param Owner Entity owning the object.
+     * @param Allocator Allocator to be used.
+     * @return Serialized object.
+     */
+    rapidjson::Value WriteObject(const SerializedObject& Object, const SerializedObject* Owner,
+                                 rapidjson::Document::AllocatorType& Allocator);
+
+    /**
+     * @brief Reads id and fields of a reflected object and adds it to ReferenceMap, the value pass of WriteObject.
+     */
+    void ReadObjectValues(const rapidjson::Value& Json, SerializedObject& Object, ReferenceTable& ReferenceMap);
+
+    /**
+     * @brief Resolves references of a json object, a missing reference is cleared and lists are appended to.
+     * @param Json Json object to read guids from.
+     * @param Data Start of the reflected object.
+     * @param Reflection Fields of the object.
+     * @param ReferenceMap Objects loaded in the value pass.
+     */
+    void ReadReferences(const rapidjson::Value& Json, void* Data, const ClassReflection& Reflection,
+                        ReferenceTable& ReferenceMap);
+
+    /**
+     * @brief Reads fields from a json object in one pass over its members.
+     * Members are expected in the order they are written, other orders are slower but still read.
+     * Fields missing from Object or of a different type keep their values.
+     * @param Object Json object to read fields from.
+     * @param Data Start of the reflected object.
+     * @param Reflection Fields of the object.
+     */
+    void ReadFields(const rapidjson::Value& Object, void* Data, const ClassReflection& Reflection);
+
+    /**
+     * @brief Converts fields of a json object to the format of WriteBinary without creating the object.
+     * Used to cook files.
+     * @param Defaults Reflected fields of an object of the class, values of fields missing in json are taken from it.
+     * If nullptr, every field has to be present.
+     * @return False if a field is missing or has a different type.
+     */
+    bool ConvertToBinary(const rapidjson::Value& Object, const ClassReflection& Reflection,
+                         std::vector<uint8_t>& Buffer, const void* Defaults = nullptr);
+
+    /**
+     * @brief Appends fields to a buffer, preceded by the layout hash.
+     * Plain values are copied as bytes, strings and resources are prefixed with their length.
+     */
+    void WriteBinary(const void* Data, const ClassReflection& Reflection, std::vector<uint8_t>& Buffer);
+
+    /**
+     * @brief Reads fields written by WriteBinary.
+     * @param Buffer Data to read, it's advanced past the read object.
+     * @return False if data was written with a different layout or is too short, fields may be partially read then.
+     */
+    bool ReadBinary(std::span<const uint8_t>& Buffer, void* Data, const ClassReflection& Reflection);
+
+    /**
+     * @brief Appends in-memory state of fields to a buffer, including runtime fields.
+     * Resource fields are skipped, assigning them has side effects like renderer registration.
+     * The state is only valid within the running process, it isn't meant to be saved.
+     */
+    void WriteState(const void* Data, const ClassReflection& Reflection, std::vector<uint8_t>& Buffer);
+
+    /**
+     * @brief Reads state written by WriteState for the same class.
+     * @param Buffer Data to read, it's advanced past the read object.
+     * @return False if the buffer is too short.
+     */
+    bool ReadState(std::span<const uint8_t>& Buffer, void* Data, const ClassReflection& Reflection);
+
+    /**
+     * @brief Copies every field between two objects of the same class, references aren't copied.
+     */
+    void CopyFields(const void* Source, void* Destination, const ClassReflection& Reflection);
+
+    /**
+     * @brief Compares fields of two objects of the same class.
+     * @return Mask with a bit set for every different field, fields after the 64th share the last bit.
+     */
+    [[nodiscard]] uint64_t DiffFields(const void* First, const void* Second, const ClassReflection& Reflection);
+} // Serialization
@@ -1,6 +1,5 @@
 #include "SerializationFilesUtility.h"
 #include "rapidjson/filereadstream.h"
-#include "rapidjson/filewritestream.h"
 #include <rapidjson/prettywriter.h>
 #include <cstdio>
 
@@ -28,16 +27,32 @@ namespace Serialization
 #endif
     }
 
+    JsonOutputFile::JsonOutputFile(const char* const FilePath)
+    {
+        if (fopen_s(&File, FilePath, "wb") != 0)
+        {
+            File = nullptr;
+            return;
+        }
+        Buffer = std::make_unique<char[]>(BufferSize);
+        Stream.emplace(File, Buffer.get(), BufferSize);
+    }
+
+    JsonOutputFile::~JsonOutputFile()
+    {
+        if (File != nullptr)
+        {
+            Stream->Flush();
+            fclose(File);
+        }
+    }
+
     void WriteJsonFile(const char* FilePath, const rapidjson::Value& Object)
     {
-        FILE* file;
-        const int errorNumber = fopen_s(&file, FilePath, "wb");
-        assert(errorNumber == 0); //failed to write to file
-        char buffer[BufferSize];
-        rapidjson::FileWriteStream outputStream(file, buffer, sizeof(buffer));
-        rapidjson::PrettyWriter<rapidjson::FileWriteStream> writer(outputStream);
+        JsonOutputFile file(FilePath);
+        assert(file.IsOpen()); //failed to write to file
+        rapidjson::PrettyWriter<rapidjson::FileWriteStream> writer(file.GetStream());
 
         Object.Accept(writer);
-        fclose(file);
     }
 } // Serialization
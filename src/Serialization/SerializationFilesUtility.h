@@ -1,8 +1,52 @@
 #pragma once
+#include <cstdio>
+#include <memory>
+#include <optional>
+
 #include "rapidjson/document.h"
+#include "rapidjson/filewritestream.h"
 
 namespace Serialization
 {
+    /**
+     * @brief Buffered file json writers can write to as they produce output, without building a document first.
+     * Use with rapidjson::Writer for compact output or rapidjson::PrettyWriter for indented output.
+     */
+    class JsonOutputFile final
+    {
+    private:
+        FILE* File = nullptr;
+        std::unique_ptr<char[]> Buffer;
+        std::optional<rapidjson::FileWriteStream> Stream;
+
+    public:
+        /**
+         * @brief Opens a file for writing, replacing its content.
+         * @param FilePath File to write data to.
+         */
+        explicit JsonOutputFile(const char* FilePath);
+
+        /**
+         * @brief Flushes buffered output and closes the file.
+         */
+        ~JsonOutputFile();
+
+        JsonOutputFile(const JsonOutputFile&) = delete;
+
+        JsonOutputFile& operator=(const JsonOutputFile&) = delete;
+
+    public:
+        [[nodiscard]] bool IsOpen() const
+        {
+            return File != nullptr;
+        }
+
+        [[nodiscard]] rapidjson::FileWriteStream& GetStream()
+        {
+            return *Stream;
+        }
+    };
+
     /**
      * @brief Reads json data from a given file.
      * @param FilePath File to read data from.
@@ -1,8 +1,9 @@
 #include "SerializationUtility.h"
 
-#include <atlbase.h>
-#include <locale>
+#include <cstring>
+#include <utility>
 
+#include "Engine/EngineObjects/JobSystem.h"
 #include "Engine/Textures/Texture.h"
 #include "Engine/Textures/TextureManager.h"
 #include "Materials/MaterialManager.h"
@@ -15,23 +16,71 @@
 namespace
 {
     constexpr int GUID_STRING_SIZE = 39; // GUID is 36 chars + null terminator
+    /*positions of hex digit pairs in "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}", in order of Guid bytes
+      with Data1, Data2 and Data3 written big endian*/
+    constexpr int GuidDigitPairs[16] = {7, 5, 3, 1, 12, 10, 17, 15, 20, 22, 25, 27, 29, 31, 33, 35};
 
-    void GuidToStr(const GUID& Guid, char* Buffer)
+    void GuidToStr(const Utility::Guid& Guid, char* Buffer)
     {
-        snprintf(Buffer, GUID_STRING_SIZE * sizeof(char),
-                 "{%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x}",
-                 Guid.Data1, Guid.Data2, Guid.Data3,
-                 Guid.Data4[0], Guid.Data4[1], Guid.Data4[2], Guid.Data4[3],
-                 Guid.Data4[4], Guid.Data4[5], Guid.Data4[6], Guid.Data4[7]);
+        constexpr char digits[] = "0123456789abcdef";
+        std::memcpy(Buffer, "{00000000-0000-0000-0000-000000000000}", GUID_STRING_SIZE);
+        uint8_t bytes[16];
+        std::memcpy(bytes, &Guid, sizeof(bytes));
+        for (int i = 0; i < 16; ++i)
+        {
+            Buffer[GuidDigitPairs[i]] = digits[bytes[i] >> 4];
+            Buffer[GuidDigitPairs[i] + 1] = digits[bytes[i] & 0xF];
+        }
     }
 
-    void StrToGuid(const std::string& str, GUID* guid)
+    /**
+     * @brief Runs a function requesting resources right away on the main thread,
+     * on other threads it's queued until the main thread processes its jobs.
+     */
+    template<class TFunction>
+    void LoadOnMainThread(TFunction&& Function)
     {
-        sscanf_s(str.c_str(),
-                 "{%8x-%4hx-%4hx-%2hhx%2hhx-%2hhx%2hhx%2hhx%2hhx%2hhx%2hhx}",
-                 &guid->Data1, &guid->Data2, &guid->Data3,
-                 &guid->Data4[0], &guid->Data4[1], &guid->Data4[2], &guid->Data4[3],
-                 &guid->Data4[4], &guid->Data4[5], &guid->Data4[6], &guid->Data4[7]);
+        Engine::JobSystem* jobSystem = Engine::JobSystem::GetInstance();
+        if (jobSystem == nullptr || jobSystem->IsMainThread())
+        {
+            Function();
+        }
+        else
+        {
+            jobSystem->ScheduleOnMainThread(std::forward<TFunction>(Function));
+        }
+    }
+
+    int HexDigitValue(const char Digit)
+    {
+        if (Digit >= '0' && Digit <= '9')
+            return Digit - '0';
+        if (Digit >= 'a' && Digit <= 'f')
+            return Digit - 'a' + 10;
+        if (Digit >= 'A' && Digit <= 'F')
+            return Digit - 'A' + 10;
+        return -1;
+    }
+
+    bool StrToGuid(const char* const Str, const size_t Length, Utility::Guid* Guid)
+    {
+        if (Length < GUID_STRING_SIZE - 1)
+        {
+            return false;
+        }
+        uint8_t bytes[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            const int high = HexDigitValue(Str[GuidDigitPairs[i]]);
+            const int low = HexDigitValue(Str[GuidDigitPairs[i] + 1]);
+            if (high < 0 || low < 0)
+            {
+                return false;
+            }
+            bytes[i] = static_cast<uint8_t>(high << 4 | low);
+        }
+        std::memcpy(Guid, bytes, sizeof(bytes));
+        return true;
     }
 }
 
@@ -134,7 +183,7 @@ namespace Serialization
         return object;
     }
 
-    rapidjson::Value Serialize(const GUID& Guid, rapidjson::Document::AllocatorType& Allocator)
+    rapidjson::Value Serialize(const Utility::Guid& Guid, rapidjson::Document::AllocatorType& Allocator)
     {
         rapidjson::Value object(rapidjson::kStringType);
         char guidStr[GUID_STRING_SIZE];
@@ -151,7 +200,7 @@ namespace Serialization
             object.SetNull();
             return object;
         }
-        const GUID guid = Value->GetID();
+        const Utility::Guid guid = Value->GetID();
         char guidStr[GUID_STRING_SIZE];
         GuidToStr(guid, guidStr);
         object.SetString(guidStr, sizeof(guidStr), Allocator);
@@ -377,7 +426,10 @@ namespace Serialization
         {
             return;
         }
-        Value = Engine::TextureManager::GetTexture(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Engine::TextureManager::GetTexture(path.c_str());
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* const Name, Models::Model*& Value)
@@ -387,7 +439,10 @@ namespace Serialization
         {
             return;
         }
-        Value = Models::ModelManager::GetModel(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Models::ModelManager::GetModel(path.c_str());
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Models::ModelAnimated*& Value)
@@ -397,7 +452,10 @@ namespace Serialization
         {
             return;
         }
-        Value = Models::ModelManager::GetAnimatedModel(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Models::ModelManager::GetAnimatedModel(path.c_str());
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Models::Animation*& Value)
@@ -407,7 +465,10 @@ namespace Serialization
         {
             return;
         }
-        Value = Models::ModelManager::GetAnimation(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Models::ModelManager::GetAnimation(path.c_str());
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* const Name, std::string& Value)
@@ -420,55 +481,45 @@ namespace Serialization
         Value = iterator->value.GetString();
     }
 
-    void Deserialize(const rapidjson::Value& Object, const char* const Name, GUID& Value)
+    void Deserialize(const rapidjson::Value& Object, const char* const Name, Utility::Guid& Value)
     {
         const auto iterator = Object.FindMember(Name);
         if (iterator == Object.MemberEnd() || !iterator->value.IsString())
         {
             return;
         }
-        const std::string str = iterator->value.GetString();
-        StrToGuid(str, &Value);
+        StrToGuid(iterator->value.GetString(), iterator->value.GetStringLength(), &Value);
     }
 
-    void Deserialize(const rapidjson::Value& Object, const char* const Name, SerializedObject*& Value,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap)
+    void Deserialize(const rapidjson::Value& Object, Utility::Guid& Value)
     {
-        const auto guidIterator = Object.FindMember(Name);
-        if (guidIterator == Object.MemberEnd() || !guidIterator->value.IsString())
+        if (!Object.IsString() || !StrToGuid(Object.GetString(), Object.GetStringLength(), &Value))
         {
-            Value = nullptr;
-            return;
+            Value = Utility::Guid();
         }
-        const std::string str = guidIterator->value.GetString();
-        GUID guid;
-        StrToGuid(str, &guid);
-        const auto referenceIterator = ReferenceMap.find(guid);
-        if (referenceIterator == ReferenceMap.end())
-        {
-            Value = nullptr;
-            return;
-        }
-        Value = referenceIterator->second;
     }
 
-    void Deserialize(const rapidjson::Value& Object, SerializedObject*& Value,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap)
+    void Deserialize(const rapidjson::Value& Object, const char* const Name, SerializedObject*& Value,
+                     ReferenceTable& ReferenceMap)
     {
-        if (!Object.IsString())
+        const auto guidIterator = Object.FindMember(Name);
+        if (guidIterator == Object.MemberEnd())
         {
             Value = nullptr;
             return;
         }
-        GUID guid;
-        StrToGuid(Object.GetString(), &guid);
-        const auto referenceIterator = ReferenceMap.find(guid);
-        if (referenceIterator == ReferenceMap.end())
+        Deserialize(guidIterator->value, Value, ReferenceMap);
+    }
+
+    void Deserialize(const rapidjson::Value& Object, SerializedObject*& Value, ReferenceTable& ReferenceMap)
+    {
+        Utility::Guid guid;
+        if (!Object.IsString() || !StrToGuid(Object.GetString(), Object.GetStringLength(), &guid))
         {
             Value = nullptr;
             return;
         }
-        Value = referenceIterator->second;
+        Value = ReferenceMap.Find(guid);
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Shaders::Shader& Value)
@@ -500,8 +551,10 @@ namespace Serialization
         const std::string geometryPath = iteratorGeometry->value.GetString();
         const std::string fragmentPath = iteratorFragment->value.GetString();
 
-        const Shaders::ShaderSourceFiles sourceFiles(vertexPath, geometryPath, fragmentPath);
-        Value = Shaders::ShaderManager::GetShader(sourceFiles);
+        LoadOnMainThread([&Value, sourceFiles = Shaders::ShaderSourceFiles(vertexPath, geometryPath, fragmentPath)]
+        {
+            Value = Shaders::ShaderManager::GetShader(sourceFiles);
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Shaders::ComputeShader& Value)
@@ -512,7 +565,10 @@ namespace Serialization
             return;
         }
 
-        Value = Shaders::ShaderManager::GetComputeShader(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Shaders::ShaderManager::GetComputeShader(path.c_str());
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Materials::Material*& Value)
@@ -523,14 +579,23 @@ namespace Serialization
             return;
         }
 
-        Value = Materials::MaterialManager::GetMaterial(iterator->value.GetString());
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value = Materials::MaterialManager::GetMaterial(path);
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* const Name, Materials::TextureMaterialProperty& Value)
     {
-        Engine::Texture value = Value.GetValue();
-        Deserialize(Object, Name, value);
-        Value.SetValue(value);
+        const auto iterator = Object.FindMember(Name);
+        if (iterator == Object.MemberEnd() || !iterator->value.IsString())
+        {
+            return;
+        }
+        LoadOnMainThread([&Value, path = std::string(iterator->value.GetString())]
+        {
+            Value.SetValue(Engine::TextureManager::GetTexture(path.c_str()));
+        });
     }
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Models::AABBox3& Value)
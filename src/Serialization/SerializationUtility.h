@@ -2,7 +2,7 @@
 #include <glm/vec3.hpp>
 #include <string>
 
-#include "GuidHasher.h"
+#include "ReferenceTable.h"
 #include "rapidjson/document.h"
 #include "Materials/Material.h"
 #include "Materials/Properties/MaterialProperty.h"
@@ -56,7 +56,7 @@ namespace Serialization
 
     rapidjson::Value Serialize(const std::string& Value, rapidjson::Document::AllocatorType& Allocator);
 
-    rapidjson::Value Serialize(const GUID& Guid, rapidjson::Document::AllocatorType& Allocator);
+    rapidjson::Value Serialize(const Utility::Guid& Guid, rapidjson::Document::AllocatorType& Allocator);
 
     rapidjson::Value Serialize(const SerializedObject* Value, rapidjson::Document::AllocatorType& Allocator);
 
@@ -120,6 +120,10 @@ namespace Serialization
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, glm::vec2& Value);
 
+    /*
+     * Resources below need the OpenGL context. When deserialized outside of the main thread they are loaded
+     * and assigned to Value later, when the main thread runs JobSystem::ProcessMainThreadJobs.
+     */
     void Deserialize(const rapidjson::Value& Object, const char* Name, Engine::Texture& Value);
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Models::Model*& Value);
@@ -130,13 +134,18 @@ namespace Serialization
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, std::string& Value);
 
-    void Deserialize(const rapidjson::Value& Object, const char* Name, GUID& Value);
+    void Deserialize(const rapidjson::Value& Object, const char* Name, Utility::Guid& Value);
+
+    /**
+     * @brief Reads a guid from a json string, Value becomes the null Guid if Object isn't one.
+     */
+    void Deserialize(const rapidjson::Value& Object, Utility::Guid& Value);
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, SerializedObject*& Value,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap);
+                     ReferenceTable& ReferenceMap);
 
     void Deserialize(const rapidjson::Value& Object, SerializedObject*& Value,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap);
+                     ReferenceTable& ReferenceMap);
 
     void Deserialize(const rapidjson::Value& Object, const char* Name, Shaders::Shader& Value);
 
@@ -150,7 +159,7 @@ namespace Serialization
 
     template<class T>
     void Deserialize(const rapidjson::Value& Object, const char* const Name, T*& Value,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap)
+                     ReferenceTable& ReferenceMap)
     {
         // static_assert(std::is_base_of_v<SerializedObject, T>);
 
@@ -161,7 +170,7 @@ namespace Serialization
 
     template<class T>
     void Deserialize(const rapidjson::Value& Object, const char* const Name, std::vector<T*>& Values,
-                     std::unordered_map<GUID, SerializedObject*, GuidHasher>& ReferenceMap)
+                     ReferenceTable& ReferenceMap)
     {
         static_assert(std::is_base_of_v<SerializedObject, T>);
 
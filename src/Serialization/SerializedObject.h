@@ -2,12 +2,34 @@
 #include <string>
 #include <unordered_map>
 
-#include "GuidHasher.h"
+#include "ReferenceTable.h"
+#include "TypeIdRegistry.h"
 #include "Utility/GuidUtility.h"
+#include "Utility/ObjectPool.h"
 #include "rapidjson/document.h"
 #include "Serialization/SerializedObjectRaii.h" // Used in macros.
 
+/**
+ * @brief Gives a class its own TypeId, used for lookups that avoid dynamic_cast.
+ * Included in SERIALIZATION_EXPORT_CLASS, can be used alone in abstract classes.
+ */
+#define SERIALIZATION_EXPORT_TYPE_ID(__CLASS__)\
+public:\
+    using TypeIdClass = __CLASS__;\
+    [[nodiscard]] static Serialization::TypeId GetStaticTypeId()\
+    {\
+        static const Serialization::TypeId typeId = Serialization::TypeIdRegistry::Register<__CLASS__>(#__CLASS__);\
+        return typeId;\
+    }\
+    [[nodiscard]] Serialization::TypeId GetTypeId() const override\
+    {\
+        return GetStaticTypeId();\
+    }\
+    static inline const Serialization::TypeId TypeIdHandle = GetStaticTypeId();
+
 #define SERIALIZATION_EXPORT_CLASS(__CLASS__)\
+    SERIALIZATION_EXPORT_TYPE_ID(__CLASS__)\
+    POOLED_ALLOCATION(__CLASS__)\
 public:\
     inline static const std::string TypeName = std::string(#__CLASS__);\
     rapidjson::Value Serialize(rapidjson::Document::AllocatorType& Allocator) const override;\
@@ -19,6 +41,34 @@ public:\
     }\
     static inline const Serialization::SerializedObjectRaii<__CLASS__> RaiiHandle = Serialization::SerializedObjectRaii<__CLASS__>(#__CLASS__);
 
+/**
+ * @brief Declares the reflection table of a class, the table is defined with SERIALIZATION_REFLECTION
+ * from Reflection.h. Used alone by classes that aren't created from files.
+ */
+#define SERIALIZATION_EXPORT_FIELDS(__CLASS__)\
+public:\
+    [[nodiscard]] static const Serialization::ClassReflection& GetStaticReflection();\
+    [[nodiscard]] const Serialization::ClassReflection* GetReflection() const override\
+    {\
+        return &GetStaticReflection();\
+    }\
+    [[nodiscard]] const void* GetReflectedFields() const override\
+    {\
+        return static_cast<const __CLASS__*>(this);\
+    }\
+    [[nodiscard]] void* GetReflectedFields() override\
+    {\
+        return static_cast<__CLASS__*>(this);\
+    }
+
+/**
+ * @brief SERIALIZATION_EXPORT_CLASS of a class whose fields are listed once with SERIALIZATION_FIELDS
+ * from Reflection.h, which also defines its Serialize and deserialization passes.
+ */
+#define SERIALIZATION_EXPORT_REFLECTED_CLASS(__CLASS__)\
+    SERIALIZATION_EXPORT_CLASS(__CLASS__)\
+    SERIALIZATION_EXPORT_FIELDS(__CLASS__)
+
 #define START_COMPONENT_SERIALIZATION\
     rapidjson::Value object(rapidjson::kObjectType);\
     object.AddMember("type", Serialization::Serialize(TypeName, Allocator), Allocator);\
@@ -28,18 +78,18 @@ public:\
 #define END_COMPONENT_SERIALIZATION  return object;
 
 #define START_COMPONENT_DESERIALIZATION_VALUE_PASS\
-    GUID id;\
+    Utility::Guid id;\
     Serialization::Deserialize(Object, "id", id);\
     SetId(id);
 
-#define END_COMPONENT_DESERIALIZATION_VALUE_PASS   ReferenceMap.emplace(id, this);
+#define END_COMPONENT_DESERIALIZATION_VALUE_PASS   ReferenceMap.Add(id, this);
 
 #define START_COMPONENT_DESERIALIZATION_REFERENCES_PASS\
     Entity* owner;\
     Serialization::Deserialize(Object, "owner", owner, ReferenceMap);\
     SetOwner(owner);
 
-#define END_COMPONENT_DESERIALIZATION_REFERENCES_PASS
+#define END_COMPONENT_DESERIALIZATION_REFERENCES_PASS OnReferencesResolved();
 
 #define SERIALIZE_FIELD(__NAME__) object.AddMember(#__NAME__, Serialization::Serialize(__NAME__, Allocator), Allocator);
 
@@ -49,36 +99,33 @@ public:\
 
 namespace Serialization
 {
-    class SerializedObject;
-    /**
-     * @brief Used in serializing references.
-     */
-    typedef std::unordered_map<GUID, SerializedObject*, GuidHasher> ReferenceTable;
+    class ClassReflection;
+
     /**
     * @brief Class providing interface for object serialization.
     */
     class SerializedObject
     {
     private:
-        GUID Id;
+        /*generated on first use, most objects are deserialized and receive their id from data*/
+        mutable Utility::Guid Id;
 
     public:
         virtual ~SerializedObject() = default;
 
-        /**
-         * @brief Initializes object with guid.
-         */
-        SerializedObject() :
-            Id(Utility::GenerateGuid())
-        {
-        }
+        SerializedObject() = default;
 
     public:
         /**
-         * @brief Returns guid of this object.
+         * @brief Returns guid of this object, generating it if the object has none yet.
+         * Not thread safe for objects without an id.
          */
-        [[nodiscard]] GUID GetID() const
+        [[nodiscard]] Utility::Guid GetID() const
         {
+            if (Id.IsNull())
+            {
+                Id = Utility::GenerateGuid();
+            }
             return Id;
         }
 
@@ -86,11 +133,19 @@ namespace Serialization
          * @brief Sets id of this object.
          * @param Id A New id.
          */
-        void SetId(const GUID& Id)
+        void SetId(const Utility::Guid& Id)
         {
             this->Id = Id;
         }
 
+        /**
+         * @brief Discards id of this object, a new one is generated when it's needed.
+         */
+        void ResetId()
+        {
+            Id = Utility::Guid();
+        }
+
     public:
         /**
          * @brief Saves this object's state to a json object.
@@ -117,6 +172,51 @@ namespace Serialization
         * @brief Returns class name of this object.
         */
         [[nodiscard]] virtual std::string GetType() const = 0;
+
+        /**
+         * @brief Returns TypeId of this object's class or InvalidTypeId if it has none.
+         */
+        [[nodiscard]] virtual TypeId GetTypeId() const
+        {
+            return InvalidTypeId;
+        }
+
+        /**
+         * @brief Returns fields of this object's class or nullptr if they aren't reflected.
+         * Given by SERIALIZATION_EXPORT_REFLECTED_CLASS.
+         */
+        [[nodiscard]] virtual const ClassReflection* GetReflection() const
+        {
+            return nullptr;
+        }
+
+        /**
+         * @brief Returns address the offsets of reflected fields are relative to.
+         */
+        [[nodiscard]] virtual const void* GetReflectedFields() const
+        {
+            return nullptr;
+        }
+
+        [[nodiscard]] virtual void* GetReflectedFields()
+        {
+            return nullptr;
+        }
+
+        /**
+         * @brief Invoked after reflected fields of this object were overwritten in place, e.g. by a scene snapshot.
+         */
+        virtual void OnFieldsRestored()
+        {
+        }
+
+        /**
+         * @brief Invoked on the main thread once values and references of this object are loaded,
+         * at the end of the references pass or when the object is read from a cooked file.
+         */
+        virtual void OnReferencesResolved()
+        {
+        }
     };
 
 } // Serialization
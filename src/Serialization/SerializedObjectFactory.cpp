@@ -12,4 +12,11 @@ namespace Serialization
         }
         return iterator->second->Build();
     }
+
+    const SerializedObjectFactory::ISerializedObjectBuilder* SerializedObjectFactory::FindBuilder(
+            const std::string& TypeName)
+    {
+        const auto iterator = GetInstance()->Builders.find(TypeName);
+        return iterator != GetInstance()->Builders.end() ? iterator->second : nullptr;
+    }
 } // Engine
@@ -12,11 +12,12 @@ namespace Engine
 
 namespace Serialization
 {
+    class ClassReflection;
     class SerializedObject;
 
     class SerializedObjectFactory
     {
-    private:
+    public:
         class ISerializedObjectBuilder
         {
         public:
@@ -24,8 +25,14 @@ namespace Serialization
 
         public:
             [[nodiscard]] virtual SerializedObject* Build() const = 0;
+
+            /**
+             * @brief Returns reflected fields of the class or nullptr if it has none, without creating an object.
+             */
+            [[nodiscard]] virtual const ClassReflection* GetReflection() const = 0;
         };
 
+    private:
         template<class T>
         class SerializedObjectBuilder final : public ISerializedObjectBuilder
         {
@@ -34,6 +41,18 @@ namespace Serialization
             {
                 return new T();
             }
+
+            [[nodiscard]] const ClassReflection* GetReflection() const override
+            {
+                if constexpr (requires { T::GetStaticReflection(); })
+                {
+                    return &T::GetStaticReflection();
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
         };
 
     private:
@@ -90,6 +109,13 @@ namespace Serialization
          */
         static SerializedObject* CreateObject(const std::string& TypeName);
 
+        /**
+         * @brief Returns builder of a class, so objects of it can be created repeatedly without looking the name up.
+         * @param TypeName TypeName of the class.
+         * @return Found builder or nullptr if no class is registered under the name.
+         */
+        static const ISerializedObjectBuilder* FindBuilder(const std::string& TypeName);
+
 #if EDITOR
         /**
          * @brief Returns TypeNames of all available components.
@@ -0,0 +1,31 @@
+#include "TypeIdRegistry.h"
+
+#include "SerializedObject.h"
+
+namespace Serialization
+{
+    TypeMask TypeIdRegistry::GetMask(const SerializedObject* const Object)
+    {
+        std::vector<Entry>& entries = GetEntries();
+        const TypeId id = Object->GetTypeId();
+        if (id != InvalidTypeId && entries[id].Mask != 0)
+        {
+            return entries[id].Mask;
+        }
+
+        TypeMask mask = 0;
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i].IsInstance(Object))
+            {
+                mask |= TypeMask(1) << i;
+            }
+        }
+
+        if (id != InvalidTypeId)
+        {
+            entries[id].Mask = mask;
+        }
+        return mask;
+    }
+} // Serialization
@@ -0,0 +1,107 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Serialization
+{
+    class SerializedObject;
+
+    /**
+     * @brief Dense index of a class exported with SERIALIZATION_EXPORT_CLASS or SERIALIZATION_EXPORT_TYPE_ID.
+     */
+    typedef uint8_t TypeId;
+
+    /**
+     * @brief Set of TypeIds, bit n corresponds to TypeId n.
+     */
+    typedef uint64_t TypeMask;
+
+    constexpr TypeId InvalidTypeId = UINT8_MAX;
+    constexpr size_t MaxTypeIds = sizeof(TypeMask) * 8;
+
+    /**
+     * @brief True if T declares its own TypeId rather than inheriting one from a base class.
+     */
+    template<class T>
+    concept HasOwnTypeId = requires { typename T::TypeIdClass; } && std::is_same_v<typename T::TypeIdClass, T>;
+
+    /**
+     * @brief Assigns TypeIds to exported classes and tracks which of them every class derives from.
+     */
+    class TypeIdRegistry final
+    {
+    private:
+        typedef bool (*InstanceCheck)(const SerializedObject* Object);
+
+        struct Entry
+        {
+            std::string Name;
+            InstanceCheck IsInstance;
+            /*ids of all exported classes this class derives from, including itself, 0 until first needed*/
+            TypeMask Mask;
+        };
+
+    private:
+        TypeIdRegistry() = default;
+
+        static std::vector<Entry>& GetEntries()
+        {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+
+    public:
+        /**
+         * @brief Assigns a new TypeId. Called once per class by SERIALIZATION_EXPORT_TYPE_ID.
+         * @tparam T Class to register.
+         * @param Name Name of the class.
+         * @return Assigned TypeId.
+         */
+        template<class T>
+        static TypeId Register(const char* Name);
+
+        /**
+         * @brief Returns ids of all exported classes given object is an instance of.
+         * Computed once per class, later calls do not use RTTI.
+         * @param Object Object to check.
+         */
+        static TypeMask GetMask(const SerializedObject* Object);
+
+        /**
+         * @brief Returns number of registered classes.
+         */
+        static size_t GetCount()
+        {
+            return GetEntries().size();
+        }
+
+        /**
+         * @brief Returns name of a class with given TypeId.
+         */
+        static const std::string& GetName(const TypeId Id)
+        {
+            return GetEntries()[Id].Name;
+        }
+    };
+
+    template<class T>
+    TypeId TypeIdRegistry::Register(const char* Name)
+    {
+        std::vector<Entry>& entries = GetEntries();
+        assert(entries.size() < MaxTypeIds && "Too many exported classes, TypeMask has to be widened.");
+        if (entries.size() >= MaxTypeIds)
+        {
+            return InvalidTypeId;
+        }
+
+        const InstanceCheck isInstance = [](const SerializedObject* Object)
+        {
+            return dynamic_cast<const T*>(Object) != nullptr;
+        };
+        entries.push_back(Entry{Name, isInstance, 0});
+        return static_cast<TypeId>(entries.size() - 1);
+    }
+} // Serialization
@@ -3,6 +3,8 @@
 #include "glad/glad.h"
 #include "glm/glm.hpp"
 #include <glm/gtc/type_ptr.hpp>
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Engine/Rendering/GraphicsContext.h"
 
 namespace Shaders
 {
@@ -41,6 +43,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const GLfloat Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform1f(UniformId, Value);
         }
 
@@ -52,6 +55,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::vec2& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform2f(UniformId, Value.x, Value.y);
         }
 
@@ -63,6 +67,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::vec3& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform3f(UniformId, Value.x, Value.y, Value.z);
         }
 
@@ -74,6 +79,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::vec4& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform4f(UniformId, Value.x, Value.y, Value.z, Value.w);
         }
 
@@ -85,6 +91,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const GLint Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform1i(UniformId, Value);
         }
 
@@ -96,6 +103,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::ivec2 Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform2i(UniformId, Value.x, Value.y);
         }
 
@@ -107,6 +115,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::ivec3& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform3i(UniformId, Value.x, Value.y, Value.z);
         }
 
@@ -118,6 +127,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::ivec4& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform4i(UniformId, Value.x, Value.y, Value.z, Value.w);
         }
 
@@ -128,6 +138,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const bool Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform1i(UniformId, static_cast<int>(Value));
         }
 
@@ -138,6 +149,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const GLuint Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform1ui(UniformId, Value);
         }
 
@@ -149,6 +161,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::uvec2 Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform2ui(UniformId, Value.x, Value.y);
         }
 
@@ -160,6 +173,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::uvec3& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform3ui(UniformId, Value.x, Value.y, Value.z);
         }
 
@@ -171,6 +185,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::uvec4& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform4ui(UniformId, Value.x, Value.y, Value.z, Value.w);
         }
 
@@ -182,6 +197,7 @@ namespace Shaders
 
         static void SetUniform(const GLint UniformId, const glm::mat4& Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniformMatrix4fv(UniformId, 1, false, glm::value_ptr(Value));
         }
 
@@ -192,6 +208,7 @@ namespace Shaders
 
         static void SetTexture(const GLint UniformId, const GLint Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform1i(UniformId, Value);
         }
 
@@ -202,6 +219,7 @@ namespace Shaders
 
         static void SetTextureHandle(const GLint UniformId, const GLuint64 Value)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniformHandleui64ARB(UniformId, Value);
         }
 
@@ -212,22 +230,34 @@ namespace Shaders
 
         static void SetUniformArray(const GLint UniformId, const glm::vec3* Array, const GLsizei Count)
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform3fv(UniformId, Count, glm::value_ptr(*Array));
         }
 
         void SetUniformArray(const char* const Name, const glm::vec3* Array, const GLsizei Count) const
         {
+            TELEMETRY_COUNT(UniformsSet, 1);
             glUniform3fv(glGetUniformLocation(Id, Name), Count, glm::value_ptr(*Array));
         }
 
+        /**
+         * @brief Returns location of a uniform, -1 without an OpenGL context.
+         */
         GLint GetUniformLocation(const char* const Name) const
         {
+            if (!Engine::GraphicsContext::IsAvailable())
+            {
+                return -1;
+            }
             return glGetUniformLocation(Id, Name);
         }
 
         void Delete()
         {
-            glDeleteProgram(Id);
+            if (Engine::GraphicsContext::IsAvailable())
+            {
+                glDeleteProgram(Id);
+            }
         }
     };
 } // Shaders
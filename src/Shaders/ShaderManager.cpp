@@ -4,6 +4,7 @@
 
 #include "GlslPreprocessor.h"
 #include "ShaderException.h"
+#include "Engine/Rendering/GraphicsContext.h"
 #include "Utility/AssertionsUtility.h"
 
 namespace
@@ -72,9 +73,12 @@ namespace Shaders
 
     void ShaderManager::FreeResources()
     {
-        for (const auto& pair : ShaderStages)
+        if (Engine::GraphicsContext::IsAvailable())
         {
-            glDeleteShader(pair.second);
+            for (const auto& pair : ShaderStages)
+            {
+                glDeleteShader(pair.second);
+            }
         }
         ShaderStages.clear();
         for (auto& pair : ShaderPrograms)
@@ -124,6 +128,11 @@ namespace Shaders
 
     Shader ShaderManager::CreateShader(const ShaderSourceFiles& ShaderSource)
     {
+        if (!Engine::GraphicsContext::IsAvailable())
+        {
+            return Shader(NextPlaceholderId++);
+        }
+
         unsigned int vertexShader;
         try
         {
@@ -185,6 +194,11 @@ namespace Shaders
 
     ComputeShader ShaderManager::CreateComputeShader(const char* const sourceFile)
     {
+        if (!Engine::GraphicsContext::IsAvailable())
+        {
+            return ComputeShader(NextPlaceholderId++);
+        }
+
         unsigned int ComputeShaderId;
         try
         {
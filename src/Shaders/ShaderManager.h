@@ -15,6 +15,8 @@ namespace Shaders
         static std::unordered_map<std::string, unsigned int> ShaderStages;
         static std::unordered_map<ShaderSourceFiles, Shader> ShaderPrograms;
         static std::unordered_map<std::string, ComputeShader> ComputeShaderPrograms;
+        /*id given to the next shader created without an OpenGL context, nothing is compiled then*/
+        static inline unsigned int NextPlaceholderId = 1;
 
     public:
         static uint32_t BoundShaderId;
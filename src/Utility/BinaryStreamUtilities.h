@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Utility
+{
+    /**
+     * @brief Writes raw bytes of a trivially copyable value.
+     * @param Stream Binary output stream.
+     * @param Value Value to be written.
+     */
+    template<typename T>
+    void WriteBinary(std::ostream& Stream, const T& Value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+    }
+
+    /**
+     * @brief Reads raw bytes of a trivially copyable value.
+     * @param Stream Binary input stream.
+     * @param Value Destination.
+     */
+    template<typename T>
+    void ReadBinary(std::istream& Stream, T& Value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Stream.read(reinterpret_cast<char*>(&Value), sizeof(T));
+    }
+
+    /**
+     * @brief Returns number of bytes left to read in a seekable stream, 0 if the stream has failed.
+     */
+    inline uint64_t GetRemainingSize(std::istream& Stream)
+    {
+        const std::streampos position = Stream.tellg();
+        if (position < 0)
+        {
+            return 0;
+        }
+        Stream.seekg(0, std::ios::end);
+        const std::streampos end = Stream.tellg();
+        Stream.seekg(position);
+        return end > position ? static_cast<uint64_t>(end - position) : 0;
+    }
+
+    /**
+     * @brief Fails the stream if fewer than Count items of a given size are left in it.
+     * Counts read from a file have to be checked before anything is allocated for them.
+     * @return True if the items can be read.
+     */
+    inline bool CheckRemaining(std::istream& Stream, const uint64_t Count, const uint64_t ItemSize)
+    {
+        if (!Stream || Count > GetRemainingSize(Stream) / std::max<uint64_t>(ItemSize, 1))
+        {
+            Stream.setstate(std::ios::failbit);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes element count followed by contiguous elements.
+     */
+    template<typename T>
+    void WriteBinary(std::ostream& Stream, const std::vector<T>& Values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const uint32_t count = static_cast<uint32_t>(Values.size());
+        WriteBinary(Stream, count);
+        Stream.write(reinterpret_cast<const char*>(Values.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    /**
+     * @brief Reads vector written by WriteBinary.
+     */
+    template<typename T>
+    void ReadBinary(std::istream& Stream, std::vector<T>& Values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        uint32_t count = 0;
+        ReadBinary(Stream, count);
+        if (!CheckRemaining(Stream, count, sizeof(T)))
+        {
+            Values.clear();
+            return;
+        }
+        Values.resize(count);
+        Stream.read(reinterpret_cast<char*>(Values.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    inline void WriteBinary(std::ostream& Stream, const std::string& Value)
+    {
+        const uint32_t length = static_cast<uint32_t>(Value.size());
+        WriteBinary(Stream, length);
+        Stream.write(Value.data(), length);
+    }
+
+    inline void ReadBinary(std::istream& Stream, std::string& Value)
+    {
+        uint32_t length = 0;
+        ReadBinary(Stream, length);
+        if (!CheckRemaining(Stream, length, 1))
+        {
+            Value.clear();
+            return;
+        }
+        Value.resize(length);
+        Stream.read(Value.data(), length);
+    }
+} // Utility
@@ -10,27 +10,23 @@
 
 #define EXIT\
     {\
-    free(buffer);\
     fclose(f);\
-    return textureId;\
+    return false;\
     }
 
 #define NOTIFY_FAILED spdlog::error("Loading texture from {0} failed.", FilePath);
 
 namespace Utility
 {
-    GLuint LoadDds(const char* FilePath, int& Width, int& Height)
+    bool ReadDds(const char* FilePath, DdsImage& Image)
     {
-        GLuint textureId = 0;
-
         FILE* f;
-        uint8_t* buffer;
         if (fopen_s(&f, FilePath, "rb") != 0)
         {
 #if DEBUG
             NOTIFY_FAILED
 #endif
-            return textureId;
+            return false;
         }
 
         fseek(f, 0, SEEK_END);
@@ -53,12 +49,9 @@ namespace Utility
         fread(&header, sizeof(DDS_HEADER), 1, f);
         fread(&headerDxt, sizeof(DDS_HEADER_DXT10), 1, f);
 
-        Height = static_cast<int>(header.dwHeight);
-        Width = static_cast<int>(header.dwWidth);
-
-        int32_t format;
-        int32_t blockSize;
-        GLenum dataType;
+        Image.Height = static_cast<int32_t>(header.dwHeight);
+        Image.Width = static_cast<int32_t>(header.dwWidth);
+        Image.MipMapCount = header.dwMipMapCount;
 
 #if DEBUG
         constexpr char DX10FourCC[4] = {'D', 'X', '1', '0'};
@@ -71,34 +64,34 @@ namespace Utility
         switch (headerDxt.dxgiFormat)
         {
             case DXGI_FORMAT_BC1_UNORM: // DXT1
-                format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
-                blockSize = 8;
-                dataType = GL_NONE;
+                Image.Format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+                Image.BlockSize = 8;
+                Image.DataType = GL_NONE;
                 break;
             case DXGI_FORMAT_BC2_UNORM: // DXT3
-                format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
-                blockSize = 16;
-                dataType = GL_NONE;
+                Image.Format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+                Image.BlockSize = 16;
+                Image.DataType = GL_NONE;
                 break;
             case DXGI_FORMAT_BC3_UNORM: // DXT5
-                format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
-                blockSize = 16;
-                dataType = GL_NONE;
+                Image.Format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+                Image.BlockSize = 16;
+                Image.DataType = GL_NONE;
                 break;
             case DXGI_FORMAT_BC7_UNORM: // BPTC
-                format = GL_COMPRESSED_RGBA_BPTC_UNORM;
-                blockSize = 16;
-                dataType = GL_NONE;
+                Image.Format = GL_COMPRESSED_RGBA_BPTC_UNORM;
+                Image.BlockSize = 16;
+                Image.DataType = GL_NONE;
                 break;
             case DXGI_FORMAT_R16G16B16A16_UNORM: // uncompressed 16 bit
-                format = GL_RGBA16;
-                blockSize = 8;
-                dataType = GL_UNSIGNED_SHORT;
+                Image.Format = GL_RGBA16;
+                Image.BlockSize = 8;
+                Image.DataType = GL_UNSIGNED_SHORT;
                 break;
             case DXGI_FORMAT_R8G8B8A8_UNORM: // uncompressed 8 bit
-                format = GL_RGBA8;
-                blockSize = 4;
-                dataType = GL_UNSIGNED_BYTE;
+                Image.Format = GL_RGBA8;
+                Image.BlockSize = 4;
+                Image.DataType = GL_UNSIGNED_BYTE;
                 break;
             default: // Unsupported format
 #if DEBUG
@@ -107,27 +100,34 @@ namespace Utility
                 EXIT
         }
 
-        buffer = reinterpret_cast<uint8_t*>(malloc(file_size - sizeof(DDS_HEADER) - sizeof(DDS_HEADER_DXT10)));
-        if (buffer == nullptr)
+        const long dataOffset = 4 + sizeof(DDS_HEADER) + sizeof(DDS_HEADER_DXT10);
+        if (file_size <= dataOffset)
         {
 #if DEBUG
             NOTIFY_FAILED
 #endif
             EXIT
         }
+        Image.Data.resize(static_cast<size_t>(file_size - dataOffset));
+        Image.Data.resize(fread(Image.Data.data(), 1, Image.Data.size(), f));
 
-        fread(buffer, 1, file_size, f);
+        fclose(f);
+        return true;
+    }
 
+    GLuint UploadDds(const DdsImage& Image)
+    {
+        GLuint textureId = 0;
         glGenTextures(1, &textureId);
         if (textureId == 0)
         {
-            NOTIFY_FAILED
-            EXIT
+            spdlog::error("Creating texture failed.");
+            return textureId;
         }
 
         glBindTexture(GL_TEXTURE_2D, textureId);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(header.dwMipMapCount - 1));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(Image.MipMapCount - 1));
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -137,16 +137,16 @@ namespace Utility
         uint32_t offset = 0;
         int32_t size = 0;
 
-        uint32_t mipMapCount = header.dwMipMapCount;
+        uint32_t mipMapCount = Image.MipMapCount;
 
-        int32_t h = static_cast<int32_t>(header.dwHeight);
-        int32_t w = static_cast<int32_t>(header.dwWidth);
+        int32_t h = Image.Height;
+        int32_t w = Image.Width;
+        const uint8_t* const buffer = Image.Data.data();
 
         // loop through sending block at a time with the magic formula
         // upload to opengl properly, note the offset transverses the pointer
         // assumes each mipmap is 1/2 the size of the previous mipmap
-        if (headerDxt.dxgiFormat == DXGI_FORMAT_R16G16B16A16_UNORM ||
-            headerDxt.dxgiFormat == DXGI_FORMAT_R8G8B8A8_UNORM)
+        if (Image.DataType != GL_NONE)
         {
             for (unsigned int i = 0; i < mipMapCount; i++)
             {
@@ -156,9 +156,9 @@ namespace Utility
                     mipMapCount--;
                     continue;
                 }
-                size = w * h * blockSize;
-                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), format, w, h, 0, GL_RGBA, dataType,
-                             buffer + offset);
+                size = w * h * Image.BlockSize;
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), static_cast<GLint>(Image.Format), w, h, 0, GL_RGBA,
+                             Image.DataType, buffer + offset);
                 offset += size;
                 w /= 2;
                 h /= 2;
@@ -174,8 +174,8 @@ namespace Utility
                     mipMapCount--;
                     continue;
                 }
-                size = ((w + 3) / 4) * ((h + 3) / 4) * blockSize;
-                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<int32_t>(i), format, w, h, 0,
+                size = ((w + 3) / 4) * ((h + 3) / 4) * Image.BlockSize;
+                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<int32_t>(i), Image.Format, w, h, 0,
                                        size, buffer + offset);
                 offset += size;
                 w /= 2;
@@ -186,6 +186,18 @@ namespace Utility
         //discard any odd mipmaps, ensure a complete texture
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipMapCount - 1);
 
-        EXIT
+        return textureId;
+    }
+
+    GLuint LoadDds(const char* FilePath, int& Width, int& Height)
+    {
+        DdsImage image;
+        if (!ReadDds(FilePath, image))
+        {
+            return 0;
+        }
+        Width = image.Width;
+        Height = image.Height;
+        return UploadDds(image);
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <vector>
 #include "glad/glad.h"
 
 
@@ -244,6 +245,37 @@ namespace Utility
 
 #pragma pack(pop)
 
+    /**
+     * @brief Texture read from a dds file, ready to be uploaded.
+     */
+    struct DdsImage
+    {
+        GLenum Format = GL_NONE;
+        /*GL_NONE for block compressed formats*/
+        GLenum DataType = GL_NONE;
+        int32_t BlockSize = 0;
+        int32_t Width = 0;
+        int32_t Height = 0;
+        uint32_t MipMapCount = 0;
+        /*all mip levels, largest first*/
+        std::vector<uint8_t> Data;
+    };
+
+    /**
+     * @brief Reads texture data from dds file. Doesn't use OpenGL, so it can be called from any thread.
+     * @param FilePath Path to a texture file.
+     * @param Image Outputs texture data.
+     * @return False if the file couldn't be read or has an unsupported format.
+     */
+    bool ReadDds(const char* FilePath, DdsImage& Image);
+
+    /**
+     * @brief Creates OpenGL texture from data read by ReadDds.
+     * @param Image Texture data.
+     * @return Texture ID, 0 if the texture couldn't be created.
+     */
+    GLuint UploadDds(const DdsImage& Image);
+
     /**
      * @brief Loads OpenGL texture from dds file
      * @param FilePath Path to a texture file.
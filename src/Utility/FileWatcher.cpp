@@ -0,0 +1,138 @@
+#include "FileWatcher.h"
+
+#include <chrono>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+namespace
+{
+    std::filesystem::file_time_type GetWriteTime(const std::string& Path)
+    {
+        /*missing files get the default time, so they're reported once they're created*/
+        std::error_code error;
+        const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(Path, error);
+        return error ? std::filesystem::file_time_type() : writeTime;
+    }
+}
+
+namespace Utility
+{
+    FileWatcher::~FileWatcher()
+    {
+#if defined(_WIN32)
+        for (const WatchedDirectory& directory : Directories)
+        {
+            if (directory.Notification != nullptr)
+            {
+                FindCloseChangeNotification(directory.Notification);
+            }
+        }
+#endif
+    }
+
+    bool FileWatcher::Watch(const std::string& Path)
+    {
+        if (FileIndices.contains(Path))
+        {
+            return false;
+        }
+        /*the notification is created first, so a change made in the meantime isn't missed*/
+        const size_t directory = AddDirectory(Path);
+        const bool isPolled = Directories[directory].Notification == nullptr;
+        FileIndices.emplace(Path, Files.size());
+        Files.push_back(WatchedFile{Path, GetWriteTime(Path), directory, isPolled});
+        return true;
+    }
+
+    void FileWatcher::Refresh(const std::string& Path)
+    {
+        if (const auto iterator = FileIndices.find(Path); iterator != FileIndices.end())
+        {
+            Files[iterator->second].WriteTime = GetWriteTime(Path);
+        }
+    }
+
+    void FileWatcher::Poll(const float BudgetMilliseconds, std::vector<std::string>& Changed)
+    {
+        if (Files.empty())
+        {
+            return;
+        }
+        CheckNotifications();
+
+        const auto start = std::chrono::steady_clock::now();
+        bool isAnyChecked = false;
+        size_t index = NextFile;
+        for (size_t visited = 0; visited < Files.size(); ++visited, index = (index + 1) % Files.size())
+        {
+            WatchedFile& file = Files[index];
+            if (!file.IsDirty)
+            {
+                continue;
+            }
+            const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            if (isAnyChecked && elapsed.count() >= BudgetMilliseconds)
+            {
+                break;
+            }
+            isAnyChecked = true;
+
+            file.IsDirty = Directories[file.Directory].Notification == nullptr;
+            const std::filesystem::file_time_type writeTime = GetWriteTime(file.Path);
+            if (writeTime != file.WriteTime)
+            {
+                file.WriteTime = writeTime;
+                Changed.push_back(file.Path);
+            }
+        }
+        NextFile = index;
+    }
+
+    size_t FileWatcher::AddDirectory(const std::string& FilePath)
+    {
+        std::string path = std::filesystem::path(FilePath).parent_path().string();
+        if (path.empty())
+        {
+            path = ".";
+        }
+        if (const auto iterator = DirectoryIndices.find(path); iterator != DirectoryIndices.end())
+        {
+            return iterator->second;
+        }
+
+        void* notification = nullptr;
+#if defined(_WIN32)
+        /*editors often save by renaming a temporary file, which is only reported as a change of file names*/
+        const HANDLE handle = FindFirstChangeNotificationA(path.c_str(), FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE |
+                                                                              FILE_NOTIFY_CHANGE_FILE_NAME);
+        if (handle != INVALID_HANDLE_VALUE)
+        {
+            notification = handle;
+        }
+#endif
+        DirectoryIndices.emplace(path, Directories.size());
+        Directories.push_back(WatchedDirectory{std::move(path), notification});
+        return Directories.size() - 1;
+    }
+
+    void FileWatcher::CheckNotifications()
+    {
+#if defined(_WIN32)
+        for (size_t i = 0; i < Directories.size(); ++i)
+        {
+            const HANDLE notification = Directories[i].Notification;
+            if (notification == nullptr || WaitForSingleObject(notification, 0) != WAIT_OBJECT_0)
+            {
+                continue;
+            }
+            for (WatchedFile& file : Files)
+            {
+                file.IsDirty |= file.Directory == i;
+            }
+            FindNextChangeNotification(notification);
+        }
+#endif
+    }
+} // Utility
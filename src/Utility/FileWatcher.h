@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Utility
+{
+    /**
+     * @brief Detects changes of watched files by their last write time.
+     * Directories of watched files are observed with change notifications and only files in directories that
+     * reported a change are checked. Where notifications aren't available every file is checked in turn.
+     */
+    class FileWatcher final
+    {
+    private:
+        struct WatchedDirectory
+        {
+            std::string Path;
+            /*change notification handle, nullptr if files of this directory are polled*/
+            void* Notification;
+        };
+
+        struct WatchedFile
+        {
+            std::string Path;
+            std::filesystem::file_time_type WriteTime;
+            size_t Directory;
+            /*whether the file has to be checked by the next Poll*/
+            bool IsDirty;
+        };
+
+    private:
+        std::vector<WatchedDirectory> Directories;
+        std::unordered_map<std::string, size_t> DirectoryIndices;
+        std::vector<WatchedFile> Files;
+        std::unordered_map<std::string, size_t> FileIndices;
+        /*file Poll continues from, so every file gets checked even if a single Poll can't check all of them*/
+        size_t NextFile = 0;
+
+    public:
+        FileWatcher() = default;
+
+        FileWatcher(const FileWatcher&) = delete;
+
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        ~FileWatcher();
+
+    public:
+        /**
+         * @brief Starts watching a file, its current write time is considered unchanged.
+         * @param Path Path of the file.
+         * @return False if the file was already watched.
+         */
+        bool Watch(const std::string& Path);
+
+        /**
+         * @brief Accepts the current write time of a watched file, so a change made by the caller isn't reported.
+         * @param Path Path of the file.
+         */
+        void Refresh(const std::string& Path);
+
+        /**
+         * @brief Checks watched files for changes.
+         * @param BudgetMilliseconds Time after which no further file is checked, at least one is always checked.
+         * @param Changed Paths of changed files are appended to it.
+         */
+        void Poll(float BudgetMilliseconds, std::vector<std::string>& Changed);
+
+        [[nodiscard]] bool IsWatched(const std::string& Path) const
+        {
+            return FileIndices.contains(Path);
+        }
+
+        [[nodiscard]] size_t GetFileCount() const
+        {
+            return Files.size();
+        }
+
+    private:
+        size_t AddDirectory(const std::string& FilePath);
+
+        void CheckNotifications();
+    };
+} // Utility
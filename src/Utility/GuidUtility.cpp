@@ -1,4 +1,73 @@
 #include "GuidUtility.h"
 
-namespace Utility {
-}
\ No newline at end of file
+#include <chrono>
+#include <random>
+#include <thread>
+
+namespace
+{
+    uint64_t SplitMix64(uint64_t& State)
+    {
+        uint64_t z = (State += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief xoshiro256** generator.
+     */
+    class GuidGenerator
+    {
+    private:
+        uint64_t State[4];
+
+    public:
+        GuidGenerator()
+        {
+            /*random_device alone may be deterministic on some platforms, so time and thread are mixed in*/
+            std::random_device device;
+            uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+            seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+            seed ^= std::hash<std::thread::id>()(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ull;
+            for (uint64_t& state : State)
+            {
+                state = SplitMix64(seed);
+            }
+        }
+
+        uint64_t Next()
+        {
+            const uint64_t result = Rotate(State[1] * 5, 7) * 9;
+            const uint64_t t = State[1] << 17;
+            State[2] ^= State[0];
+            State[3] ^= State[1];
+            State[1] ^= State[2];
+            State[0] ^= State[3];
+            State[2] ^= t;
+            State[3] = Rotate(State[3], 45);
+            return result;
+        }
+
+    private:
+        static uint64_t Rotate(const uint64_t Value, const int Bits)
+        {
+            return (Value << Bits) | (Value >> (64 - Bits));
+        }
+    };
+}
+
+namespace Utility
+{
+    Guid GenerateGuid()
+    {
+        thread_local GuidGenerator generator;
+        uint64_t bits[2] = {generator.Next(), generator.Next()};
+
+        Guid guid;
+        std::memcpy(&guid, bits, sizeof(guid));
+        guid.Data3 = static_cast<uint16_t>((guid.Data3 & 0x0FFF) | 0x4000); // version 4
+        guid.Data4[0] = static_cast<uint8_t>((guid.Data4[0] & 0x3F) | 0x80); // RFC 4122 variant
+        return guid;
+    }
+} // Utility
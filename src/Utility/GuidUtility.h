@@ -1,19 +1,39 @@
 #pragma once
 
-#pragma comment(lib, "Ole32.lib")
-#include <windows.h>
-#include <combaseapi.h>
-
-#include "AssertionsUtility.h"
+#include <cstdint>
+#include <cstring>
 
 namespace Utility
 {
-    [[nodiscard]] inline GUID GenerateGuid()
+    /**
+     * @brief Portable 128-bit identifier. Laid out like a Windows GUID, so its text form is unchanged.
+     */
+    struct Guid
     {
-        GUID out;
-        const HRESULT result = CoCreateGuid(&out); //ID Initialized here.
-        CHECK_MESSAGE(result == S_OK, "Failed to initialize GUID")
-        return out;
-    }
+        uint32_t Data1 = 0;
+        uint16_t Data2 = 0;
+        uint16_t Data3 = 0;
+        uint8_t Data4[8] = {};
+
+        bool operator==(const Guid& Other) const
+        {
+            return std::memcmp(this, &Other, sizeof(Guid)) == 0;
+        }
+
+        /**
+         * @brief Checks whether this is the all-zero Guid, which is never generated.
+         */
+        [[nodiscard]] bool IsNull() const
+        {
+            return *this == Guid();
+        }
+    };
+
+    static_assert(sizeof(Guid) == 16, "Guid has to be exactly 128 bits.");
 
+    /**
+     * @brief Generates a random (version 4) Guid. Every thread uses its own generator, seeded once,
+     * so no system call is made per Guid.
+     */
+    [[nodiscard]] Guid GenerateGuid();
 }
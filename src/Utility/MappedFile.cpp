@@ -0,0 +1,92 @@
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utility
+{
+#if defined(_WIN32)
+    MappedFile::MappedFile(const char* const Path)
+    {
+        const HANDLE file = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+        File = file;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            return;
+        }
+
+        Mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (Mapping == nullptr)
+        {
+            return;
+        }
+
+        Data = static_cast<const uint8_t*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+        if (Data != nullptr)
+        {
+            Size = static_cast<size_t>(size.QuadPart);
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (Data != nullptr)
+        {
+            UnmapViewOfFile(Data);
+        }
+        if (Mapping != nullptr)
+        {
+            CloseHandle(Mapping);
+        }
+        if (File != nullptr)
+        {
+            CloseHandle(File);
+        }
+    }
+#else
+    MappedFile::MappedFile(const char* const Path)
+    {
+        const int file = open(Path, O_RDONLY);
+        if (file < 0)
+        {
+            return;
+        }
+
+        /*the mapping keeps the file alive, so its descriptor isn't stored*/
+        struct stat status{};
+        if (fstat(file, &status) == 0 && status.st_size > 0)
+        {
+            void* const view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (view != MAP_FAILED)
+            {
+                madvise(view, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+                Mapping = view;
+                Data = static_cast<const uint8_t*>(view);
+                Size = static_cast<size_t>(status.st_size);
+            }
+        }
+        close(file);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (Mapping != nullptr)
+        {
+            munmap(Mapping, Size);
+        }
+    }
+#endif
+} // Utility
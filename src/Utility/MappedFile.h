@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Utility
+{
+    /**
+     * @brief Read only view of a whole file mapped into memory. The view stays valid until the object is destroyed.
+     */
+    class MappedFile final
+    {
+    private:
+        /*handles of the file and its mapping on Windows, only the mapped view is kept elsewhere*/
+        void* File = nullptr;
+        void* Mapping = nullptr;
+        const uint8_t* Data = nullptr;
+        size_t Size = 0;
+
+    public:
+        /**
+         * @brief Maps a file. Use IsOpen to check whether it succeeded.
+         * @param Path Path of the file.
+         */
+        explicit MappedFile(const char* Path);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile();
+
+    public:
+        [[nodiscard]] bool IsOpen() const
+        {
+            return Data != nullptr;
+        }
+
+        [[nodiscard]] const uint8_t* GetData() const
+        {
+            return Data;
+        }
+
+        [[nodiscard]] size_t GetSize() const
+        {
+            return Size;
+        }
+    };
+} // Utility
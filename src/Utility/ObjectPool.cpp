@@ -0,0 +1,16 @@
+#include "ObjectPool.h"
+
+#include <spdlog/spdlog.h>
+
+namespace Utility
+{
+    void ObjectPoolBase::LogStatistics()
+    {
+        for (const ObjectPoolBase* pool : GetPools())
+        {
+            const ObjectPoolStatistics statistics = pool->GetStatistics();
+            spdlog::info("Pool {0}: {1} allocations, {2} live, capacity {3} ({4} bytes each).", statistics.Name,
+                         statistics.Allocations, statistics.LiveObjects, statistics.Capacity, statistics.ObjectSize);
+        }
+    }
+} // Utility
@@ -0,0 +1,174 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "Engine/EngineObjects/Telemetry.h"
+
+/**
+ * @brief Routes heap allocations of exactly this class through its TObjectPool.
+ * Subclasses that don't use this macro themselves are allocated with global operator new.
+ */
+#define POOLED_ALLOCATION(__CLASS__)\
+public:\
+    static void* operator new(const size_t Size)\
+    {\
+        if (Size != sizeof(__CLASS__))\
+        {\
+            return ::operator new(Size);\
+        }\
+        return Utility::TObjectPool<__CLASS__>::GetInstance(#__CLASS__).Allocate();\
+    }\
+    static void operator delete(void* const Pointer, const size_t Size)\
+    {\
+        if (Size != sizeof(__CLASS__))\
+        {\
+            ::operator delete(Pointer);\
+            return;\
+        }\
+        Utility::TObjectPool<__CLASS__>::GetInstance(#__CLASS__).Deallocate(Pointer);\
+    }
+
+namespace Utility
+{
+    struct ObjectPoolStatistics
+    {
+        const char* Name;
+        size_t ObjectSize;
+        /*number of allocations served since start*/
+        size_t Allocations;
+        size_t LiveObjects;
+        size_t Capacity;
+    };
+
+    /**
+     * @brief Common interface of all object pools, used for reporting.
+     */
+    class ObjectPoolBase
+    {
+    protected:
+        ObjectPoolBase()
+        {
+            GetPools().push_back(this);
+        }
+
+    public:
+        virtual ~ObjectPoolBase() = default;
+
+    public:
+        [[nodiscard]] virtual ObjectPoolStatistics GetStatistics() const = 0;
+
+        /**
+         * @brief Returns all pools created so far.
+         */
+        static std::vector<ObjectPoolBase*>& GetPools()
+        {
+            static std::vector<ObjectPoolBase*> pools;
+            return pools;
+        }
+
+        /**
+         * @brief Prints statistics of all pools.
+         */
+        static void LogStatistics();
+    };
+
+    /**
+     * @brief Chunked storage for objects of a single class.
+     * Objects never move, freed slots are reused before a new chunk is allocated,
+     * so objects of one class stay close to each other in memory. Not thread safe.
+     * @tparam T Stored class.
+     * @tparam ChunkSize Number of objects per chunk.
+     */
+    template<class T, size_t ChunkSize = 64>
+    class TObjectPool final : public ObjectPoolBase
+    {
+    private:
+        union Slot
+        {
+            Slot* Next;
+            alignas(T) std::byte Storage[sizeof(T)];
+        };
+
+    private:
+        const char* Name;
+        std::vector<Slot*> Chunks;
+        Slot* FreeList = nullptr;
+        size_t UsedInLastChunk = ChunkSize;
+        size_t Allocations = 0;
+        size_t LiveObjects = 0;
+
+    private:
+        explicit TObjectPool(const char* Name) :
+            Name(Name)
+        {
+        }
+
+    public:
+        TObjectPool(const TObjectPool&) = delete;
+
+        TObjectPool& operator=(const TObjectPool&) = delete;
+
+        ~TObjectPool() override
+        {
+            for (const Slot* chunk : Chunks)
+            {
+                delete[] chunk;
+            }
+        }
+
+    public:
+        /**
+         * @brief Returns pool of T. Pool is never destroyed, so objects may outlive static destruction.
+         * @param Name Name used in statistics.
+         */
+        static TObjectPool& GetInstance(const char* Name)
+        {
+            static TObjectPool* pool = new TObjectPool(Name);
+            return *pool;
+        }
+
+        /**
+         * @brief Returns uninitialized memory for a single T.
+         */
+        [[nodiscard]] void* Allocate()
+        {
+            TELEMETRY_COUNT(PooledAllocations, 1);
+            ++Allocations;
+            ++LiveObjects;
+            if (FreeList != nullptr)
+            {
+                Slot* slot = FreeList;
+                FreeList = slot->Next;
+                return slot;
+            }
+            if (UsedInLastChunk == ChunkSize)
+            {
+                Chunks.push_back(new Slot[ChunkSize]);
+                UsedInLastChunk = 0;
+            }
+            return &Chunks.back()[UsedInLastChunk++];
+        }
+
+        /**
+         * @brief Returns memory of a destroyed object to the pool.
+         * @param Pointer Memory obtained from Allocate.
+         */
+        void Deallocate(void* const Pointer)
+        {
+            if (Pointer == nullptr)
+            {
+                return;
+            }
+            --LiveObjects;
+            Slot* slot = static_cast<Slot*>(Pointer);
+            slot->Next = FreeList;
+            FreeList = slot;
+        }
+
+        [[nodiscard]] ObjectPoolStatistics GetStatistics() const override
+        {
+            return ObjectPoolStatistics{Name, sizeof(T), Allocations, LiveObjects, Chunks.size() * ChunkSize};
+        }
+    };
+} // Utility
@@ -102,6 +102,16 @@ namespace Utility
         return textureId;
     }
 
+    unsigned int UploadTexture2D(const DdsImage& Image)
+    {
+        const GLuint textureId = UploadDds(Image);
+        if (textureId != 0)
+        {
+            glMakeTextureHandleResidentARB(glGetTextureHandleARB(textureId));
+        }
+        return textureId;
+    }
+
     unsigned int LoadHdrCubeMapFromFile(const char* const FilePath)
     {
         stbi_set_flip_vertically_on_load(true);
@@ -5,12 +5,19 @@
 
 namespace Utility
 {
+    struct DdsImage;
+
     [[nodiscard]] unsigned int LoadTexture2DFromFile(const char* FilePath, GLenum Format,
                                                      uint8_t SourceChannels, GLenum SourceFormat);
 
     [[nodiscard]] unsigned int LoadTexture2DFromFile(const char* FilePath, GLenum Format, uint8_t SourceChannels,
                                                      GLenum SourceFormat, int& OutWidth, int& OutHeight);
 
+    /**
+     * @brief Creates a resident 2D texture from data read on any thread with ReadDds.
+     */
+    [[nodiscard]] unsigned int UploadTexture2D(const DdsImage& Image);
+
     [[nodiscard]] unsigned int LoadHdrCubeMapFromFile(const char* FilePath);
 
     [[nodiscard]] unsigned int IrradianceMapFromEnvironmentMap(unsigned int EnvironmentMap);
@@ -1,9 +1,91 @@
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
 #include "Engine/Engine.h"
+#include "Engine/EngineObjects/Telemetry.h"
+#include "Engine/Input/InputManager.h"
+#include "Serialization/AssetManifest.h"
+#include "Serialization/CookedFilesUtility.h"
+#include "spdlog/spdlog.h"
 
-int main(int, char**)
+/*
+ * Usage:
+ *   game                                  runs the game
+ *   game --record-input <file>            runs the game and records input to a file
+ *   game --headless <scene.lvl> [--frames <n>] [--timestep <seconds>] [--replay-input <file>] [--seed <n>]
+ *                                         simulates a scene without rendering and prints timings and state checksum,
+ *                                         equal arguments reach equal checksums; the headless executable, built
+ *                                         without GLFW, supports only this mode
+ *   game --cook <directory>               converts scenes and prefabs in a directory to the binary cooked format
+ *   game --build-manifests <directory>    writes the list of assets every scene in a directory uses, they are
+ *                                         preloaded in parallel when the scene is loaded
+ *   --telemetry-output <file.csv|file.json> writes timings and counters of the last frames on exit
+ */
+int main(int argc, char** argv)
 {
+    bool headless = false;
+    Engine::HeadlessSettings settings;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--headless") == 0 && hasValue)
+        {
+            headless = true;
+            settings.ScenePath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && hasValue)
+        {
+            settings.Frames = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--timestep") == 0 && hasValue)
+        {
+            settings.TimeStep = std::stof(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--replay-input") == 0 && hasValue)
+        {
+            settings.InputReplayPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+        {
+            settings.Seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--cook") == 0 && hasValue)
+        {
+            Serialization::CookDirectory(argv[++i]);
+            return 0;
+        }
+        else if (std::strcmp(argv[i], "--build-manifests") == 0 && hasValue)
+        {
+            Serialization::BuildManifests(argv[++i]);
+            return 0;
+        }
+        else if (std::strcmp(argv[i], "--record-input") == 0 && hasValue)
+        {
+            InputManager::GetInstance().StartRecording(argv[++i]);
+        }
+#if TELEMETRY
+        else if (std::strcmp(argv[i], "--telemetry-output") == 0 && hasValue)
+        {
+            Engine::Telemetry::SetOutputPath(argv[++i]);
+        }
+#endif
+    }
+
+#if HEADLESS
+    if (!headless)
+    {
+        spdlog::error("This build only simulates scenes, run it with --headless <scene.lvl>.");
+        return EXIT_FAILURE;
+    }
+#endif
+
     Engine::Engine* engine = new Engine::Engine();
-    int exitCode = engine->Run();
+#if HEADLESS
+    int exitCode = engine->RunHeadless(settings);
+#else
+    int exitCode = headless ? engine->RunHeadless(settings) : engine->Run();
+#endif
     delete engine;
     return exitCode;
 }